@@ -11,6 +11,9 @@
 #ifdef DYNAMIC_PROFILE_STORAGE
 #include "Language/DynamicProfileStorage.h"
 #endif
+#if ENABLE_TIER_UP_CACHE
+#include "Language/TierUpCache.h"
+#endif
 #include "JsrtContext.h"
 #include "TestHooks.h"
 #ifdef VTUNE_PROFILING
@@ -137,6 +140,9 @@ EXTERN_C BOOL WINAPI DllMain(HINSTANCE hmod, DWORD dwReason, PVOID pvReserved)
 #ifdef DYNAMIC_PROFILE_STORAGE
         DynamicProfileStorage::Uninitialize();
 #endif
+#if ENABLE_TIER_UP_CACHE
+        Js::TierUpCache::Uninitialize();
+#endif
 #ifdef ENABLE_JS_ETW
         // Do this before DetachProcess() so that we won't have ETW rundown callbacks while destroying threadContexts.
         EtwTrace::UnRegister();
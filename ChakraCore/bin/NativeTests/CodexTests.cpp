@@ -10,6 +10,8 @@
 #include "catch.hpp"
 #include <process.h>
 #include "Codex\Utf8Codex.h"
+#include <chrono>
+#include <vector>
 
 #pragma warning(disable:4100) // unreferenced formal parameter
 #pragma warning(disable:6387) // suppressing preFAST which raises warning for passing null to the JsRT APIs
@@ -287,4 +289,208 @@ namespace CodexTest
         
         RunUtf8DecodeTestCase(testCases, utf8::DecodeUnitsIntoAndNullTerminateNoAdvance);
     }
+
+    //
+    // The transcoders convert ASCII runs a block at a time. Put a multi-unit character at every
+    // position around the block boundaries and check the result against a per-character conversion.
+    //
+
+    TEST_CASE("CodexTest_DecodeUnitsInto_BlockBoundaries", "[CodexTest]")
+    {
+        const utf8char_t multiUnitChars[][4] = {
+            { 0xC3, 0xA9 },             // U+00E9
+            { 0xE2, 0x82, 0xAC },       // U+20AC
+            { 0xF0, 0x9F, 0x98, 0x80 }, // U+1F600
+            { 0xC3 }                    // truncated lead byte
+        };
+        const char16 expected[][2] = { { 0x00E9 }, { 0x20AC }, { 0xD83D, 0xDE00 }, { 0xFFFD } };
+        const size_t byteCounts[] = { 2, 3, 4, 1 };
+        const size_t unitCounts[] = { 1, 1, 2, 1 };
+
+        for (int kind = 0; kind < _countof(multiUnitChars); kind++)
+        {
+            for (size_t position = 0; position < 40; position++)
+            {
+                utf8char_t source[64];
+                char16 expectedUnits[64];
+                size_t cb = 0;
+                size_t cch = 0;
+                for (size_t i = 0; i < position; i++)
+                {
+                    source[cb++] = static_cast<utf8char_t>('a' + i % 26);
+                    expectedUnits[cch++] = static_cast<char16>('a' + i % 26);
+                }
+                for (size_t i = 0; i < byteCounts[kind]; i++)
+                {
+                    source[cb++] = multiUnitChars[kind][i];
+                }
+                for (size_t i = 0; i < unitCounts[kind]; i++)
+                {
+                    expectedUnits[cch++] = expected[kind][i];
+                }
+                while (cb < 48)
+                {
+                    source[cb++] = 'z';
+                    expectedUnits[cch++] = _u('z');
+                }
+
+                // Size the output by character count, as the scanner does, with a guard unit after it.
+                char16 decodedBuffer[65];
+                decodedBuffer[cch] = 0xBEEF;
+                LPCUTF8 pbUtf8 = source;
+                size_t decodedCount = utf8::DecodeUnitsInto(decodedBuffer, pbUtf8, source + cb);
+                CHECK(decodedCount == cch);
+                CHECK(pbUtf8 == source + cb);
+                CHECK(memcmp(decodedBuffer, expectedUnits, cch * sizeof(char16)) == 0);
+                CHECK(decodedBuffer[cch] == 0xBEEF);
+            }
+        }
+    }
+
+    TEST_CASE("CodexTest_EncodeInto_BlockBoundaries", "[CodexTest]")
+    {
+        const char16 multiUnitChars[][2] = { { 0x00E9 }, { 0x20AC }, { 0xD83D, 0xDE00 }, { 0xD83D } };
+        const utf8char_t expected[][4] = {
+            { 0xC3, 0xA9 },
+            { 0xE2, 0x82, 0xAC },
+            { 0xF0, 0x9F, 0x98, 0x80 },
+            { 0xEF, 0xBF, 0xBD }        // lone surrogate becomes U+FFFD
+        };
+        const size_t unitCounts[] = { 1, 1, 2, 1 };
+        const size_t byteCounts[] = { 2, 3, 4, 3 };
+
+        for (int kind = 0; kind < _countof(multiUnitChars); kind++)
+        {
+            for (charcount_t position = 0; position < 40; position++)
+            {
+                char16 source[64];
+                utf8char_t expectedBytes[80];
+                charcount_t cch = 0;
+                size_t cb = 0;
+                for (charcount_t i = 0; i < position; i++)
+                {
+                    source[cch++] = static_cast<char16>('a' + i % 26);
+                    expectedBytes[cb++] = static_cast<utf8char_t>('a' + i % 26);
+                }
+                for (size_t i = 0; i < unitCounts[kind]; i++)
+                {
+                    source[cch++] = multiUnitChars[kind][i];
+                }
+                for (size_t i = 0; i < byteCounts[kind]; i++)
+                {
+                    expectedBytes[cb++] = expected[kind][i];
+                }
+                while (cch < 48)
+                {
+                    source[cch++] = _u('z');
+                    expectedBytes[cb++] = 'z';
+                }
+
+                utf8char_t encodedBuffer[64 * 3 + 1];
+                size_t numEncodedBytes = utf8::EncodeIntoAndNullTerminate<utf8::Utf8EncodingKind::TrueUtf8>(encodedBuffer, cb + 1, source, cch);
+                CHECK(numEncodedBytes == cb);
+                CHECK(memcmp(encodedBuffer, expectedBytes, cb) == 0);
+                CHECK(encodedBuffer[cb] == 0);
+                CHECK(utf8::CountTrueUtf8(source, cch) == cb);
+            }
+        }
+    }
+
+    //
+    // Throughput of DecodeUnitsInto/EncodeInto over a few representative corpora.
+    // Hidden by default; run with: NativeTests.exe [CodexBench]
+    //
+
+    void AppendCodepoint(std::vector<utf8char_t> &buffer, uint32 cp)
+    {
+        if (cp < 0x80)
+        {
+            buffer.push_back(static_cast<utf8char_t>(cp));
+        }
+        else if (cp < 0x800)
+        {
+            buffer.push_back(static_cast<utf8char_t>(0xC0 | (cp >> 6)));
+            buffer.push_back(static_cast<utf8char_t>(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            buffer.push_back(static_cast<utf8char_t>(0xE0 | (cp >> 12)));
+            buffer.push_back(static_cast<utf8char_t>(0x80 | ((cp >> 6) & 0x3F)));
+            buffer.push_back(static_cast<utf8char_t>(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            buffer.push_back(static_cast<utf8char_t>(0xF0 | (cp >> 18)));
+            buffer.push_back(static_cast<utf8char_t>(0x80 | ((cp >> 12) & 0x3F)));
+            buffer.push_back(static_cast<utf8char_t>(0x80 | ((cp >> 6) & 0x3F)));
+            buffer.push_back(static_cast<utf8char_t>(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    TEST_CASE("CodexBench_Transcode", "[.][CodexBench]")
+    {
+        struct Corpus
+        {
+            const char* name;
+            int asciiPercent;   // remaining characters are drawn from [firstCp, firstCp + cpRange)
+            uint32 firstCp;
+            uint32 cpRange;
+        };
+
+        const Corpus corpora[] = {
+            { "ascii",       100, 0,       0 },
+            { "mixed-latin", 85,  0x00C0,  0x0180 },
+            { "cjk",         5,   0x4E00,  0x5000 },
+            { "emoji",       30,  0x1F600, 0x0050 },
+        };
+
+        const size_t corpusBytes = 4 * 1024 * 1024;
+        const int iterations = 20;
+
+        for (const Corpus& corpus : corpora)
+        {
+            std::vector<utf8char_t> utf8Source;
+            utf8Source.reserve(corpusBytes + 4);
+            uint32 seed = 12345;
+            while (utf8Source.size() < corpusBytes)
+            {
+                seed = seed * 1103515245 + 12345;
+                const uint32 random = seed >> 8;
+                if ((int)(random % 100) < corpus.asciiPercent)
+                {
+                    AppendCodepoint(utf8Source, 0x20 + random % 0x5F);
+                }
+                else
+                {
+                    AppendCodepoint(utf8Source, corpus.firstCp + (random >> 7) % corpus.cpRange);
+                }
+            }
+
+            std::vector<char16> utf16(utf8Source.size());
+            std::vector<utf8char_t> utf8Result(utf8Source.size() * 3);
+            size_t cch = 0;
+            size_t cb = 0;
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                LPCUTF8 pbUtf8 = utf8Source.data();
+                cch = utf8::DecodeUnitsInto(utf16.data(), pbUtf8, pbUtf8 + utf8Source.size());
+            }
+            auto decoded = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; i++)
+            {
+                cb = utf8::EncodeInto<utf8::Utf8EncodingKind::TrueUtf8>(utf8Result.data(), utf8Result.size(), utf16.data(), static_cast<charcount_t>(cch));
+            }
+            auto encoded = std::chrono::high_resolution_clock::now();
+
+            CHECK(cb == utf8Source.size());
+            CHECK(memcmp(utf8Result.data(), utf8Source.data(), cb) == 0);
+
+            const double megabytes = (double)utf8Source.size() * iterations / (1024 * 1024);
+            const double decodeSeconds = std::chrono::duration<double>(decoded - start).count();
+            const double encodeSeconds = std::chrono::duration<double>(encoded - decoded).count();
+            printf("%-12s decode %8.1f MB/s  encode %8.1f MB/s\n", corpus.name, megabytes / decodeSeconds, megabytes / encodeSeconds);
+        }
+    }
 };
@@ -156,6 +156,76 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::WeakReferenceTest);
     }
 
+    struct ResurrectedKeyState
+    {
+        JsValueRef key;
+        int callbackCount;
+    };
+
+    void CHAKRA_CALLBACK ResurrectedKeyBeforeCollect(JsRef ref, void* callbackState)
+    {
+        ResurrectedKeyState* state = static_cast<ResurrectedKeyState*>(callbackState);
+        state->callbackCount++;
+        if (state->key == JS_INVALID_REFERENCE)
+        {
+            // Registering a callback again from inside one revives the object
+            state->key = ref;
+            JsSetObjectBeforeCollectCallback(ref, callbackState, ResurrectedKeyBeforeCollect);
+        }
+    }
+
+    void WeakMapResurrectedKeyTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef globalRef = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&globalRef) == JsNoError);
+        JsPropertyIdRef keyId = JS_INVALID_REFERENCE;
+        JsPropertyIdRef valueId = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetPropertyIdFromName(_u("key"), &keyId) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("value"), &valueId) == JsNoError);
+
+        JsValueRef result = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var wm = new WeakMap(); var key = {}; var value = { marker: 42 }; wm.set(key, value);"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        ResurrectedKeyState state = { JS_INVALID_REFERENCE, 0 };
+        JsWeakRef valueWeakRef = JS_INVALID_REFERENCE;
+        {
+            JsValueRef key = JS_INVALID_REFERENCE;
+            JsValueRef value = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetProperty(globalRef, keyId, &key) == JsNoError);
+            REQUIRE(JsGetProperty(globalRef, valueId, &value) == JsNoError);
+            REQUIRE(JsSetObjectBeforeCollectCallback(key, &state, ResurrectedKeyBeforeCollect) == JsNoError);
+            REQUIRE(JsCreateWeakReference(value, &valueWeakRef) == JsNoError);
+        }
+
+        // Now the value is only reachable through the WeakMap entry, whose key is only reachable through the callback
+        REQUIRE(JsRunScript(_u("key = undefined; value = undefined;"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        result = JS_INVALID_REFERENCE;
+
+        ClearStack();
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(state.callbackCount == 1);
+        REQUIRE(state.key != JS_INVALID_REFERENCE);
+
+        // Reviving the key made the entry live again, so marking has to reach its value too
+        JsValueRef valueAfterGC = JS_INVALID_REFERENCE;
+        CHECK(JsGetWeakReferenceValue(valueWeakRef, &valueAfterGC) == JsNoError);
+        CHECK(valueAfterGC != JS_INVALID_REFERENCE);
+
+        REQUIRE(JsSetProperty(globalRef, keyId, state.key, true) == JsNoError);
+        REQUIRE(JsRunScript(_u("wm.get(key).marker === 42"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        bool hasValue = false;
+        REQUIRE(JsBooleanToBool(result, &hasValue) == JsNoError);
+        CHECK(hasValue);
+
+        REQUIRE(JsSetObjectBeforeCollectCallback(state.key, nullptr, nullptr) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_WeakMapResurrectedKeyTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::WeakMapResurrectedKeyTest);
+    }
+
     void ObjectsAndPropertiesTest1(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         JsValueRef object = JS_INVALID_REFERENCE;
@@ -2774,6 +2844,357 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::JsCreateStringTest);
     }
 
+    struct StringifyUtf8Output
+    {
+        char text[4096];
+        size_t length;
+        size_t chunks;
+        JsErrorCode result;
+    };
+
+    JsErrorCode CHAKRA_CALLBACK StringifyUtf8Collect(const char* chunk, size_t length, void* callbackState)
+    {
+        StringifyUtf8Output* output = static_cast<StringifyUtf8Output*>(callbackState);
+        REQUIRE(output->length + length <= sizeof(output->text));
+        memcpy(output->text + output->length, chunk, length);
+        output->length += length;
+        output->chunks++;
+        return output->result;
+    }
+
+    void JsStringifyUtf8Test(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef value = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("({ a: [1, -2.5, 1e21, -0, true, null, 'q\"\\n\\u0001\\u00e9\\ud83d\\ude00\\ud800'], ")
+            _u("b: { toJSON: function () { return 7; } }, c: undefined, d: function () {}, '\\u00e9': '' })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &value) == JsNoError);
+
+        const char expected[] = "{\"a\":[1,-2.5,1e+21,0,true,null,\"q\\\"\\n\\u0001\xC3\xA9\xF0\x9F\x98\x80\\ud800\"],\"b\":7,\"\xC3\xA9\":\"\"}";
+        const size_t expectedLength = strlen(expected);
+
+        // Length only
+        size_t written = 0;
+        REQUIRE(JsStringifyUtf8(value, nullptr, 0, nullptr, nullptr, &written) == JsNoError);
+        CHECK(written == expectedLength);
+
+        // Fixed buffer, too small and large enough
+        char buffer[256];
+        CHECK(JsStringifyUtf8(value, buffer, 10, nullptr, nullptr, &written) == JsErrorInvalidArgument);
+        CHECK(written == expectedLength);
+        CHECK(JsStringifyUtf8(value, buffer, expectedLength - 1, nullptr, nullptr, &written) == JsErrorInvalidArgument);
+        CHECK(written == expectedLength);
+        REQUIRE(JsStringifyUtf8(value, buffer, expectedLength, nullptr, nullptr, &written) == JsNoError);
+        CHECK(written == expectedLength);
+        CHECK(memcmp(buffer, expected, expectedLength) == 0);
+        REQUIRE(JsStringifyUtf8(value, buffer, sizeof(buffer), nullptr, nullptr, &written) == JsNoError);
+        CHECK(written == expectedLength);
+        CHECK(memcmp(buffer, expected, expectedLength) == 0);
+
+        // Escapes and multi-byte characters near the end of a fixed buffer that has room for them
+        JsValueRef nearEnd = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("['abcdefghij\\n', 'abcdefghijk\\u00e9', 'abcdefghij\\ud83d\\ude00', 'abcdefgh\\u0001']"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &nearEnd) == JsNoError);
+        const char* const nearEndExpected[] = { "\"abcdefghij\\n\"", "\"abcdefghijk\xC3\xA9\"", "\"abcdefghij\xF0\x9F\x98\x80\"", "\"abcdefgh\\u0001\"" };
+        for (unsigned int i = 0; i < _countof(nearEndExpected); i++)
+        {
+            JsValueRef index = JS_INVALID_REFERENCE;
+            JsValueRef item = JS_INVALID_REFERENCE;
+            REQUIRE(JsIntToNumber(i, &index) == JsNoError);
+            REQUIRE(JsGetIndexedProperty(nearEnd, index, &item) == JsNoError);
+
+            const size_t itemLength = strlen(nearEndExpected[i]);
+            char small[16];
+            REQUIRE(JsStringifyUtf8(item, small, sizeof(small), nullptr, nullptr, &written) == JsNoError);
+            CHECK(written == itemLength);
+            CHECK(memcmp(small, nearEndExpected[i], itemLength) == 0);
+            CHECK(JsStringifyUtf8(item, small, itemLength - 1, nullptr, nullptr, &written) == JsErrorInvalidArgument);
+            CHECK(written == itemLength);
+        }
+
+        // Chunks of the smallest size, with strings longer than a chunk
+        JsValueRef longValue = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var s = new Array(150).join('x\\u00e9\\n\"'); [s, { k: s }, JSON.parse(JSON.stringify(s))]"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &longValue) == JsNoError);
+        StringifyUtf8Output output = { { 0 }, 0, 0, JsNoError };
+        REQUIRE(JsStringifyUtf8(longValue, buffer, 64, StringifyUtf8Collect, &output, &written) == JsNoError);
+        CHECK(written == output.length);
+        CHECK(output.chunks > 1);
+
+        JsValueRef jsonText = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("JSON.stringify([s, { k: s }, s])"), JS_SOURCE_CONTEXT_NONE, _u(""), &jsonText) == JsNoError);
+        char copied[4096];
+        size_t copiedLength = 0;
+        REQUIRE(JsCopyString(jsonText, copied, sizeof(copied), &copiedLength) == JsNoError);
+        CHECK(copiedLength == output.length);
+        CHECK(memcmp(copied, output.text, copiedLength) == 0);
+
+        // The runtime's own chunk buffer
+        StringifyUtf8Output ownBuffer = { { 0 }, 0, 0, JsNoError };
+        REQUIRE(JsStringifyUtf8(longValue, nullptr, 0, StringifyUtf8Collect, &ownBuffer, &written) == JsNoError);
+        CHECK(ownBuffer.length == output.length);
+        CHECK(memcmp(ownBuffer.text, output.text, output.length) == 0);
+        CHECK(JsStringifyUtf8(longValue, buffer, 63, StringifyUtf8Collect, &ownBuffer, &written) == JsErrorInvalidArgument);
+
+        // An error from the callback stops the stringification
+        StringifyUtf8Output stopped = { { 0 }, 0, 0, JsErrorInvalidArgument };
+        CHECK(JsStringifyUtf8(longValue, buffer, 64, StringifyUtf8Collect, &stopped, &written) == JsErrorInvalidArgument);
+        CHECK(stopped.chunks == 1);
+
+        // No JSON representation
+        REQUIRE(JsStringifyUtf8(GetUndefined(), buffer, sizeof(buffer), nullptr, nullptr, &written) == JsNoError);
+        CHECK(written == 0);
+
+        // Exceptions while reading the value
+        JsValueRef cyclic = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var o = {}; o.self = o; o"), JS_SOURCE_CONTEXT_NONE, _u(""), &cyclic) == JsNoError);
+        CHECK(JsStringifyUtf8(cyclic, buffer, sizeof(buffer), nullptr, nullptr, &written) == JsErrorScriptException);
+        JsValueRef exception = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_JsStringifyUtf8Test", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsStringifyUtf8Test);
+    }
+
+    JsErrorCode JsonParseChunks(const char* text, size_t length, size_t chunkSize, JsValueRef* result)
+    {
+        JsJsonParserHandle parser = nullptr;
+        JsErrorCode errorCode = JsJsonParseBegin(&parser);
+        if (errorCode != JsNoError)
+        {
+            return errorCode;
+        }
+
+        for (size_t offset = 0; offset < length; offset += chunkSize)
+        {
+            errorCode = JsJsonParseFeed(parser, text + offset, length - offset < chunkSize ? length - offset : chunkSize);
+            if (errorCode != JsNoError)
+            {
+                CHECK(JsJsonParseFinish(parser, result) == JsErrorInvalidArgument);
+                return errorCode;
+            }
+        }
+        return JsJsonParseFinish(parser, result);
+    }
+
+    void JsJsonParseTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        const char text[] = " {\"a\":[1,-2.5e3,0.125,-0,123456789012345678,true,false,null,\"x\xC3\xA9\xF0\x9F\x98\x80\\n\\u0041\\ud83d\\ude00\"],"
+            "\"b\":{\"c\":{},\"d\":[[]]},\"\xC3\xA9\":\"\",\"z\":-0,\"a\":\"last\"} ";
+        const size_t length = strlen(text);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef textId = JS_INVALID_REFERENCE;
+        JsPropertyIdRef parsedId = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyId("text", strlen("text"), &textId) == JsNoError);
+        REQUIRE(JsCreatePropertyId("parsed", strlen("parsed"), &parsedId) == JsNoError);
+        JsValueRef textString = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateString(text, length, &textString) == JsNoError);
+        REQUIRE(JsSetProperty(global, textId, textString, true) == JsNoError);
+
+        // Every chunk size, down to one byte at a time (which splits the UTF-8 sequences and escapes), gives what
+        // JSON.parse gives
+        for (size_t chunkSize = 1; chunkSize <= length; chunkSize++)
+        {
+            JsValueRef parsed = JS_INVALID_REFERENCE;
+            REQUIRE(JsonParseChunks(text, length, chunkSize, &parsed) == JsNoError);
+            REQUIRE(JsSetProperty(global, parsedId, parsed, true) == JsNoError);
+
+            JsValueRef same = JS_INVALID_REFERENCE;
+            bool isSame = false;
+            REQUIRE(JsRunScript(_u("var expected = JSON.parse(text); JSON.stringify(parsed) === JSON.stringify(expected) && ")
+                _u("1 / parsed.z === -Infinity && parsed.a === 'last' && Object.keys(parsed).join() === 'a,b,\\u00e9,z'"),
+                JS_SOURCE_CONTEXT_NONE, _u(""), &same) == JsNoError);
+            REQUIRE(JsBooleanToBool(same, &isSame) == JsNoError);
+            CHECK(isSame);
+        }
+
+        // A value that is complete at the end of the input
+        JsValueRef number = JS_INVALID_REFERENCE;
+        double numberValue = 0;
+        REQUIRE(JsonParseChunks("42", 2, 1, &number) == JsNoError);
+        REQUIRE(JsNumberToDouble(number, &numberValue) == JsNoError);
+        CHECK(numberValue == 42);
+
+        // Syntax errors, in a chunk and at the end of the input
+        const char* invalid[] = { "[1,]", "{\"a\" 1}", "[1 2]", "{\"a\":01}", "\"\\x\"", "tru", "[1", "{\"a\":1", "\"abc", "1.", "", "[] 1" };
+        for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+        {
+            JsValueRef parsed = JS_INVALID_REFERENCE;
+            CHECK(JsonParseChunks(invalid[i], strlen(invalid[i]), 1, &parsed) == JsErrorScriptException);
+            CHECK(parsed == JS_INVALID_REFERENCE);
+            JsValueRef exception = JS_INVALID_REFERENCE;
+            REQUIRE(JsGetAndClearException(&exception) == JsNoError);
+        }
+    }
+
+    TEST_CASE("ApiTest_JsJsonParseTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JsJsonParseTest);
+    }
+
+    byte* CHAKRA_CALLBACK TransferReallocateBuffer(void* /*state*/, byte* oldBuffer, size_t newSize, size_t* allocatedSize)
+    {
+        byte* newBuffer = (byte*)realloc(oldBuffer, newSize);
+        *allocatedSize = newSize;
+        return newBuffer;
+    }
+
+    bool CHAKRA_CALLBACK TransferWriteHostObject(void* /*state*/, void* /*hostObject*/)
+    {
+        return false;
+    }
+
+    JsValueRef TransferReadHostObject(void* /*state*/)
+    {
+        return JS_INVALID_REFERENCE;
+    }
+
+    JsValueRef TransferGetSharedArrayBufferFromId(void* /*state*/, uint32_t /*id*/)
+    {
+        return JS_INVALID_REFERENCE;
+    }
+
+    void VarSerializerTransferTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef message = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var buffer = new ArrayBuffer(16); new Uint8Array(buffer).fill(7);")
+            _u("({ a: 1, b: 'x', c: { d: [1, 2] }, buffer: buffer, view: new Uint8Array(buffer, 4, 8) })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &message) == JsNoError);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef bufferId = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyId("buffer", strlen("buffer"), &bufferId) == JsNoError);
+        JsValueRef buffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetProperty(global, bufferId, &buffer) == JsNoError);
+        ChakraBytePtr storage = nullptr;
+        unsigned int storageLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(buffer, &storage, &storageLength) == JsNoError);
+
+        JsVarSerializerHandle serializer = nullptr;
+        REQUIRE(JsVarSerializer(TransferReallocateBuffer, TransferWriteHostObject, nullptr, &serializer) == JsNoError);
+        REQUIRE(JsVarSerializerSetTransferableVars(serializer, &buffer, 1) == JsNoError);
+        REQUIRE(JsVarSerializerWriteValue(serializer, message) == JsNoError);
+        REQUIRE(JsVarSerializerDetachArrayBuffer(serializer) == JsNoError);
+        CHECK(JsVarSerializerDetachArrayBuffer(serializer) == JsErrorInvalidArgument);
+        byte* data = nullptr;
+        size_t dataLength = 0;
+        REQUIRE(JsVarSerializerReleaseData(serializer, &data, &dataLength) == JsNoError);
+        JsTransferredContentsHandle contents = nullptr;
+        REQUIRE(JsVarSerializerReleaseTransferredContents(serializer, &contents) == JsNoError);
+        REQUIRE(JsVarSerializerFree(serializer) == JsNoError);
+
+        JsVarDeserializerHandle deserializer = nullptr;
+        REQUIRE(JsVarDeserializer(data, dataLength, TransferReadHostObject, TransferGetSharedArrayBufferFromId, nullptr, &deserializer) == JsNoError);
+        REQUIRE(JsVarDeserializerSetTransferredContents(deserializer, contents) == JsNoError);
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        REQUIRE(JsVarDeserializerReadValue(deserializer, &copy) == JsNoError);
+        REQUIRE(JsVarDeserializerFree(deserializer) == JsNoError);
+        REQUIRE(JsReleaseTransferredContents(contents) == JsNoError);
+        free(data);
+
+        JsPropertyIdRef copyId = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyId("copy", strlen("copy"), &copyId) == JsNoError);
+        REQUIRE(JsSetProperty(global, copyId, copy, true) == JsNoError);
+
+        // The sender's buffer is detached, and the copy owns the same memory
+        JsValueRef same = JS_INVALID_REFERENCE;
+        bool isSame = false;
+        REQUIRE(JsRunScript(_u("buffer.byteLength === 0 && copy.a === 1 && copy.b === 'x' && copy.c.d[1] === 2 && ")
+            _u("copy.buffer.byteLength === 16 && copy.view.buffer === copy.buffer && copy.view.length === 8 && copy.view[7] === 7"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &same) == JsNoError);
+        REQUIRE(JsBooleanToBool(same, &isSame) == JsNoError);
+        CHECK(isSame);
+
+        JsValueRef copyBuffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetProperty(copy, bufferId, &copyBuffer) == JsNoError);
+        ChakraBytePtr copyStorage = nullptr;
+        unsigned int copyStorageLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(copyBuffer, &copyStorage, &copyStorageLength) == JsNoError);
+        CHECK(copyStorage == storage);
+        CHECK(copyStorageLength == storageLength);
+    }
+
+    TEST_CASE("ApiTest_VarSerializerTransferTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::VarSerializerTransferTest);
+    }
+
+    void ContextSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef state = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("var shared = { name: 'shared' };")
+            _u("var state = { config: { debug: false, limit: 1.5, tags: ['a', 'b'] }, table: new Map([[1, shared], [2, shared]]),")
+            _u("  bytes: new Uint8Array([1, 2, 3]), when: new Date(0), pattern: /x+/g };")
+            _u("function scale(x) { return x * state.config.limit; }")
+            _u("state.scale = scale; state.alsoScale = scale; state.add = (a, b) => a + b; state.self = state; state"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &state) == JsNoError);
+
+        JsValueRef snapshot = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContextSnapshot(state, &snapshot) == JsNoError);
+        ChakraBytePtr image = nullptr;
+        unsigned int imageLength = 0;
+        REQUIRE(JsGetArrayBufferStorage(snapshot, &image, &imageLength) == JsNoError);
+
+        // Inflate in a new context from a copy of the image, as from a mapped file
+        BYTE* mapped = (BYTE*)malloc(imageLength);
+        memcpy(mapped, image, imageLength);
+
+        JsContextRef current = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetCurrentContext(&current) == JsNoError);
+        JsContextRef context = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateContext(runtime, &context) == JsNoError);
+        REQUIRE(JsSetCurrentContext(context) == JsNoError);
+
+        JsValueRef mappedBuffer = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateExternalArrayBuffer(mapped, imageLength, nullptr, nullptr, &mappedBuffer) == JsNoError);
+        JsValueRef copy = JS_INVALID_REFERENCE;
+        REQUIRE(JsInflateContextSnapshot(mappedBuffer, &copy) == JsNoError);
+
+        JsValueRef global = JS_INVALID_REFERENCE;
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        JsPropertyIdRef stateId = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreatePropertyId("state", strlen("state"), &stateId) == JsNoError);
+        REQUIRE(JsSetProperty(global, stateId, copy, true) == JsNoError);
+
+        JsValueRef same = JS_INVALID_REFERENCE;
+        bool isSame = false;
+        REQUIRE(JsRunScript(_u("state.self === state && state.config.debug === false && state.config.limit === 1.5 && ")
+            _u("state.config.tags.join() === 'a,b' && state.table.get(1) === state.table.get(2) && state.table.get(1).name === 'shared' && ")
+            _u("state.bytes.join() === '1,2,3' && state.when.getTime() === 0 && state.pattern.source === 'x+' && state.pattern.global && ")
+            _u("state.scale === state.alsoScale && state.scale.name === 'scale' && state.scale(2) === 3 && state.add(1, 2) === 3"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &same) == JsNoError);
+        REQUIRE(JsBooleanToBool(same, &isSame) == JsNoError);
+        CHECK(isSame);
+
+        // Functions that close over local variables and methods can't be in a snapshot, and a buffer that isn't an
+        // image is rejected
+        JsValueRef withClosure = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("(function () { var count = 0; return { next: function () { return ++count; } }; })()"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &withClosure) == JsNoError);
+        JsValueRef rejected = JS_INVALID_REFERENCE;
+        CHECK(JsCreateContextSnapshot(withClosure, &rejected) == JsErrorInvalidArgument);
+
+        JsValueRef withMethod = JS_INVALID_REFERENCE;
+        REQUIRE(JsRunScript(_u("({ f() {} })"), JS_SOURCE_CONTEXT_NONE, _u(""), &withMethod) == JsNoError);
+        CHECK(JsCreateContextSnapshot(withMethod, &rejected) == JsErrorInvalidArgument);
+
+        JsValueRef notAnImage = JS_INVALID_REFERENCE;
+        REQUIRE(JsCreateArrayBuffer(64, &notAnImage) == JsNoError);
+        CHECK(JsInflateContextSnapshot(notAnImage, &rejected) == JsErrorBadSerializedScript);
+
+        REQUIRE(JsSetCurrentContext(current) == JsNoError);
+        free(mapped);
+    }
+
+    TEST_CASE("ApiTest_ContextSnapshotTest", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::ContextSnapshotTest);
+    }
+
     void ApiTest_JsSerializeArrayTest(JsRuntimeAttributes /*attributes*/, JsRuntimeHandle /*runtime*/)
     {
         LPCSTR raw_script = "(function (){return true;})();";
@@ -25,6 +25,10 @@
 #include "Library/StackScriptFunction.h"
 #include "Library/JavascriptProxy.h"
 #include "Library/JavascriptGeneratorFunction.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataTable.h"
+#include "Library/JavascriptMap.h"
+#include "Library/JavascriptSet.h"
 
 #include "Language/InterpreterStackFrame.h"
 
@@ -146,6 +146,14 @@ BackwardPass::DoDeadStoreSlots() const
         && (!this->func->HasTry()));
 }
 
+bool
+BackwardPass::DoScalarReplacement() const
+{
+    // Object literals whose field loads were all copy-propped by glob opt are removed along with their InitFlds
+    return DoDeadStore() && this->func->DoGlobOpt() && !this->func->HasTry() && !this->func->IsJitInDebugMode()
+        && !PHASE_OFF(Js::ScalarReplacementPhase, this->func);
+}
+
 // Whether dead store is enabled for given func and sym.
 // static
 bool
@@ -2756,6 +2764,10 @@ BackwardPass::ProcessBailOutInfo(IR::Instr * instr, BailOutInfo * bailOutInfo)
         });
     }
 
+    // The liveness before the syms to restore are added, for ProcessBailOutObjectLiterals
+    BVSparse<JitArenaAllocator> * liveBeforeBailOut =
+        this->DoScalarReplacement() ? block->upwardExposedUses->CopyNew(this->tempAlloc) : nullptr;
+
     // Process Argument object first, as they can be found on the stack and don't need to rely on copy prop
     this->ProcessBailOutArgObj(bailOutInfo, byteCodeUpwardExposedUsed);
 
@@ -2873,9 +2885,21 @@ BackwardPass::ProcessBailOutInfo(IR::Instr * instr, BailOutInfo * bailOutInfo)
         });
     }
 
+    // Object literals that the bailout path can allocate again don't need to stay live
+    BVSparse<JitArenaAllocator> * materializedSyms = this->ProcessBailOutObjectLiterals(instr, bailOutInfo, byteCodeUpwardExposedUsed, liveBeforeBailOut);
+    if (liveBeforeBailOut)
+    {
+        JitAdelete(this->tempAlloc, liveBeforeBailOut);
+    }
+
     // Mark all the register that we need to restore as used (excluding constants)
     block->upwardExposedUses->Or(byteCodeUpwardExposedUsed);
     block->upwardExposedUses->Or(bailoutReferencedArgSymsBv);
+    if (materializedSyms)
+    {
+        block->upwardExposedUses->Minus(materializedSyms);
+        JitAdelete(this->tempAlloc, materializedSyms);
+    }
 
     if (!this->IsPrePass())
     {
@@ -5203,7 +5227,7 @@ BackwardPass::UpdateArrayBailOutKind(IR::Instr *const instr)
     Assert(instr->HasBailOutInfo());
 
     if ((instr->m_opcode != Js::OpCode::StElemI_A && instr->m_opcode != Js::OpCode::StElemI_A_Strict &&
-        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset) ||
+        instr->m_opcode != Js::OpCode::Memcopy && instr->m_opcode != Js::OpCode::Memset && instr->m_opcode != Js::OpCode::Memarith) ||
         !instr->GetDst()->IsIndirOpnd())
     {
         return;
@@ -7810,6 +7834,23 @@ BackwardPass::ProcessDef(IR::Opnd * opnd)
     if (sym->IsPropertySym())
     {
         PropertySym *propertySym = sym->AsPropertySym();
+        if (this->IsDeadObjectLiteralInitFld(instr, propertySym))
+        {
+            // Nothing reads the object past this point, so the field doesn't need to be stored, and the store
+            // doesn't keep the object alive. Once its last InitFld is gone, the allocation is a dead store too.
+            block->upwardExposedFields->Clear(propertySym->m_id);
+            if (this->IsPrePass())
+            {
+                return false;
+            }
+
+            PHASE_PRINT_TRACE(Js::ScalarReplacementPhase, this->func,
+                _u("ScalarReplacement: function %s: removed an InitFld of a dead object literal\n"),
+                instr->m_func->GetJITFunctionBody()->GetDisplayName());
+            DeadStoreInstr(instr);
+            return true;
+        }
+
         ProcessStackSymUse(propertySym->m_stackSym, isJITOptimizedReg);
 
         if (IsCollectionPass())
@@ -7939,7 +7980,8 @@ BackwardPass::ProcessDef(IR::Opnd * opnd)
         && instr->m_opcode != Js::OpCode::StFld
         && instr->m_opcode != Js::OpCode::StRootFld
         && instr->m_opcode != Js::OpCode::StFldStrict
-        && instr->m_opcode != Js::OpCode::StRootFldStrict;
+        && instr->m_opcode != Js::OpCode::StRootFldStrict
+        && !this->IsObjectLiteralAllocation(instr);
 
     if (this->IsPrePass() || hasSideEffects)
     {
@@ -7981,6 +8023,13 @@ BackwardPass::ProcessDef(IR::Opnd * opnd)
         }
     }
 
+    if (this->IsObjectLiteralAllocation(instr))
+    {
+        PHASE_PRINT_TRACE(Js::ScalarReplacementPhase, this->func,
+            _u("ScalarReplacement: function %s: removed a dead object literal allocation\n"),
+            instr->m_func->GetJITFunctionBody()->GetDisplayName());
+    }
+
     // Dead store
     DeadStoreInstr(instr);
     return true;
@@ -8066,6 +8115,218 @@ BackwardPass::DeadStoreInstr(IR::Instr *instr)
     return true;
 }
 
+//
+// Scalar replacement of object literals: glob opt copy-props loads of a literal's fields from the values its
+// InitFlds stored, so a literal that is only read through its fields ends up with no uses but its own InitFlds.
+// An InitFld defines a data property on an object nobody else can see yet (no setters, no implicit calls), so
+// once the object is dead it doesn't need to be done, and the InitFld isn't a use that keeps the object alive.
+//
+// A removed InitFld is still a byte code use of the object, so a bailout after the allocation needs the object
+// for the interpreter. ProcessBailOutObjectLiterals lets the bailout path allocate it again where it can, so that
+// the bailout doesn't keep the object and its InitFlds alive.
+//
+bool
+BackwardPass::IsDeadObjectLiteralInitFld(IR::Instr *instr, PropertySym *propertySym) const
+{
+    if (instr->m_opcode != Js::OpCode::InitFld || instr->HasBailOutInfo() || IsCollectionPass() || !this->DoScalarReplacement())
+    {
+        return false;
+    }
+
+    // Only the literal's own InitFlds are known to come before anything could copy the object to another sym.
+    StackSym *objSym = propertySym->m_stackSym;
+    IR::Instr *instrDef = objSym->GetInstrDef();
+    if (instrDef == nullptr || instrDef->m_opcode != Js::OpCode::NewScObjectLiteral)
+    {
+        return false;
+    }
+
+    return !this->currentBlock->upwardExposedUses->Test(objSym->m_id);
+}
+
+//
+// A bailout that needs an object literal, when nothing else does, would keep the allocation and the InitFlds before
+// the bailout alive. If the literal is allocated in the bailout's block, and in between nothing but its own InitFlds
+// and copies that are dead by the bailout touch it, the bailout path allocates the object again and replays those
+// InitFlds. The syms holding the stored values stay live to the bailout instead, so they must not be overwritten in
+// between. Returns the syms of the literals that are materialized, which the caller leaves out of the upward exposed
+// uses. liveBeforeBailOut is the liveness before the syms this bailout restores were added.
+//
+BVSparse<JitArenaAllocator> *
+BackwardPass::ProcessBailOutObjectLiterals(IR::Instr *instr, BailOutInfo *bailOutInfo, BVSparse<JitArenaAllocator> *byteCodeUpwardExposedUsed, BVSparse<JitArenaAllocator> *liveBeforeBailOut)
+{
+    if (liveBeforeBailOut == nullptr ||
+        instr->IsBranchInstr() ||
+        instr->HasLazyBailOut() ||
+        instr->m_opcode == Js::OpCode::BailOnException ||
+        bailOutInfo->isLoopTopBailOutInfo ||
+        bailOutInfo->bailInInstr != nullptr ||
+        this->func->GetJITFunctionBody()->IsCoroutine())
+    {
+        return nullptr;
+    }
+
+    // The syms the bailout restores byte code registers from, directly or as copy-prop syms
+    BVSparse<JitArenaAllocator> * restoredSyms = byteCodeUpwardExposedUsed->CopyNew(this->tempAlloc);
+    FOREACH_SLISTBASE_ENTRY(CopyPropSyms, copyPropSyms, &bailOutInfo->usedCapturedValues->copyPropSyms)
+    {
+        restoredSyms->Set(copyPropSyms.Value()->m_id);
+    }
+    NEXT_SLISTBASE_ENTRY;
+
+    // Restored syms that nothing else reads are rare: normally only objects whose loads glob opt copy-propped
+    BVSparse<JitArenaAllocator> * candidateSyms = restoredSyms->MinusNew(liveBeforeBailOut, this->tempAlloc);
+    BVSparse<JitArenaAllocator> * materializedSyms = nullptr;
+    BVSparse<JitArenaAllocator> * valueSyms = JitAnew(this->tempAlloc, BVSparse<JitArenaAllocator>, this->tempAlloc);
+    BVSparse<JitArenaAllocator> * aliasSyms = JitAnew(this->tempAlloc, BVSparse<JitArenaAllocator>, this->tempAlloc);
+
+    FOREACH_BITSET_IN_SPARSEBV(symId, candidateSyms)
+    {
+        StackSym * objSym = this->func->m_symTable->FindStackSym(symId);
+        if (objSym == nullptr || objSym->IsTypeSpec() || !objSym->m_isSingleDef)
+        {
+            continue;
+        }
+
+        bool isStackLiteral = false;
+        for (uint i = 0; i < bailOutInfo->stackLiteralBailOutInfoCount; i++)
+        {
+            isStackLiteral = isStackLiteral || bailOutInfo->stackLiteralBailOutInfo[i].stackSym == objSym;
+        }
+        if (isStackLiteral)
+        {
+            continue;
+        }
+
+        // Find the allocation in this block
+        IR::Instr * allocInstr = instr->m_prev;
+        while (allocInstr != nullptr && !allocInstr->StartsBasicBlock() &&
+            !(allocInstr->GetDst() && allocInstr->GetDst()->IsRegOpnd() && allocInstr->GetDst()->AsRegOpnd()->m_sym == objSym))
+        {
+            allocInstr = allocInstr->m_prev;
+        }
+        if (allocInstr == nullptr || allocInstr->m_opcode != Js::OpCode::NewScObjectLiteral || allocInstr->HasBailOutInfo())
+        {
+            continue;
+        }
+
+        // Check everything between the allocation and the bailout. Copies of the object (Ld_A) are fine as long as
+        // they are dead by the bailout, which doesn't restore anything from them.
+        valueSyms->ClearAll();
+        aliasSyms->ClearAll();
+        aliasSyms->Set(symId);
+        bool canMaterialize = true;
+        for (IR::Instr * nextInstr = allocInstr->m_next; canMaterialize; nextInstr = nextInstr->m_next)
+        {
+            if (nextInstr->IsByteCodeUsesInstr())
+            {
+                continue;
+            }
+
+            FOREACH_BITSET_IN_SPARSEBV(aliasSymId, aliasSyms)
+            {
+                StackSym * aliasSym = this->func->m_symTable->FindStackSym(aliasSymId);
+                canMaterialize = canMaterialize &&
+                    (!nextInstr->HasSymUse(aliasSym) ||
+                        (nextInstr != instr &&
+                            (IsObjectLiteralInitFld(nextInstr, objSym) ||
+                                (nextInstr->m_opcode == Js::OpCode::Ld_A && nextInstr->GetSrc1()->IsRegOpnd()))));
+            }
+            NEXT_BITSET_IN_SPARSEBV;
+
+            IR::Opnd * dst = nextInstr->GetDst();
+            StackSym * dstSym = dst && dst->IsRegOpnd() ? dst->AsRegOpnd()->m_sym : nullptr;
+            if (dstSym != nullptr && (valueSyms->Test(dstSym->m_id) || aliasSyms->Test(dstSym->m_id)))
+            {
+                // A stored value or a copy of the object is overwritten before the bailout. For a pre-op bailout, the
+                // lowerer may also move the bailout instruction's dst def ahead of the check.
+                canMaterialize = false;
+            }
+            if (nextInstr == instr || !canMaterialize)
+            {
+                break;
+            }
+
+            if (IsObjectLiteralInitFld(nextInstr, objSym))
+            {
+                IR::Opnd * src = nextInstr->GetSrc1();
+                if (src->IsRegOpnd() && src->GetType() == TyVar && !src->AsRegOpnd()->m_sym->IsTypeSpec())
+                {
+                    valueSyms->Set(src->AsRegOpnd()->m_sym->m_id);
+                }
+                else
+                {
+                    canMaterialize = src->IsAddrOpnd();
+                }
+                canMaterialize = canMaterialize && !nextInstr->HasBailOutInfo();
+            }
+            else if (nextInstr->m_opcode == Js::OpCode::Ld_A && nextInstr->GetSrc1()->IsRegOpnd() &&
+                aliasSyms->Test(nextInstr->GetSrc1()->AsRegOpnd()->m_sym->m_id))
+            {
+                canMaterialize = dstSym != nullptr && !liveBeforeBailOut->Test(dstSym->m_id) && !restoredSyms->Test(dstSym->m_id);
+                if (canMaterialize)
+                {
+                    aliasSyms->Set(dstSym->m_id);
+                }
+            }
+        }
+
+        if (!canMaterialize)
+        {
+            continue;
+        }
+
+        if (!this->IsPrePass())
+        {
+            // Walking backward leaves the allocation first in the list, followed by its InitFlds in order
+            uint fieldCount = 0;
+            for (IR::Instr * prevInstr = instr->m_prev; prevInstr != allocInstr; prevInstr = prevInstr->m_prev)
+            {
+                if (IsObjectLiteralInitFld(prevInstr, objSym))
+                {
+                    bailOutInfo->materializedObjectLiteralInstrs.Prepend(this->func->m_alloc, prevInstr->Copy());
+                    fieldCount++;
+                }
+            }
+            bailOutInfo->materializedObjectLiteralInstrs.Prepend(this->func->m_alloc, allocInstr->Copy());
+
+            PHASE_PRINT_TRACE(Js::ScalarReplacementPhase, this->func,
+                _u("ScalarReplacement: function %s: materializing an object literal with %u of its fields at a bailout\n"),
+                allocInstr->m_func->GetJITFunctionBody()->GetDisplayName(), fieldCount);
+        }
+
+        this->currentBlock->upwardExposedUses->Or(valueSyms);
+        if (materializedSyms == nullptr)
+        {
+            materializedSyms = JitAnew(this->tempAlloc, BVSparse<JitArenaAllocator>, this->tempAlloc);
+        }
+        materializedSyms->Set(symId);
+    }
+    NEXT_BITSET_IN_SPARSEBV;
+
+    JitAdelete(this->tempAlloc, aliasSyms);
+    JitAdelete(this->tempAlloc, valueSyms);
+    JitAdelete(this->tempAlloc, candidateSyms);
+    JitAdelete(this->tempAlloc, restoredSyms);
+    return materializedSyms;
+}
+
+bool
+BackwardPass::IsObjectLiteralInitFld(IR::Instr *instr, StackSym *objSym)
+{
+    IR::Opnd * dst = instr->GetDst();
+    return instr->m_opcode == Js::OpCode::InitFld && dst->IsSymOpnd() && dst->AsSymOpnd()->m_sym->IsPropertySym()
+        && dst->AsSymOpnd()->m_sym->AsPropertySym()->m_stackSym == objSym;
+}
+
+bool
+BackwardPass::IsObjectLiteralAllocation(IR::Instr *instr) const
+{
+    // Allocating an object literal has no side effect beyond caching the literal's type
+    return (instr->m_opcode == Js::OpCode::NewScObjectLiteral || instr->m_opcode == Js::OpCode::NewScObjectSimple)
+        && this->DoScalarReplacement();
+}
+
 void
 BackwardPass::ProcessTransfers(IR::Instr * instr)
 {
@@ -68,6 +68,10 @@ class BackwardPass
     void RestoreInductionVariableValuesAfterMemOp(Loop *loop);
     bool DoDeadStoreLdStForMemop(IR::Instr *instr);
     bool DeadStoreInstr(IR::Instr *instr);
+    bool IsDeadObjectLiteralInitFld(IR::Instr *instr, PropertySym *propertySym) const;
+    bool IsObjectLiteralAllocation(IR::Instr *instr) const;
+    static bool IsObjectLiteralInitFld(IR::Instr *instr, StackSym *objSym);
+    BVSparse<JitArenaAllocator> * ProcessBailOutObjectLiterals(IR::Instr *instr, BailOutInfo *bailOutInfo, BVSparse<JitArenaAllocator> *byteCodeUpwardExposedUsed, BVSparse<JitArenaAllocator> *liveBeforeBailOut);
 
     void CollectCloneStrCandidate(IR::Opnd *opnd);
     void InvalidateCloneStrCandidate(IR::Opnd *opnd);
@@ -130,6 +134,7 @@ class BackwardPass
     static bool DoDeadStore(Func* func);
     bool DoDeadStore() const;
     bool DoDeadStoreSlots() const;
+    bool DoScalarReplacement() const;
     bool DoTrackNegativeZero() const;
     bool DoTrackBitOpsOrNumber()const;
     bool DoTrackIntOverflow() const;
@@ -125,6 +125,7 @@ BailOutInfo::Clear(JitArenaAllocator * allocator)
     {
         JitAdelete(allocator, byteCodeUpwardExposedUsed);
     }
+    this->materializedObjectLiteralInstrs.Clear(allocator);
     if (startCallInfo)
     {
         Assert(argOutSyms);
@@ -136,6 +136,10 @@ class BailOutInfo
     uint stackLiteralBailOutInfoCount;
     StackLiteralBailOutInfo * stackLiteralBailOutInfo;
 
+    // Object literals removed by scalar replacement that the interpreter still reads after the bailout. The bailout
+    // path allocates each of them again: a NewScObjectLiteral followed by the InitFlds that ran before the bailout.
+    SListBase<IR::Instr *> materializedObjectLiteralInstrs;
+
     BVSparse<JitArenaAllocator> * liveVarSyms;
     BVSparse<JitArenaAllocator> * liveLosslessInt32Syms;                // These are only the live int32 syms that fully represent the var-equivalent sym's value (see GlobOpt::FillBailOutInfo)
     BVSparse<JitArenaAllocator> * liveFloat64Syms;
@@ -54,6 +54,14 @@ bool CodeGenWorkItem::ShouldSpeculativelyJit(uint byteCodeSizeGenerated) const
         return false;
     }
 
+#if ENABLE_TIER_UP_CACHE
+    // Got to the full JIT in an earlier run; there is no need to profile it again
+    if(this->ShouldSpeculativelyJitBasedOnTierUpCache())
+    {
+        return true;
+    }
+#endif
+
     byteCodeSizeGenerated += this->GetByteCodeCount();
     if(CONFIG_FLAG(ProfileBasedSpeculativeJit))
     {
@@ -103,6 +111,22 @@ bool CodeGenWorkItem::ShouldSpeculativelyJitBasedOnProfile() const
     return false;
 }
 
+#if ENABLE_TIER_UP_CACHE
+bool CodeGenWorkItem::ShouldSpeculativelyJitBasedOnTierUpCache() const
+{
+    Js::FunctionBody* functionBody = this->GetFunctionBody();
+    Js::SourceDynamicProfileManager* profileManager = functionBody->GetSourceContextInfo()->sourceDynamicProfileManager;
+    if(profileManager == nullptr || !functionBody->HasDynamicProfileInfo() ||
+        !profileManager->IsFunctionTierUpCached(functionBody->GetLocalFunctionId()))
+    {
+        return false;
+    }
+
+    functionBody->SetIsSpeculativeJitCandidate();
+    return true;
+}
+#endif
+
 /*
     A comment about how to cause certain phases to only be on:
 
@@ -168,6 +168,9 @@ struct CodeGenWorkItem : public JsUtil::Job
     bool ShouldSpeculativelyJit(uint byteCodeSizeGenerated) const;
 private:
     bool ShouldSpeculativelyJitBasedOnProfile() const;
+#if ENABLE_TIER_UP_CACHE
+    bool ShouldSpeculativelyJitBasedOnTierUpCache() const;
+#endif
 
 public:
     bool IsInJitQueue() const
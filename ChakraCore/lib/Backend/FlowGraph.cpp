@@ -170,6 +170,10 @@ FlowGraph::Build(void)
     this->RunPeeps();
     END_CODEGEN_PHASE(func, Js::FGPeepsPhase);
 
+    BEGIN_CODEGEN_PHASE(func, Js::LoopUnrollPhase);
+    this->UnrollLoops();
+    END_CODEGEN_PHASE(func, Js::LoopUnrollPhase);
+
     bool assignRegionsBeforeGlobopt = this->func->HasTry() && (this->func->DoOptimizeTry() ||
         (this->func->IsSimpleJit() && this->func->hasBailout) ||
         this->func->IsLoopBodyInTryFinally());
@@ -953,6 +957,209 @@ FlowGraph::RunPeeps()
    } NEXT_INSTR_IN_FUNC_EDITING;
 }
 
+///----------------------------------------------------------------------------
+///
+/// FlowGraph::UnrollLoops
+///
+///     Unroll the innermost loops that the interpreter saw run at least
+///     -MinLoopUnrollCount iterations. The body of such a loop is repeated
+///     -LoopUnrollFactor times before its back edge. Every copy keeps the exit
+///     tests of the body, so when the trip count is not a multiple of the
+///     factor the loop simply leaves from the copy it ends in, and no separate
+///     remainder loop is needed.
+///
+///----------------------------------------------------------------------------
+void
+FlowGraph::UnrollLoops()
+{
+    const uint factor = CONFIG_FLAG(LoopUnrollFactor);
+    if (factor < 2 || PHASE_OFF(Js::LoopUnrollPhase, this->func) || !this->func->DoGlobOpt())
+    {
+        return;
+    }
+
+    if (this->func->HasTry() || this->func->IsJitInDebugMode() || !this->func->HasProfileInfo() ||
+        this->func->GetJITFunctionBody()->IsAsmJsMode())
+    {
+        return;
+    }
+
+    NoRecoverMemoryJitArenaAllocator tempAlloc(_u("BE-LoopUnroll"), this->func->m_alloc->GetPageAllocator(), Js::Throw::OutOfMemory);
+
+    FOREACH_INSTR_IN_FUNC_EDITING(instr, instrNext, this->func)
+    {
+        if (!instr->IsLabelInstr() || !instr->AsLabelInstr()->m_isLoopTop)
+        {
+            continue;
+        }
+
+        IR::LabelInstr * loopTop = instr->AsLabelInstr();
+        IR::BranchInstr * backEdge = this->FindUnrollableLoopBackEdge(loopTop, &tempAlloc);
+        if (backEdge)
+        {
+            this->UnrollLoop(loopTop, backEdge, factor, &tempAlloc);
+            instrNext = backEdge->m_next;
+        }
+    } NEXT_INSTR_IN_FUNC_EDITING;
+}
+
+// Returns the back edge of the loop starting at loopTop if the loop should be unrolled, nullptr otherwise.
+// The body must run straight from the loop top to a single unconditional back edge, and must not contain
+// inner loops, calls, inlined code or instructions that already carry bailout info.
+IR::BranchInstr *
+FlowGraph::FindUnrollableLoopBackEdge(IR::LabelInstr * loopTop, JitArenaAllocator * tempAlloc)
+{
+    if (!loopTop->IsProfiledLabelInstr() || loopTop->GetByteCodeOffset() == Js::Constants::NoByteCodeOffset)
+    {
+        return nullptr;
+    }
+
+    const Js::LoopFlags loopFlags = loopTop->AsProfiledLabelInstr()->loopFlags;
+    if (!loopFlags.isInterpreted || !loopFlags.unrollMinCountReached)
+    {
+        return nullptr;
+    }
+
+    const uint maxSize = CONFIG_FLAG(MaxLoopUnrollSize);
+    const bool doMemOp = !PHASE_OFF(Js::MemOpPhase, this->func);
+    BVSparse<JitArenaAllocator> bodyLabels(tempAlloc);
+    uint bodyLabelRefCount = 0;
+    uint size = 0;
+    IR::BranchInstr * backEdge = nullptr;
+
+    for (IR::Instr * instr = loopTop->m_next; backEdge == nullptr; instr = instr->m_next)
+    {
+        if (instr == nullptr || instr->m_func != this->func || instr->HasBailOutInfo() || instr->HasAuxBailOut() || instr->IsJitProfilingInstr())
+        {
+            return nullptr;
+        }
+
+        if (instr->IsLabelInstr())
+        {
+            IR::LabelInstr * labelInstr = instr->AsLabelInstr();
+            if (labelInstr->m_isLoopTop || labelInstr->m_hasNonBranchRef)
+            {
+                return nullptr;
+            }
+            bodyLabels.Set(labelInstr->m_id);
+            bodyLabelRefCount += labelInstr->labelRefs.Count();
+            continue;
+        }
+
+        if (!instr->IsRealInstr())
+        {
+            continue;
+        }
+
+        if (++size > maxSize || OpCodeAttr::CallInstr(instr->m_opcode))
+        {
+            return nullptr;
+        }
+
+        switch (instr->m_opcode)
+        {
+        case Js::OpCode::Yield:
+            return nullptr;
+
+        case Js::OpCode::StElemI_A:
+        case Js::OpCode::StElemI_A_Strict:
+            // MemOp replaces loops that store to arrays, and needs the index to change by one per iteration
+            if (doMemOp)
+            {
+                return nullptr;
+            }
+            break;
+        }
+
+        if (instr->IsBranchInstr())
+        {
+            IR::BranchInstr * branchInstr = instr->AsBranchInstr();
+            if (branchInstr->IsMultiBranch())
+            {
+                return nullptr;
+            }
+            if (branchInstr->GetTarget() == loopTop)
+            {
+                if (!branchInstr->IsUnconditional())
+                {
+                    return nullptr;
+                }
+                backEdge = branchInstr;
+            }
+        }
+    }
+
+    if (backEdge == loopTop->m_next)
+    {
+        return nullptr;
+    }
+
+    // Labels in the body may only be reached from within the body, and the loop top only from before the loop
+    // and from the back edge: other entries and back edges (continue) would have to be redirected to every copy.
+    uint bodyBranchRefCount = 0;
+    FOREACH_INSTR_IN_RANGE(instr, loopTop->m_next, backEdge->m_prev)
+    {
+        if (instr->IsBranchInstr() && bodyLabels.Test(instr->AsBranchInstr()->GetTarget()->m_id))
+        {
+            bodyBranchRefCount++;
+        }
+    }
+    NEXT_INSTR_IN_RANGE;
+
+    if (bodyBranchRefCount != bodyLabelRefCount)
+    {
+        return nullptr;
+    }
+
+    FOREACH_SLISTCOUNTED_ENTRY(IR::BranchInstr *, branchInstr, &loopTop->labelRefs)
+    {
+        if (branchInstr != backEdge &&
+            (branchInstr->GetByteCodeOffset() == Js::Constants::NoByteCodeOffset || branchInstr->GetByteCodeOffset() >= loopTop->GetByteCodeOffset()))
+        {
+            return nullptr;
+        }
+    }
+    NEXT_SLISTCOUNTED_ENTRY;
+
+    return backEdge;
+}
+
+// Repeat the body of the loop (factor - 1) more times before its back edge. Each copy gets its own labels and
+// argument syms; all other syms are shared with the original body, and the copies keep the byte code offsets of
+// the instructions they come from. A bailout that GlobOpt adds in any copy therefore resumes the interpreter at
+// the right instruction of the body, with the values of the same locals.
+void
+FlowGraph::UnrollLoop(IR::LabelInstr * loopTop, IR::BranchInstr * backEdge, uint factor, JitArenaAllocator * tempAlloc)
+{
+    IR::Instr * bodyFirst = loopTop->m_next;
+    IR::Instr * bodyLast = backEdge->m_prev;
+
+    for (uint copy = 1; copy < factor; copy++)
+    {
+        // The copies go after bodyLast, so stop at bodyLast rather than at its (moving) next instr
+        this->func->BeginClone(nullptr, tempAlloc);
+        for (IR::Instr * instr = bodyFirst;; instr = instr->m_next)
+        {
+            IR::Instr * instrClone = instr->Clone();
+            if (instr->IsPragmaInstr())
+            {
+                instrClone->AsPragmaInstr()->m_statementIndex = instr->AsPragmaInstr()->m_statementIndex;
+            }
+            backEdge->InsertBefore(instrClone);
+
+            if (instr == bodyLast)
+            {
+                break;
+            }
+        }
+        this->func->EndClone();
+    }
+    this->func->ClearCloneMap();
+
+    PHASE_PRINT_TRACE(Js::LoopUnrollPhase, this->func, _u("LoopUnroll: function %s: repeated the body of a loop %u times\n"),
+        this->func->GetJITFunctionBody()->GetDisplayName(), factor);
+}
+
 void
 Loop::InsertLandingPad(FlowGraph *fg)
 {
@@ -1334,6 +1541,12 @@ Loop::MemSetCandidate* Loop::MemOpCandidate::AsMemSet()
     return (Loop::MemSetCandidate*)this;
 }
 
+Loop::MemArithCandidate* Loop::MemOpCandidate::AsMemArith()
+{
+    Assert(this->IsMemArith());
+    return (Loop::MemArithCandidate*)this;
+}
+
 void
 Loop::EnsureMemOpVariablesInitialized()
 {
@@ -153,6 +153,9 @@ class FlowGraph
     void Destroy(void);
 
     void         RunPeeps();
+    void         UnrollLoops();
+    IR::BranchInstr * FindUnrollableLoopBackEdge(IR::LabelInstr * loopTop, JitArenaAllocator * tempAlloc);
+    void         UnrollLoop(IR::LabelInstr * loopTop, IR::BranchInstr * backEdge, uint factor, JitArenaAllocator * tempAlloc);
     BasicBlock * AddBlock(IR::Instr * firstInstr, IR::Instr * lastInstr, BasicBlock * nextBlock, BasicBlock *prevBlock = nullptr);
     FlowEdge *   AddEdge(BasicBlock * predBlock, BasicBlock * succBlock);
     BasicBlock * InsertCompensationCodeForBlockMove(FlowEdge * edge, // Edge where compensation code needs to be inserted
@@ -632,6 +635,7 @@ class Loop
                                          // For example, in the lowerer, it'll be set to true when we process the loopTop for a certain loop
     struct MemCopyCandidate;
     struct MemSetCandidate;
+    struct MemArithCandidate;
     struct MemOpCandidate
     {
         SymID base;
@@ -641,12 +645,15 @@ class Loop
         enum MemOpType
         {
             MEMSET,
-            MEMCOPY
+            MEMCOPY,
+            MEMARITH
         } type;
         bool IsMemSet() const { return type == MEMSET; }
         bool IsMemCopy() const { return type == MEMCOPY; }
+        bool IsMemArith() const { return type == MEMARITH; }
         struct Loop::MemCopyCandidate* AsMemCopy();
         struct Loop::MemSetCandidate* AsMemSet();
+        struct Loop::MemArithCandidate* AsMemArith();
         MemOpCandidate(MemOpType type) :
             type(type)
         {
@@ -669,6 +676,18 @@ class Loop
         MemCopyCandidate() : MemOpCandidate(MemOpCandidate::MEMCOPY) {}
     };
 
+    // a[i] = b[i] op c[i] or a[i] = b[i] op invariant, on typed arrays of the same type
+    struct MemArithCandidate : public MemOpCandidate
+    {
+        SymID ldBase;
+        SymID ldBase2;              // InvalidSymID if the second operand is invariant
+        StackSym* transferSym;      // Result of the arithmetic, stored by the StElemI
+        StackSym* srcSym;           // Invariant second operand, if it isn't a constant
+        BailoutConstantValue constant;
+        Js::OpCode opcode;
+        MemArithCandidate() : MemOpCandidate(MemOpCandidate::MEMARITH), srcSym(nullptr) {}
+    };
+
 #define FOREACH_MEMOP_CANDIDATES_EDITING(data, loop, iterator) FOREACH_SLISTCOUNTED_ENTRY_EDITING(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates, iterator)
 #define NEXT_MEMOP_CANDIDATE_EDITING NEXT_SLISTCOUNTED_ENTRY_EDITING
 #define FOREACH_MEMOP_CANDIDATES(data, loop) FOREACH_SLISTCOUNTED_ENTRY(Loop::MemOpCandidate*, data, loop->memOpInfo->candidates)
@@ -721,6 +740,7 @@ class Loop
         uint32                      loopStart;              // loopTopLabel->GetNumber()
         uint32                      loopEnd;                // loopTailBranch->GetNumber()
         uint32                      helperLength;           // Number of instrs in helper code in loop
+        uint32                      helperLengthAtStart;    // Number of instrs in helper code before the loop top
         SList<Lifetime *>        *  extendedLifetime;       // Lifetimes to extend for this loop
         SList<Lifetime **>       *  exitRegContentList;     // Linked list of regContents for the exit edges
         bool                        hasNonOpHelperCall;
@@ -808,6 +828,13 @@ struct MemCopyEmitData : public MemOpEmitData
     IR::Instr* ldElemInstr;
 };
 
+struct MemArithEmitData : public MemOpEmitData
+{
+    IR::Instr* arithInstr;
+    IR::Instr* ldElemInstr;
+    IR::Instr* ldElemInstr2;
+};
+
 #define FOREACH_BLOCK_IN_FUNC(block, func)\
     FOREACH_BLOCK(block, func->m_fg)
 #define NEXT_BLOCK_IN_FUNC\
@@ -8,7 +8,8 @@
 #if DBG_DUMP
 #define DO_MEMOP_TRACE() (PHASE_TRACE(Js::MemOpPhase, this->func) ||\
         PHASE_TRACE(Js::MemSetPhase, this->func) ||\
-        PHASE_TRACE(Js::MemCopyPhase, this->func))
+        PHASE_TRACE(Js::MemCopyPhase, this->func) ||\
+        PHASE_TRACE(Js::MemArithPhase, this->func))
 #define DO_MEMOP_TRACE_PHASE(phase) (PHASE_TRACE(Js::MemOpPhase, this->func) || PHASE_TRACE(Js::phase ## Phase, this->func))
 
 #define OUTPUT_MEMOP_TRACE(loop, instr, ...) {\
@@ -2135,6 +2136,250 @@ bool GlobOpt::CollectMemcopyStElementI(IR::Instr *instr, Loop *loop)
     return true;
 }
 
+bool
+GlobOpt::CollectMemarithStElementI(IR::Instr *instr, Loop *loop)
+{
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        return false;
+    }
+
+    Loop::MemOpCandidate* previousCandidate = loop->memOpInfo->candidates->Head();
+    if (!previousCandidate->IsMemArith())
+    {
+        return false;
+    }
+    Loop::MemArithCandidate* memarithInfo = previousCandidate->AsMemArith();
+
+    Assert(instr->GetDst()->IsIndirOpnd());
+    IR::IndirOpnd *dst = instr->GetDst()->AsIndirOpnd();
+    IR::Opnd *indexOp = dst->GetIndexOpnd();
+    IR::RegOpnd *baseOp = dst->GetBaseOpnd()->AsRegOpnd();
+    SymID baseSymID = GetVarSymID(baseOp->GetStackSym());
+
+    // The stored value has to be the result of the arithmetic, and this must be its last use
+    if (
+        memarithInfo->base != Js::Constants::InvalidSymID ||
+        !instr->GetSrc1()->IsRegOpnd() ||
+        instr->GetSrc1()->AsRegOpnd()->GetStackSym() != memarithInfo->transferSym ||
+        !instr->GetSrc1()->AsRegOpnd()->GetIsDead()
+    )
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("No matching arithmetic found (s%d)"), baseSymID);
+        return false;
+    }
+
+    if (!IsAllowedForMemOpt(instr, false, baseOp, indexOp))
+    {
+        return false;
+    }
+
+    // Only the element types the helper computes in their own precision (see JavascriptOperators::OP_Memarith)
+    bool isFloatArray;
+    switch (baseOp->GetValueType().GetObjectType())
+    {
+    case ObjectType::Int32Array:
+    case ObjectType::Int32VirtualArray:
+    case ObjectType::Int32MixedArray:
+        isFloatArray = false;
+        break;
+    case ObjectType::Float32Array:
+    case ObjectType::Float32VirtualArray:
+    case ObjectType::Float32MixedArray:
+    case ObjectType::Float64Array:
+    case ObjectType::Float64VirtualArray:
+    case ObjectType::Float64MixedArray:
+        isFloatArray = true;
+        break;
+    default:
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Unsupported array type (s%d)"), baseSymID);
+        return false;
+    }
+    if (isFloatArray ? !memarithInfo->transferSym->IsFloat64() : !memarithInfo->transferSym->IsInt32())
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Result type does not match the array (s%d)"), baseSymID);
+        return false;
+    }
+
+    Assert(indexOp->GetStackSym());
+    SymID inductionSymID = GetVarSymID(indexOp->GetStackSym());
+    Assert(IsSymIDInductionVariable(inductionSymID, loop));
+    bool isIndexPreIncr = loop->memOpInfo->inductionVariableChangeInfoMap->ContainsKey(inductionSymID);
+    if (isIndexPreIncr != memarithInfo->bIndexAlreadyChanged)
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Index value changed between ldElem and stElem"));
+        return false;
+    }
+
+    memarithInfo->count++;
+    AssertOrFailFast(memarithInfo->count <= 1);
+    memarithInfo->base = baseSymID;
+
+    return true;
+}
+
+bool
+GlobOpt::CollectMemarithInstr(IR::Instr *instrBegin, IR::Instr *instr, Loop *loop, Value *src1Val, Value *src2Val)
+{
+    // Matches the arithmetic of a[i] = b[i] op c[i] and a[i] = b[i] op invariant, where the loads are the
+    // pending memcopy candidates at the head of the list. They are replaced by a memarith candidate that
+    // the StElemI then completes.
+    if (!loop->memOpInfo || loop->memOpInfo->candidates->Empty())
+    {
+        return false;
+    }
+
+    Js::OpCode opcode;
+    IRType type;
+    switch (instr->m_opcode)
+    {
+    case Js::OpCode::Add_I4:
+        // Int32 results wrap when they are stored, so overflow doesn't matter here
+        opcode = Js::OpCode::Add_A;
+        type = TyInt32;
+        break;
+    case Js::OpCode::Sub_I4:
+        opcode = Js::OpCode::Sub_A;
+        type = TyInt32;
+        break;
+    case Js::OpCode::Add_A:
+    case Js::OpCode::Sub_A:
+    case Js::OpCode::Mul_A:
+    case Js::OpCode::Div_A:
+        opcode = instr->m_opcode;
+        type = TyFloat64;
+        break;
+    default:
+        return false;
+    }
+
+    IR::Opnd *dst = instr->GetDst();
+    IR::Opnd *src1 = instr->GetSrc1();
+    IR::Opnd *src2 = instr->GetSrc2();
+    if (
+        !dst || !src1 || !src2 ||
+        !dst->IsRegOpnd() ||
+        dst->GetType() != type ||
+        !dst->AsRegOpnd()->GetStackSym()->IsSingleDef()
+    )
+    {
+        return false;
+    }
+
+    // Instructions inserted while optimizing the arithmetic stay in the loop; they must be removable as well
+    for (IR::Instr *chkInstr = instrBegin->m_next; chkInstr != instr; chkInstr = chkInstr->m_next)
+    {
+        if (IsInstrInvalidForMemOp(chkInstr, loop, src1Val, src2Val))
+        {
+            return false;
+        }
+    }
+
+    Loop::MemOpList::Iterator iter(loop->memOpInfo->candidates);
+    iter.Next();
+    Loop::MemOpCandidate* headCandidate = iter.Data();
+    Loop::MemOpCandidate* nextCandidate = iter.Next() ? iter.Data() : nullptr;
+
+    // The operand has to be the value of a load that nothing else used, and this must be its last use
+    auto isPendingLoad = [](Loop::MemOpCandidate* candidate, IR::Opnd* src)
+    {
+        return
+            candidate &&
+            candidate->IsMemCopy() &&
+            candidate->AsMemCopy()->base == Js::Constants::InvalidSymID &&
+            src->IsRegOpnd() &&
+            src->AsRegOpnd()->GetStackSym() == candidate->AsMemCopy()->transferSym &&
+            src->AsRegOpnd()->GetIsDead();
+    };
+
+    Loop::MemCopyCandidate* ldCandidate = nullptr;
+    Loop::MemCopyCandidate* ldCandidate2 = nullptr;
+    IR::Opnd* invariantOpnd = nullptr;
+    if (isPendingLoad(headCandidate, src2) && isPendingLoad(nextCandidate, src1))
+    {
+        ldCandidate = nextCandidate->AsMemCopy();
+        ldCandidate2 = headCandidate->AsMemCopy();
+    }
+    else if (isPendingLoad(headCandidate, src1) && isPendingLoad(nextCandidate, src2))
+    {
+        ldCandidate = headCandidate->AsMemCopy();
+        ldCandidate2 = nextCandidate->AsMemCopy();
+    }
+    else if (isPendingLoad(headCandidate, src1))
+    {
+        ldCandidate = headCandidate->AsMemCopy();
+        invariantOpnd = src2;
+    }
+    else if (isPendingLoad(headCandidate, src2) && (opcode == Js::OpCode::Add_A || opcode == Js::OpCode::Mul_A))
+    {
+        // Commutative, treat it as b[i] op invariant
+        ldCandidate = headCandidate->AsMemCopy();
+        invariantOpnd = src1;
+    }
+    else
+    {
+        return false;
+    }
+
+    StackSym *srcSym = nullptr;
+    BailoutConstantValue constant = {TyIllegal, 0};
+    if (invariantOpnd)
+    {
+        if (invariantOpnd->GetType() != type)
+        {
+            return false;
+        }
+        if (invariantOpnd->IsRegOpnd())
+        {
+            IR::RegOpnd* opnd = invariantOpnd->AsRegOpnd();
+            if (!this->OptIsInvariant(opnd, this->currentBlock, loop, CurrentBlockData()->FindValue(opnd->m_sym), true, true))
+            {
+                TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Operand is not an invariant"));
+                return false;
+            }
+            srcSym = opnd->GetStackSym();
+        }
+        else if (invariantOpnd->IsFloatConstOpnd())
+        {
+            constant.InitFloatConstValue(invariantOpnd->AsFloatConstOpnd()->m_value);
+        }
+        else if (invariantOpnd->IsIntConstOpnd())
+        {
+            constant.InitIntConstValue(invariantOpnd->AsIntConstOpnd()->GetValue(), invariantOpnd->AsIntConstOpnd()->GetType());
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (ldCandidate2 && ldCandidate2->bIndexAlreadyChanged != ldCandidate->bIndexAlreadyChanged)
+    {
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Index value changed between the two ldElem"));
+        return false;
+    }
+
+    Loop::MemArithCandidate* memarithInfo = JitAnewStruct(this->func->GetTopFunc()->m_fg->alloc, Loop::MemArithCandidate);
+    memarithInfo->ldBase = ldCandidate->ldBase;
+    memarithInfo->ldBase2 = ldCandidate2 ? ldCandidate2->ldBase : Js::Constants::InvalidSymID;
+    memarithInfo->count = 0;
+    memarithInfo->bIndexAlreadyChanged = ldCandidate->bIndexAlreadyChanged;
+    memarithInfo->base = Js::Constants::InvalidSymID; // need to find the stElem first
+    memarithInfo->index = ldCandidate->index;
+    memarithInfo->transferSym = dst->AsRegOpnd()->GetStackSym();
+    memarithInfo->srcSym = srcSym;
+    memarithInfo->constant = constant;
+    memarithInfo->opcode = opcode;
+
+    loop->memOpInfo->candidates->RemoveHead();
+    if (ldCandidate2)
+    {
+        loop->memOpInfo->candidates->RemoveHead();
+    }
+    loop->memOpInfo->candidates->Prepend(memarithInfo);
+    return true;
+}
+
 bool
 GlobOpt::CollectMemOpLdElementI(IR::Instr *instr, Loop *loop)
 {
@@ -2148,7 +2393,8 @@ GlobOpt::CollectMemOpStElementI(IR::Instr *instr, Loop *loop)
     Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict);
     Assert(instr->GetSrc1());
     return (!PHASE_OFF(Js::MemSetPhase, this->func) && CollectMemsetStElementI(instr, loop)) ||
-        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop));
+        (!PHASE_OFF(Js::MemCopyPhase, this->func) && CollectMemcopyStElementI(instr, loop)) ||
+        (!PHASE_OFF(Js::MemArithPhase, this->func) && CollectMemarithStElementI(instr, loop));
 }
 
 bool
@@ -2323,6 +2569,15 @@ GlobOpt::CollectMemOpInfo(IR::Instr *instrBegin, IR::Instr *instr, Value *src1Va
         }
         // Fallthrough if not an induction variable
     }
+    case Js::OpCode::Add_A:
+    case Js::OpCode::Sub_A:
+    case Js::OpCode::Mul_A:
+    case Js::OpCode::Div_A:
+        if (!PHASE_OFF(Js::MemArithPhase, this->func) && CollectMemarithInstr(instrBegin, instr, loop, src1Val, src2Val))
+        {
+            break;
+        }
+        // Fallthrough if not the arithmetic of an elementwise kernel
     default:
         FOREACH_INSTR_IN_RANGE(chkInstr, instrBegin->m_next, instr)
         {
@@ -2349,6 +2604,16 @@ GlobOpt::CollectMemOpInfo(IR::Instr *instrBegin, IR::Instr *instr, Value *src1Va
                         }
                     }
                 }
+                else if (prevCandidate->IsMemArith())
+                {
+                    Loop::MemArithCandidate* memarithCandidate = prevCandidate->AsMemArith();
+                    if (memarithCandidate->base == Js::Constants::InvalidSymID && chkInstr->HasSymUse(memarithCandidate->transferSym))
+                    {
+                        loop->doMemOp = false;
+                        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, chkInstr, _u("Found illegal use of arithmetic value(s%d)"), GetVarSymID(memarithCandidate->transferSym));
+                        return false;
+                    }
+                }
             }
         }
         NEXT_INSTR_IN_RANGE;
@@ -17220,11 +17485,16 @@ void
 GlobOpt::RemoveMemOpSrcInstr(IR::Instr* memopInstr, IR::Instr* srcInstr, BasicBlock* block)
 {
     Assert(srcInstr && (srcInstr->m_opcode == Js::OpCode::LdElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict));
-    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset));
+    Assert(memopInstr && (memopInstr->m_opcode == Js::OpCode::Memcopy || memopInstr->m_opcode == Js::OpCode::Memset || memopInstr->m_opcode == Js::OpCode::Memarith));
     Assert(block);
     const bool isDst = srcInstr->m_opcode == Js::OpCode::StElemI_A || srcInstr->m_opcode == Js::OpCode::StElemI_A_Strict;
     IR::RegOpnd* opnd = (isDst ? memopInstr->GetDst() : memopInstr->GetSrc1())->AsIndirOpnd()->GetBaseOpnd();
     IR::ArrayRegOpnd* arrayOpnd = opnd->IsArrayRegOpnd() ? opnd->AsArrayRegOpnd() : nullptr;
+    if (!isDst && arrayOpnd && arrayOpnd->m_sym != srcInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->m_sym)
+    {
+        // The second array of a memarith is not the memop's src1
+        arrayOpnd = nullptr;
+    }
 
     IR::Instr* topInstr = srcInstr;
     if (srcInstr->extractedUpperBoundCheckWithoutHoisting)
@@ -17347,7 +17617,9 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     IR::IndirOpnd* dstOpnd = IR::IndirOpnd::New(baseOpnd, startIndexOpnd, dstType, localFunc);
 
     IR::Opnd *src1;
+    IR::Opnd *src2 = sizeOpnd;
     const bool isMemset = emitData->candidate->IsMemSet();
+    const bool isMemarith = emitData->candidate->IsMemArith();
 
     // Get the source according to the memop type
     if (isMemset)
@@ -17365,6 +17637,56 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
             src1 = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc);
         }
     }
+    else if (isMemarith)
+    {
+        MemArithEmitData* data = (MemArithEmitData*)emitData;
+        const Loop::MemArithCandidate* candidate = data->candidate->AsMemArith();
+        Assert(data->ldElemInstr && data->arithInstr);
+        Assert(data->ldElemInstr->m_opcode == Js::OpCode::LdElemI_A);
+
+        IR::RegOpnd *srcBaseOpnd = nullptr;
+        IR::RegOpnd *srcIndexOpnd = nullptr;
+        IRType srcType;
+        GetMemOpSrcInfo(loop, data->ldElemInstr, srcBaseOpnd, srcIndexOpnd, srcType);
+        Assert(GetVarSymID(srcIndexOpnd->GetStackSym()) == GetVarSymID(indexOpnd->GetStackSym()));
+
+        src1 = IR::IndirOpnd::New(srcBaseOpnd, startIndexOpnd, srcType, localFunc);
+
+        // The second operand is either the other array, which is read at the same indices, or the invariant
+        IR::Opnd *operandOpnd;
+        if (data->ldElemInstr2)
+        {
+            Assert(data->ldElemInstr2->m_opcode == Js::OpCode::LdElemI_A);
+            IR::RegOpnd *src2BaseOpnd = nullptr;
+            IR::RegOpnd *src2IndexOpnd = nullptr;
+            IRType src2Type;
+            GetMemOpSrcInfo(loop, data->ldElemInstr2, src2BaseOpnd, src2IndexOpnd, src2Type);
+            Assert(GetVarSymID(src2IndexOpnd->GetStackSym()) == GetVarSymID(indexOpnd->GetStackSym()));
+
+            IR::RegOpnd *regSrc = IR::RegOpnd::New(src2BaseOpnd->m_sym, TyVar, localFunc);
+            regSrc->SetValueType(src2BaseOpnd->GetValueType());
+            operandOpnd = regSrc;
+        }
+        else if (candidate->srcSym)
+        {
+            IR::RegOpnd* regSrc = IR::RegOpnd::New(candidate->srcSym, candidate->srcSym->GetType(), func);
+            regSrc->SetIsJITOptimizedReg(true);
+            operandOpnd = regSrc;
+        }
+        else
+        {
+            operandOpnd = IR::AddrOpnd::New(candidate->constant.ToVar(localFunc), IR::AddrOpndKindConstantAddress, localFunc);
+        }
+
+        // Memarith needs more than two sources; chain the size, the operand and the operation with ExtendArg_A.
+        IR::Instr *argInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, IR::RegOpnd::New(TyVar, localFunc), sizeOpnd, localFunc);
+        insertBeforeInstr->InsertBefore(argInstr);
+        argInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, IR::RegOpnd::New(TyVar, localFunc), operandOpnd, argInstr->GetDst(), localFunc);
+        insertBeforeInstr->InsertBefore(argInstr);
+        argInstr = IR::Instr::New(Js::OpCode::ExtendArg_A, IR::RegOpnd::New(TyVar, localFunc), IR::IntConstOpnd::New((IntConstType)candidate->opcode, TyInt32, localFunc), argInstr->GetDst(), localFunc);
+        insertBeforeInstr->InsertBefore(argInstr);
+        src2 = argInstr->GetDst();
+    }
     else
     {
         Assert(emitData->candidate->IsMemCopy());
@@ -17383,10 +17705,10 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
     }
 
     // Generate memcopy
-    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
+    IR::Instr* memopInstr = IR::BailOutInstr::New(isMemset ? Js::OpCode::Memset : isMemarith ? Js::OpCode::Memarith : Js::OpCode::Memcopy, bailOutKind, bailOutInfo, localFunc);
     memopInstr->SetDst(dstOpnd);
     memopInstr->SetSrc1(src1);
-    memopInstr->SetSrc2(sizeOpnd);
+    memopInstr->SetSrc2(src2);
     insertBeforeInstr->InsertBefore(memopInstr);
 
 
@@ -17448,6 +17770,20 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
                               loopCountBuf,
                               bIndexAlreadyChanged);
         }
+        else if (isMemarith)
+        {
+            const Loop::MemArithCandidate* candidate = emitData->candidate->AsMemArith();
+            TRACE_MEMOP_PHASE(MemArith, loop, emitData->stElemInstr,
+                              _u("ValueType: %S, StBase: s%u, Index: s%u, LdBase: s%u, LdBase2: s%d, Operation: %s, LoopCount: %s, IsIndexChangedBeforeUse: %d"),
+                              valueTypeStr,
+                              candidate->base,
+                              candidate->index,
+                              candidate->ldBase,
+                              candidate->ldBase2 == Js::Constants::InvalidSymID ? -1 : (int)candidate->ldBase2,
+                              Js::OpCodeUtil::GetOpCodeName(candidate->opcode),
+                              loopCountBuf,
+                              bIndexAlreadyChanged);
+        }
         else
         {
             const Loop::MemCopyCandidate* candidate = emitData->candidate->AsMemCopy();
@@ -17473,7 +17809,27 @@ GlobOpt::EmitMemop(Loop * loop, LoopCount *loopCount, const MemOpEmitData* emitD
         ProcessNoImplicitCallArrayUses(baseOpnd, baseOpnd->IsArrayRegOpnd() ? baseOpnd->AsArrayRegOpnd() : nullptr, emitData->stElemInstr, isLikelyJsArray, true);
     }
     RemoveMemOpSrcInstr(memopInstr, emitData->stElemInstr, emitData->block);
-    if (!isMemset)
+    if (isMemarith)
+    {
+        MemArithEmitData* data = (MemArithEmitData*)emitData;
+        this->ConvertToByteCodeUses(data->arithInstr);
+        IR::Instr* ldElemInstrs[] = { data->ldElemInstr2, data->ldElemInstr };
+        for (IR::Instr* ldElemInstr : ldElemInstrs)
+        {
+            if (!ldElemInstr)
+            {
+                continue;
+            }
+            if (ldElemInstr->GetSrc1()->IsIndirOpnd())
+            {
+                baseOpnd = ldElemInstr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd();
+                isLikelyJsArray = baseOpnd->GetValueType().IsLikelyArrayOrObjectWithArray();
+                ProcessNoImplicitCallArrayUses(baseOpnd, baseOpnd->IsArrayRegOpnd() ? baseOpnd->AsArrayRegOpnd() : nullptr, ldElemInstr, isLikelyJsArray, true);
+            }
+            RemoveMemOpSrcInstr(memopInstr, ldElemInstr, emitData->block);
+        }
+    }
+    else if (!isMemset)
     {
         IR::Instr* ldElemInstr = ((MemCopyEmitData*)emitData)->ldElemInstr;
         if (ldElemInstr->GetSrc1()->IsIndirOpnd())
@@ -17572,6 +17928,87 @@ GlobOpt::InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, MemCopyEm
     return false;
 }
 
+bool
+GlobOpt::InspectInstrForMemArithCandidate(Loop* loop, IR::Instr* instr, MemArithEmitData* emitData, bool& errorInInstr)
+{
+    Assert(emitData && emitData->candidate && emitData->candidate->IsMemArith());
+    Loop::MemArithCandidate* candidate = (Loop::MemArithCandidate*)emitData->candidate;
+    if (instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict)
+    {
+        if (
+            !emitData->stElemInstr &&
+            instr->GetDst()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym()) == candidate->base) &&
+            (GetVarSymID(instr->GetDst()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            Assert(instr->IsProfiledInstr());
+            emitData->stElemInstr = instr;
+            emitData->bailOutKind = instr->GetBailOutKind();
+            // Still need to find the arithmetic and the LdElems
+            return false;
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Orphan StElemI_A detected"));
+        errorInInstr = true;
+    }
+    else if (instr->m_opcode == Js::OpCode::LdElemI_A)
+    {
+        if (
+            emitData->arithInstr &&
+            instr->GetSrc1()->IsIndirOpnd() &&
+            (GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetIndexOpnd()->GetStackSym()) == candidate->index)
+            )
+        {
+            // Going backward, the second operand's load is seen first when both are loaded from the same array
+            const SymID ldBaseSymID = GetVarSymID(instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetStackSym());
+            IR::Instr** ldElemInstr = nullptr;
+            if (candidate->ldBase2 == ldBaseSymID && !emitData->ldElemInstr2)
+            {
+                ldElemInstr = &emitData->ldElemInstr2;
+            }
+            else if (candidate->ldBase == ldBaseSymID && !emitData->ldElemInstr)
+            {
+                ldElemInstr = &emitData->ldElemInstr;
+            }
+
+            if (ldElemInstr)
+            {
+                Assert(instr->IsProfiledInstr());
+                *ldElemInstr = instr;
+                ValueType stValueType = emitData->stElemInstr->GetDst()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+                ValueType ldValueType = instr->GetSrc1()->AsIndirOpnd()->GetBaseOpnd()->GetValueType();
+                if (stValueType != ldValueType)
+                {
+#if DBG_DUMP
+                    char16 stValueTypeStr[VALUE_TYPE_MAX_STRING_SIZE];
+                    stValueType.ToString(stValueTypeStr);
+                    char16 ldValueTypeStr[VALUE_TYPE_MAX_STRING_SIZE];
+                    ldValueType.ToString(ldValueTypeStr);
+                    TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("for mismatch in Load(%s) and Store(%s) value type"), ldValueTypeStr, stValueTypeStr);
+#endif
+                    errorInInstr = true;
+                    return false;
+                }
+                // We found all the instructions for this candidate once both operands are loaded
+                return emitData->ldElemInstr && (candidate->ldBase2 == Js::Constants::InvalidSymID || emitData->ldElemInstr2);
+            }
+        }
+        TRACE_MEMOP_PHASE_VERBOSE(MemArith, loop, instr, _u("Orphan LdElemI_A detected"));
+        errorInInstr = true;
+    }
+    else if (
+        emitData->stElemInstr &&
+        !emitData->arithInstr &&
+        instr->GetDst() &&
+        instr->GetDst()->IsRegOpnd() &&
+        instr->GetDst()->AsRegOpnd()->GetStackSym() == candidate->transferSym
+        )
+    {
+        emitData->arithInstr = instr;
+    }
+    return false;
+}
+
 // The caller is responsible to free the memory allocated between inOrderEmitData[iEmitData -> end]
 bool
 GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitData** inOrderEmitData, int& iEmitData)
@@ -17623,6 +18060,20 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
                 Assert(!PHASE_OFF(Js::MemSetPhase, this->func));
                 emitData = JitAnew(this->alloc, MemSetEmitData);
             }
+            else if (candidate->IsMemArith())
+            {
+                Assert(!PHASE_OFF(Js::MemArithPhase, this->func));
+                Loop::MemArithCandidate* memarithCandidate = candidate->AsMemArith();
+
+                if (memarithCandidate->base == Js::Constants::InvalidSymID
+                    || memarithCandidate->ldBase == Js::Constants::InvalidSymID
+                    || memarithCandidate->count != 1)
+                {
+                    TRACE_MEMOP_PHASE(MemArith, loop, nullptr, _u("(s%d): not matching ldElem, arithmetic and stElem"), candidate->base);
+                    return false;
+                }
+                emitData = JitAnew(this->alloc, MemArithEmitData);
+            }
             else
             {
                 Assert(!PHASE_OFF(Js::MemCopyPhase, this->func));
@@ -17647,6 +18098,8 @@ GlobOpt::ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) MemOpEmitD
         bool errorInInstr = false;
         bool candidateFound = candidate->IsMemSet() ?
             InspectInstrForMemSetCandidate(loop, instr, (MemSetEmitData*)emitData, errorInInstr)
+            : candidate->IsMemArith() ?
+            InspectInstrForMemArithCandidate(loop, instr, (MemArithEmitData*)emitData, errorInInstr)
             : InspectInstrForMemCopyCandidate(loop, instr, (MemCopyEmitData*)emitData, errorInInstr);
         if (errorInInstr)
         {
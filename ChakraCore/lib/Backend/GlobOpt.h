@@ -650,6 +650,8 @@ class GlobOpt
     bool                    CollectMemOpStElementI(IR::Instr *, Loop *);
     bool                    CollectMemsetStElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyStElementI(IR::Instr *, Loop *);
+    bool                    CollectMemarithStElementI(IR::Instr *, Loop *);
+    bool                    CollectMemarithInstr(IR::Instr *, IR::Instr *, Loop *, Value *, Value *);
     bool                    CollectMemOpLdElementI(IR::Instr *, Loop *);
     bool                    CollectMemcopyLdElementI(IR::Instr *, Loop *);
     SymID                   GetVarSymID(StackSym *);
@@ -660,6 +662,7 @@ class GlobOpt
     void                    ProcessMemOp();
     bool                    InspectInstrForMemSetCandidate(Loop* loop, IR::Instr* instr, struct MemSetEmitData* emitData, bool& errorInInstr);
     bool                    InspectInstrForMemCopyCandidate(Loop* loop, IR::Instr* instr, struct MemCopyEmitData* emitData, bool& errorInInstr);
+    bool                    InspectInstrForMemArithCandidate(Loop* loop, IR::Instr* instr, struct MemArithEmitData* emitData, bool& errorInInstr);
     bool                    ValidateMemOpCandidates(Loop * loop, _Out_writes_(iEmitData) struct MemOpEmitData** emitData, int& iEmitData);
     void                    EmitMemop(Loop * loop, LoopCount *loopCount, const struct MemOpEmitData* emitData);
     IR::Opnd*               GenerateInductionVariableChangeForMemOp(Loop *loop, byte unroll, IR::Instr *insertBeforeInstr = nullptr);
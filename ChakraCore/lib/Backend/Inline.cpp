@@ -3820,6 +3820,26 @@ Inline::SetupInlineInstrForCallDirect(Js::BuiltinFunction builtInId, IR::Instr*
     case Js::BuiltinFunction::JavascriptArray_IsArray:
         callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperArray_IsArray, callInstr->m_func));
         break;
+
+    case Js::BuiltinFunction::JavascriptMap_Get:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Get, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptMap_Has:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Has, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptMap_Set:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperMap_Set, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptSet_Add:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperSet_Add, callInstr->m_func));
+        break;
+
+    case Js::BuiltinFunction::JavascriptSet_Has:
+        callInstr->SetSrc1(IR::HelperCallOpnd::New(IR::JnHelperMethod::HelperSet_Has, callInstr->m_func));
+        break;
     };
     callInstr->SetSrc2(argoutInstr->GetDst());
     return;
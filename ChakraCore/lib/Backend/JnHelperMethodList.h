@@ -224,6 +224,7 @@ HELPERCALLCHK(Op_DeleteElementI_Int32, Js::JavascriptOperators::OP_DeleteElement
 
 HELPERCALLCHK(Op_Memset, Js::JavascriptOperators::OP_Memset, AttrCanThrow | AttrCanNotBeReentrant)
 HELPERCALLCHK(Op_Memcopy, Js::JavascriptOperators::OP_Memcopy, AttrCanThrow | AttrCanNotBeReentrant)
+HELPERCALLCHK(Op_Memarith, Js::JavascriptOperators::OP_Memarith, AttrCanThrow | AttrCanNotBeReentrant)
 
 HELPERCALLCHK(Op_PatchGetValue, ((Js::Var (*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId))Js::JavascriptOperators::PatchGetValue<true, Js::InlineCache>), AttrCanThrow)
 HELPERCALLCHK(Op_PatchGetValueWithThisPtr, ((Js::Var(*)(Js::FunctionBody *const, Js::InlineCache *const, const Js::InlineCacheIndex, Js::Var, Js::PropertyId, Js::Var))Js::JavascriptOperators::PatchGetValueWithThisPtr<true, Js::InlineCache>), AttrCanThrow)
@@ -352,6 +353,7 @@ HELPERCALLCHK(NewScObjectNoArgNoCtorFull, Js::JavascriptOperators::NewScObjectNo
 HELPERCALLCHK(NewScObjectNoArgNoCtor, Js::JavascriptOperators::NewScObjectNoArgNoCtor, 0)
 HELPERCALLCHK(UpdateNewScObjectCache, Js::JavascriptOperators::UpdateNewScObjectCache, AttrCanNotBeReentrant)
 HELPERCALLCHK(EnsureObjectLiteralType, Js::JavascriptOperators::EnsureObjectLiteralType, AttrCanNotBeReentrant)
+HELPERCALL(NewScObjectLiteral, Js::JavascriptOperators::NewScObjectLiteral, AttrCanNotBeReentrant)
 
 HELPERCALLCHK(Op_NewClassProto, Js::JavascriptOperators::OP_NewClassProto, AttrCanNotBeReentrant)
 
@@ -526,6 +528,17 @@ HELPERCALL(String_PadEnd, Js::JavascriptString::EntryPadEnd, 0)
 HELPERCALLCHK(GlobalObject_ParseInt, Js::GlobalObject::EntryParseInt, 0)
 HELPERCALLCHK(Object_HasOwnProperty, Js::JavascriptObject::EntryHasOwnProperty, 0)
 HELPERCALLCHK(Object_HasOwn, Js::JavascriptObject::EntryHasOwn, 0)
+HELPERCALLCHK(Map_Get, Js::JavascriptMap::EntryGet, 0)
+HELPERCALLCHK(Map_Has, Js::JavascriptMap::EntryHas, 0)
+HELPERCALLCHK(Map_Set, Js::JavascriptMap::EntrySet, 0)
+HELPERCALLCHK(Map_DirectGet, Js::JavascriptMap::DirectGet, AttrCanNotBeReentrant)
+HELPERCALLCHK(Map_DirectHas, Js::JavascriptMap::DirectHas, AttrCanNotBeReentrant)
+HELPERCALLCHK(Map_DirectSet, Js::JavascriptMap::DirectSet, AttrCanNotBeReentrant)
+HELPERCALLCHK(Set_Add, Js::JavascriptSet::EntryAdd, 0)
+HELPERCALLCHK(Set_Has, Js::JavascriptSet::EntryHas, 0)
+HELPERCALLCHK(Set_DirectAdd, Js::JavascriptSet::DirectAdd, AttrCanNotBeReentrant)
+HELPERCALLCHK(Set_DirectHas, Js::JavascriptSet::DirectHas, AttrCanNotBeReentrant)
+HELPERCALLCHK(MapOrSet_GetStringKeyHash, Js::JavascriptMap::GetStringKeyHash, AttrCanNotBeReentrant)
 
 HELPERCALL(RegExp_SplitResultUsed, Js::RegexHelper::RegexSplitResultUsed, 0)
 HELPERCALL(RegExp_SplitResultUsedAndMayBeTemp, Js::RegexHelper::RegexSplitResultUsedAndMayBeTemp, 0)
@@ -16,6 +16,7 @@ class Lifetime
         regionUseCountAdjust(nullptr),
         defList(alloc),
         useList(alloc),
+        usePositions(nullptr),
         lastUseLabel(nullptr),
         region(nullptr),
         spillStackSlot(nullptr),
@@ -54,6 +55,7 @@ class Lifetime
     uint32 *            regionUseCountAdjust;
     SList<IR::Instr *>  defList;
     SList<IR::Instr *>  useList;
+    JsUtil::List<uint32, JitArenaAllocator> * usePositions;   // Sorted positions of the instrs using this lifetime outside of helper blocks, not counting helper instrs, only recorded for next-use spill costs
     IR::LabelInstr *    lastUseLabel;
     Region *            region;
     StackSlot *         spillStackSlot;
@@ -122,6 +124,41 @@ class Lifetime
             loop = loop->parent;
         }
     }
+    void AddUsePosition(uint32 position)
+    {
+        if (!this->usePositions)
+        {
+            this->usePositions = JsUtil::List<uint32, JitArenaAllocator>::New(this->alloc);
+        }
+        // An instr can use the same sym more than once
+        if (this->usePositions->Count() == 0 || this->usePositions->Last() < position)
+        {
+            this->usePositions->Add(position);
+        }
+    }
+    // Returns the first recorded use at or after position, or UINT32_MAX if there is none.
+    uint32 GetNextUsePosition(uint32 position) const
+    {
+        if (!this->usePositions)
+        {
+            return UINT32_MAX;
+        }
+        int low = 0;
+        int high = this->usePositions->Count();
+        while (low < high)
+        {
+            const int mid = low + (high - low) / 2;
+            if (this->usePositions->Item(mid) < position)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return low < this->usePositions->Count() ? this->usePositions->Item(low) : UINT32_MAX;
+    }
     uint32 GetRegionUseCount(Loop *loop)
     {
         if (loop && !PHASE_OFF1(Js::RegionUseCountPhase))
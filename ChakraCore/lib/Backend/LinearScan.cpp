@@ -115,7 +115,15 @@ LinearScan::RegAlloc()
 
     IR::Instr *currentInstr = this->func->m_headInstr;
 
-    SCCLiveness liveness(this->func, this->tempAlloc);
+    this->doNextUseSpillCost = this->DoNextUseSpillCost();
+    if (this->doNextUseSpillCost)
+    {
+        PHASE_PRINT_TRACE(Js::NextUseSpillCostPhase, this->func,
+            _u("NextUseSpillCost: function %s: weighing spill costs by the distance to the next use\n"),
+            this->func->GetJITFunctionBody()->GetDisplayName());
+    }
+
+    SCCLiveness liveness(this->func, this->tempAlloc, this->doNextUseSpillCost);
     BEGIN_CODEGEN_PHASE(this->func, Js::LivenessPhase);
 
     // Build the lifetime list
@@ -3586,6 +3594,7 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
     {
         length = 1;
     }
+    const uint mainPathLength = length;
 
     // Add a base length so that the difference between a length of 1 and a length of 2 is not so large
 #ifdef _M_X64
@@ -3596,6 +3605,33 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
 
     spillCost = (useCount << 13) / length;
 
+    if (this->doNextUseSpillCost)
+    {
+        // Spilling frees the register until the next use, where second chance allocation reloads the
+        // lifetime, so a lifetime that is needed again soon costs more to spill than one that is not.
+        // Use positions don't count helper instrs, so the distance is in the same instrs as the length,
+        // and the base length damps short distances the same way.
+        const uint32 position = start - totalOpHelperVisitedLength;
+        uint nextUseDistance = mainPathLength;
+        const uint32 nextUse = lifetime->GetNextUsePosition(position);
+        if (nextUse - position < mainPathLength)
+        {
+            nextUseDistance = nextUse - position;
+        }
+        else if (this->curLoop && this->curLoop->regAlloc.liveOnBackEdgeSyms->Test(lifetime->sym->m_id))
+        {
+            // The next use is in the next iteration of the loop
+            const uint32 loopStart = this->curLoop->regAlloc.loopStart - this->curLoop->regAlloc.helperLengthAtStart;
+            const uint32 loopEnd = this->curLoop->regAlloc.loopEnd - this->curLoop->regAlloc.helperLength;
+            const uint32 loopUse = lifetime->GetNextUsePosition(loopStart);
+            if (loopUse < position && position <= loopEnd)
+            {
+                nextUseDistance = min(mainPathLength, loopEnd - position + loopUse - loopStart);
+            }
+        }
+        spillCost = (uint)(((uint64)spillCost * length) / (length + nextUseDistance));
+    }
+
     if (lifetime->isSecondChanceAllocated)
     {
         // Second chance allocation have additional overhead, so de-prioritize them
@@ -3617,6 +3653,28 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
     return spillCost;
 }
 
+// DoNextUseSpillCost
+// Whether to weigh spill costs by the distance to the next use of each lifetime, which costs a sorted
+// list of use positions per lifetime. Only the full JIT of loop bodies and of functions that spend a
+// large part of their byte code in loops, where spills and reloads are repeated on every iteration, do it.
+bool
+LinearScan::DoNextUseSpillCost() const
+{
+    if (PHASE_OFF(Js::NextUseSpillCostPhase, this->func) || this->func->IsSimpleJit() ||
+        PHASE_OFF(Js::SecondChancePhase, this->func) || this->func->HasTry())
+    {
+        return false;
+    }
+    if (PHASE_FORCE(Js::NextUseSpillCostPhase, this->func) || this->func->IsLoopBody())
+    {
+        return true;
+    }
+
+    const JITTimeFunctionBody * body = this->func->GetJITFunctionBody();
+    return body->HasLoops() &&
+        (uint64)body->GetByteCodeInLoopCount() * 100 >= (uint64)body->GetByteCodeCount() * CONFIG_FLAG(MinNextUseSpillCostLoopWeight);
+}
+
 bool
 LinearScan::RemoveDeadStores(IR::Instr *instr)
 {
@@ -95,6 +95,7 @@ class LinearScan
     SList<Lifetime *> * stackPackInUseLiveRanges;
     SList<StackSlot *> *stackSlotsFreeList;
     LoweredBasicBlock  *currentBlock;
+    bool                doNextUseSpillCost;
 #if DBG
     BitVector           nonAllocatableRegs;
 #endif
@@ -102,7 +103,7 @@ class LinearScan
     LinearScan(Func *func) : func(func), currentBlockNumber(0), loopNest(0), intRegUsedCount(0), floatRegUsedCount(0), activeLiveranges(NULL),
         linearScanMD(func), opHelperSpilledLiveranges(NULL), currentOpHelperBlock(NULL),
         lastLabel(NULL), numInt32Regs(0), numFloatRegs(0), stackPackInUseLiveRanges(NULL), stackSlotsFreeList(NULL),
-        totalOpHelperFullVisitedLength(0), curLoop(NULL), currentBlock(nullptr), currentRegion(nullptr), m_bailOutRecordCount(0),
+        totalOpHelperFullVisitedLength(0), curLoop(NULL), currentBlock(nullptr), doNextUseSpillCost(false), currentRegion(nullptr), m_bailOutRecordCount(0),
         globalBailOutRecordTables(nullptr), lastUpdatedRowIndices(nullptr), bailIn(GeneratorBailIn(func, this))
     {
     }
@@ -147,6 +148,7 @@ class LinearScan
     void                KillImplicitRegs(IR::Instr *instr);
     bool                CheckIfInLoop(IR::Instr *instr);
     uint                GetSpillCost(Lifetime * lifetime);
+    bool                DoNextUseSpillCost() const;
     bool                RemoveDeadStores(IR::Instr *instr);
 
     // This helper function is used to save bytecode stack sym value to memory / local slots on stack so that we can read it for the locals inspection.
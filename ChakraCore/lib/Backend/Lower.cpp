@@ -239,6 +239,46 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
         }
 #endif
 
+        if (this->coldPathEnd != nullptr)
+        {
+            // Got to the start of the block that ends in the throw
+            if (instr->IsLabelInstr())
+            {
+                if (this->MarkColdPath(instr->AsLabelInstr(), this->coldPathEnd) &&
+                    (PHASE_TRACE(Js::ColdPathLayoutPhase, this->m_func) || PHASE_TESTTRACE(Js::ColdPathLayoutPhase, this->m_func)))
+                {
+                    Output::Print(_u("ColdPathLayout: function %s: moved a throwing block to the helper blocks\n"),
+                        this->m_func->GetJITFunctionBody()->GetDisplayName());
+                    Output::Flush();
+                }
+                this->coldPathEnd = nullptr;
+            }
+            else if (instr->IsBranchInstr())
+            {
+                this->coldPathEnd = nullptr;
+            }
+            else
+            {
+                // Only blocks of plain instructions are moved. Inlinee frames, bailouts and calls record the native
+                // offsets and register state of the code around them, so a block with any of them stays in place.
+                char16 const * keepReason =
+                    instr->m_opcode == Js::OpCode::InlineeStart || instr->m_opcode == Js::OpCode::InlineeEnd ? _u("an inlined callee") :
+                    instr->HasBailOutInfo() ? _u("a bailout") :
+                    OpCodeAttr::CallInstr(instr->m_opcode) ? _u("a call") :
+                    nullptr;
+                if (keepReason != nullptr)
+                {
+                    if (PHASE_TRACE(Js::ColdPathLayoutPhase, this->m_func) || PHASE_TESTTRACE(Js::ColdPathLayoutPhase, this->m_func))
+                    {
+                        Output::Print(_u("ColdPathLayout: function %s: kept a throwing block in place, it has %s\n"),
+                            this->m_func->GetJITFunctionBody()->GetDisplayName(), keepReason);
+                        Output::Flush();
+                    }
+                    this->coldPathEnd = nullptr;
+                }
+            }
+        }
+
 #if DBG
         if (instr->HasBailOutInfo())
         {
@@ -250,7 +290,8 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
             if ((bailoutKind & IR::BailOutOnArrayAccessHelperCall) != 0 &&
                 instr->m_opcode != Js::OpCode::Memcopy &&
-                instr->m_opcode != Js::OpCode::Memset)
+                instr->m_opcode != Js::OpCode::Memset &&
+                instr->m_opcode != Js::OpCode::Memarith)
             {
                 this->helperCallCheckState = (HelperCallCheckState)(this->helperCallCheckState | HelperCallCheckState_NoHelperCalls);
             }
@@ -802,6 +843,13 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
             case IR::JnHelperMethod::HelperArray_IsArray:
                 this->GenerateFastInlineIsArray(instr);
                 break;
+            case IR::JnHelperMethod::HelperMap_Get:
+            case IR::JnHelperMethod::HelperMap_Has:
+            case IR::JnHelperMethod::HelperMap_Set:
+            case IR::JnHelperMethod::HelperSet_Add:
+            case IR::JnHelperMethod::HelperSet_Has:
+                this->GenerateFastInlineMapOrSetAccess(instr);
+                break;
             }
             instrPrev = LowerCallDirect(instr);
             break;
@@ -1565,6 +1613,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::Memset:
         case Js::OpCode::Memcopy:
+        case Js::OpCode::Memarith:
         {
             instrPrev = LowerMemOp(instr);
             break;
@@ -2598,6 +2647,7 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
         case Js::OpCode::Throw:
         case Js::OpCode::InlineThrow:
         case Js::OpCode::EHThrow:
+            this->coldPathEnd = this->DoColdPathLayout() ? instr->m_next : nullptr;
             this->LowerUnaryHelperMem(instr, IR::HelperOp_Throw);
             break;
 
@@ -2650,11 +2700,13 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
 
         case Js::OpCode::RuntimeTypeError:
         case Js::OpCode::InlineRuntimeTypeError:
+            this->coldPathEnd = this->DoColdPathLayout() ? instr->m_next : nullptr;
             this->LowerUnaryHelperMem(instr, IR::HelperOp_RuntimeTypeError);
             break;
 
         case Js::OpCode::RuntimeReferenceError:
         case Js::OpCode::InlineRuntimeReferenceError:
+            this->coldPathEnd = this->DoColdPathLayout() ? instr->m_next : nullptr;
             this->LowerUnaryHelperMem(instr, IR::HelperOp_RuntimeReferenceError);
             break;
 
@@ -3133,6 +3185,76 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
     } NEXT_INSTR_BACKWARD_EDITING_IN_RANGE;
 
     Assert(this->outerMostLoopLabel == nullptr);
+    this->coldPathEnd = nullptr;
+}
+
+bool
+Lowerer::DoColdPathLayout() const
+{
+    // Layout only moves helper blocks out of the way when it runs. Functions with try are left alone, as
+    // the code of a try region has to stay within the region.
+    return !PHASE_OFF(Js::ColdPathLayoutPhase, m_func) && !PHASE_OFF(Js::LayoutPhase, m_func) && !CONFIG_ISENABLED(Js::DebugFlag)
+        && !m_func->HasTry() && !m_func->IsJitInDebugMode();
+}
+
+//
+// A block that ends in a throw only runs when the function throws, so it is made a helper block like the slow
+// paths and bailouts: register allocation keeps its spills and restores off the fast path, and layout moves it
+// after the function exit, so that the hot code is contiguous.
+//
+// When the function has been profiled and no-profile bailouts are enabled, IRBuilder already puts a
+// BailOnNoProfile ahead of these throws; this is for the blocks that are still jitted, e.g. after repeated
+// bailouts disabled no-profile bailouts for the function.
+//
+// LowerRange only gets here for blocks without inlinee frames, bailouts or calls. Returns whether the block was
+// made a helper block.
+//
+bool
+Lowerer::MarkColdPath(IR::LabelInstr * labelInstr, IR::Instr * endInstr)
+{
+    if (labelInstr->isOpHelper || labelInstr->m_isLoopTop || labelInstr->m_hasNonBranchRef)
+    {
+        return false;
+    }
+
+    // Only enter the helper block by falling through or by a conditional branch, as the fast paths
+    // the lowerer generates do. A non-helper label directly followed by a helper label is not expected either.
+    FOREACH_SLIST_ENTRY(IR::BranchInstr *, branchInstr, &labelInstr->labelRefs)
+    {
+        if (branchInstr->IsMultiBranch() || !branchInstr->IsConditional())
+        {
+            return false;
+        }
+    } NEXT_SLIST_ENTRY;
+
+    IR::Instr * prevInstr = labelInstr->GetPrevRealInstrOrLabel();
+    if (prevInstr == nullptr || prevInstr->IsLabelInstr())
+    {
+        return false;
+    }
+
+    for (IR::Instr * instr = labelInstr->m_next; instr != endInstr; instr = instr->m_next)
+    {
+        if (instr == nullptr)
+        {
+            return false;
+        }
+        if (instr->IsLabelInstr() && (instr->AsLabelInstr()->m_isLoopTop || instr->AsLabelInstr()->m_hasNonBranchRef))
+        {
+            return false;
+        }
+    }
+
+    // The fast paths lowered in the block get their own labels; all of them are part of the helper block
+    labelInstr->isOpHelper = true;
+    for (IR::Instr * instr = labelInstr->m_next; instr != endInstr; instr = instr->m_next)
+    {
+        if (instr->IsLabelInstr())
+        {
+            instr->AsLabelInstr()->isOpHelper = true;
+        }
+    }
+    return true;
 }
 
 IR::Opnd *
@@ -9700,10 +9822,70 @@ Lowerer::LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet)
     return nullptr;
 }
 
+IR::Instr *
+Lowerer::LowerMemarith(IR::Instr * instr, IR::RegOpnd * helperRet)
+{
+    IR::Opnd * dst = instr->UnlinkDst();
+    IR::Opnd * src = instr->UnlinkSrc1();
+
+    Assert(dst->IsIndirOpnd());
+    Assert(src->IsIndirOpnd());
+
+    IR::Opnd *dstBaseOpnd = dst->AsIndirOpnd()->UnlinkBaseOpnd();
+    IR::Opnd *dstIndexOpnd = dst->AsIndirOpnd()->UnlinkIndexOpnd();
+
+    IR::Opnd *srcBaseOpnd = src->AsIndirOpnd()->UnlinkBaseOpnd();
+
+    // The operation, the second operand and the size are chained with ExtendArg_A
+    IR::RegOpnd * opndLink = instr->UnlinkSrc2()->AsRegOpnd();
+    IR::Instr * instrDef = opndLink->m_sym->m_instrDef;
+    Assert(instrDef && instrDef->m_opcode == Js::OpCode::ExtendArg_A);
+
+    IR::Opnd * opOpnd = instrDef->GetSrc1();
+    opndLink = instrDef->GetSrc2()->AsRegOpnd();
+    instrDef = opndLink->m_sym->m_instrDef;
+    Assert(instrDef && instrDef->m_opcode == Js::OpCode::ExtendArg_A);
+
+    IR::Opnd * operandOpnd = instrDef->GetSrc1();
+    opndLink = instrDef->GetSrc2()->AsRegOpnd();
+    instrDef = opndLink->m_sym->m_instrDef;
+    Assert(instrDef && instrDef->m_opcode == Js::OpCode::ExtendArg_A);
+
+    IR::Opnd * sizeOpnd = instrDef->GetSrc1();
+
+    Assert(opOpnd->IsIntConstOpnd());
+    Assert(dstBaseOpnd);
+    Assert(dstIndexOpnd);
+    Assert(srcBaseOpnd);
+
+    IR::JnHelperMethod helperMethod = IR::HelperOp_Memarith;
+    IR::Instr *instrPrev = nullptr;
+    if (operandOpnd->IsRegOpnd() && !operandOpnd->IsVar())
+    {
+        IR::RegOpnd* varOpnd = IR::RegOpnd::New(TyVar, instr->m_func);
+        instrPrev = IR::Instr::New(Js::OpCode::ToVar, varOpnd, operandOpnd, instr->m_func);
+        instr->InsertBefore(instrPrev);
+        operandOpnd = varOpnd;
+    }
+    instr->SetDst(helperRet);
+    LoadScriptContext(instr);
+    m_lowererMD.LoadHelperArgument(instr, opOpnd);
+    m_lowererMD.LoadHelperArgument(instr, sizeOpnd);
+    m_lowererMD.LoadHelperArgument(instr, operandOpnd);
+    m_lowererMD.LoadHelperArgument(instr, srcBaseOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstIndexOpnd);
+    m_lowererMD.LoadHelperArgument(instr, dstBaseOpnd);
+    m_lowererMD.ChangeToHelperCall(instr, helperMethod);
+    dst->Free(m_func);
+    src->Free(m_func);
+
+    return instrPrev;
+}
+
 IR::Instr *
 Lowerer::LowerMemOp(IR::Instr * instr)
 {
-    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memarith);
     IR::Instr *instrPrev = instr->m_prev;
 
     IR::RegOpnd* helperRet = IR::RegOpnd::New(TyInt8, instr->m_func);
@@ -9769,6 +9951,10 @@ Lowerer::LowerMemOp(IR::Instr * instr)
     {
         newInstrPrev = LowerMemcopy(instr, helperRet);
     }
+    else if (instr->m_opcode == Js::OpCode::Memarith)
+    {
+        newInstrPrev = LowerMemarith(instr, helperRet);
+    }
 
     if (newInstrPrev != nullptr)
     {
@@ -13348,7 +13534,7 @@ void Lowerer::LowerBailOnInvalidatedArrayHeadSegment(IR::Instr *const instr, con
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memarith);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -13475,7 +13661,7 @@ void Lowerer::LowerBailOnInvalidatedArrayLength(IR::Instr *const instr, const bo
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memarith);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -13562,7 +13748,7 @@ void Lowerer::LowerBailOnCreatedMissingValue(IR::Instr *const instr, const bool
     */
 
     Assert(instr);
-    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy);
+    Assert(instr->m_opcode == Js::OpCode::StElemI_A || instr->m_opcode == Js::OpCode::StElemI_A_Strict || instr->m_opcode == Js::OpCode::Memset || instr->m_opcode == Js::OpCode::Memcopy || instr->m_opcode == Js::OpCode::Memarith);
     Assert(instr->GetDst());
     Assert(instr->GetDst()->IsIndirOpnd());
 
@@ -14333,6 +14519,11 @@ Lowerer::GenerateBailOut(IR::Instr * instr, IR::BranchInstr * branchInstr, IR::L
     bailOutInfo->bailOutInstr = bailOutLabel;
     bailOutLabel->m_hasNonBranchRef = true;
 
+    if (!bailOutInfo->materializedObjectLiteralInstrs.Empty())
+    {
+        GenerateMaterializedObjectLiterals(bailOutInfo, instr);
+    }
+
     // Create the bail out record
     Assert(bailOutInfo->bailOutRecord == nullptr);
     BailOutRecord * bailOutRecord;
@@ -14491,6 +14682,48 @@ Lowerer::EnsureEpilogueLabel() const
     }
 }
 
+// Allocate the object literals that scalar replacement removed but the bailout restores (see
+// BackwardPass::ProcessBailOutObjectLiterals), and store the fields they had at the bailout.
+void
+Lowerer::GenerateMaterializedObjectLiterals(BailOutInfo * bailOutInfo, IR::Instr * insertBeforeInstr)
+{
+    FOREACH_SLISTBASE_ENTRY(IR::Instr *, materializeInstr, &bailOutInfo->materializedObjectLiteralInstrs)
+    {
+        insertBeforeInstr->InsertBefore(materializeInstr);
+    }
+    NEXT_SLISTBASE_ENTRY;
+
+    FOREACH_SLISTBASE_ENTRY(IR::Instr *, materializeInstr, &bailOutInfo->materializedObjectLiteralInstrs)
+    {
+        if (materializeInstr->m_opcode == Js::OpCode::InitFld)
+        {
+            LowerStFld(materializeInstr, IR::HelperOp_PatchInitValue, IR::HelperOp_PatchInitValuePolymorphic, true, nullptr, true);
+            continue;
+        }
+
+        // Js::JavascriptOperators::NewScObjectLiteral(scriptContext, propIds, literalType)
+        Assert(materializeInstr->m_opcode == Js::OpCode::NewScObjectLiteral);
+
+        // Every bailout that materializes the literal defines its sym again
+        materializeInstr->GetDst()->AsRegOpnd()->m_sym->m_isSingleDef = false;
+
+        const JITTimeFunctionBody * functionBody = materializeInstr->m_func->GetJITFunctionBody();
+        IR::IntConstOpnd * literalObjectIdOpnd = materializeInstr->UnlinkSrc2()->AsIntConstOpnd();
+        IR::IntConstOpnd * propertyArrayIdOpnd = materializeInstr->UnlinkSrc1()->AsIntConstOpnd();
+
+        m_lowererMD.LoadHelperArgument(materializeInstr,
+            IR::AddrOpnd::New(functionBody->GetObjectLiteralTypeRef(literalObjectIdOpnd->AsUint32()), IR::AddrOpndKindDynamicMisc, m_func));
+        m_lowererMD.LoadHelperArgument(materializeInstr,
+            IR::AddrOpnd::New(functionBody->GetAuxDataAddr(propertyArrayIdOpnd->AsUint32()), IR::AddrOpndKindDynamicMisc, m_func));
+        LoadScriptContext(materializeInstr);
+        literalObjectIdOpnd->Free(m_func);
+        propertyArrayIdOpnd->Free(m_func);
+
+        m_lowererMD.ChangeToHelperCall(materializeInstr, IR::HelperNewScObjectLiteral);
+    }
+    NEXT_SLISTBASE_ENTRY;
+}
+
 void
 Lowerer::GenerateJumpToEpilogForBailOut(BailOutInfo * bailOutInfo, IR::Instr *instr, IR::LabelInstr *exitTargetInstr)
 {
@@ -20394,6 +20627,403 @@ Lowerer::GenerateFastInlineHasOwnProperty(IR::Instr * instr)
     RelocateCallDirectToHelperPath(tmpInstr, labelHelper);
 }
 
+void
+Lowerer::GenerateFastInlineMapOrSetAccess(IR::Instr * instr)
+{
+    Assert(instr->m_opcode == Js::OpCode::CallDirect);
+
+    // Lookups (Map.prototype.get/has, Set.prototype.has) with a likely tagged int or likely string key probe
+    // the table inline. Everything else, and any key the probe can't decide, calls a Direct* helper, which
+    // still saves the trip through the built-in's entry point (argument marshalling, stack probe and
+    // receiver check) once the receiver is known to be a Map or Set.
+    IR::JnHelperMethod directHelper;
+    Js::TypeId typeId;
+    uint argCount;
+    bool needsScriptContext;
+    bool isLookup;
+    bool returnsValue = false;
+    const char16 * builtInName;
+    switch (instr->GetSrc1()->AsHelperCallOpnd()->m_fnHelper)
+    {
+    case IR::JnHelperMethod::HelperMap_Get:
+        directHelper = IR::JnHelperMethod::HelperMap_DirectGet;
+        typeId = Js::TypeIds_Map;
+        argCount = 2;
+        needsScriptContext = true;
+        isLookup = true;
+        returnsValue = true;
+        builtInName = _u("Map.prototype.get");
+        break;
+    case IR::JnHelperMethod::HelperMap_Has:
+        directHelper = IR::JnHelperMethod::HelperMap_DirectHas;
+        typeId = Js::TypeIds_Map;
+        argCount = 2;
+        needsScriptContext = true;
+        isLookup = true;
+        builtInName = _u("Map.prototype.has");
+        break;
+    case IR::JnHelperMethod::HelperMap_Set:
+        directHelper = IR::JnHelperMethod::HelperMap_DirectSet;
+        typeId = Js::TypeIds_Map;
+        argCount = 3;
+        needsScriptContext = false;
+        isLookup = false;
+        builtInName = _u("Map.prototype.set");
+        break;
+    case IR::JnHelperMethod::HelperSet_Add:
+        directHelper = IR::JnHelperMethod::HelperSet_DirectAdd;
+        typeId = Js::TypeIds_Set;
+        argCount = 2;
+        needsScriptContext = false;
+        isLookup = false;
+        builtInName = _u("Set.prototype.add");
+        break;
+    case IR::JnHelperMethod::HelperSet_Has:
+        directHelper = IR::JnHelperMethod::HelperSet_DirectHas;
+        typeId = Js::TypeIds_Set;
+        argCount = 2;
+        needsScriptContext = true;
+        isLookup = true;
+        builtInName = _u("Set.prototype.has");
+        break;
+    default:
+        Assert(UNREACHED);
+        return;
+    }
+
+    //CallDirect src2
+    IR::Opnd * linkOpnd = instr->GetSrc2();
+    //ArgOut_A_InlineSpecialized
+    IR::Instr * tmpInstr = linkOpnd->AsSymOpnd()->m_sym->AsStackSym()->m_instrDef;
+
+    IR::Opnd * argsOpnd[3] = { 0 };
+    bool result = instr->FetchOperands(argsOpnd, argCount);
+    Assert(result);
+    AnalysisAssert(argsOpnd[0] && argsOpnd[1]);
+
+    if (argsOpnd[0]->GetValueType().IsNotObject() || !argsOpnd[0]->IsRegOpnd())
+    {
+        return;
+    }
+
+    IR::RegOpnd * thisObj = argsOpnd[0]->AsRegOpnd();
+
+    bool probeIntKey = false;
+    bool probeStringKey = false;
+    if (isLookup && !PHASE_OFF(Js::MapSetFastPathPhase, this->m_func) &&
+        instr->GetDst() && instr->GetDst()->IsRegOpnd() && argsOpnd[1]->IsRegOpnd() && argsOpnd[1]->AsRegOpnd()->IsVar())
+    {
+        const ValueType keyValueType = argsOpnd[1]->GetValueType();
+        probeIntKey = keyValueType.IsLikelyInt() && !argsOpnd[1]->AsRegOpnd()->m_sym->IsIntConst();
+        probeStringKey = keyValueType.IsLikelyString();
+    }
+
+    if (PHASE_TRACE(Js::MapSetFastPathPhase, this->m_func) || PHASE_TESTTRACE(Js::MapSetFastPathPhase, this->m_func))
+    {
+        Output::Print(_u("MapSetFastPath: function %s: %s %s\n"),
+            instr->m_func->GetJITFunctionBody()->GetDisplayName(), builtInName,
+            probeIntKey ? _u("probes the table for an int key") : probeStringKey ? _u("probes the table for a string key") : _u("calls the runtime directly"));
+        Output::Flush();
+    }
+
+    IR::LabelInstr * doneLabel = InsertLabel(false, instr->m_next);
+    IR::LabelInstr * labelHelper = InsertLabel(true, instr);
+    IR::Instr * insertInstr = labelHelper;
+
+    //    GenerateObjectTest(thisObj, $labelHelper)
+    //    MOV typeOpnd, thisObj->type
+    //    CMP typeOpnd->typeId, TypeIds_Map / TypeIds_Set
+    //    JNE $labelHelper
+    //    [table probe, see GenerateMapOrSetTableProbe]
+    // $direct:
+    //    dst = CALL Direct<Operation>(thisObj, args..., [scriptContext])
+    //    JMP $done
+    // $labelHelper: [helper]
+    //    CallDirect code
+    //    ...
+    // $doneLabel:
+
+    if (!thisObj->IsNotTaggedValue())
+    {
+        m_lowererMD.GenerateObjectTest(thisObj, insertInstr, labelHelper);
+    }
+
+    IR::RegOpnd * typeOpnd = IR::RegOpnd::New(TyMachPtr, m_func);
+    InsertMove(typeOpnd, IR::IndirOpnd::New(thisObj, Js::RecyclableObject::GetOffsetOfType(), TyMachPtr, m_func), insertInstr);
+    InsertCompareBranch(
+        IR::IndirOpnd::New(typeOpnd, Js::Type::GetOffsetOfTypeId(), TyInt32, m_func),
+        IR::IntConstOpnd::New(typeId, TyInt32, m_func),
+        Js::OpCode::BrNeq_A,
+        labelHelper,
+        insertInstr);
+
+    if (probeIntKey || probeStringKey)
+    {
+        IR::LabelInstr * labelDirect = IR::LabelInstr::New(Js::OpCode::Label, m_func, true);
+        if (returnsValue)
+        {
+            // Values come back without marshalling, so they have to belong to this script context
+            InsertCompareBranch(
+                IR::IndirOpnd::New(typeOpnd, Js::Type::GetJavascriptLibraryOffset(), TyMachPtr, m_func),
+                IR::AddrOpnd::New(m_func->GetScriptContextInfo()->GetLibraryAddr(), IR::AddrOpndKindDynamicMisc, m_func),
+                Js::OpCode::BrNeq_A,
+                labelDirect,
+                insertInstr);
+        }
+
+        GenerateMapOrSetTableProbe(instr, thisObj, argsOpnd[1]->AsRegOpnd(), typeId, probeIntKey, returnsValue, labelDirect, doneLabel, insertInstr);
+        insertInstr->InsertBefore(labelDirect);
+    }
+
+    // Helper arguments are loaded last to first
+    if (needsScriptContext)
+    {
+        LoadScriptContext(insertInstr);
+    }
+    for (uint i = argCount; i > 0; i--)
+    {
+        m_lowererMD.LoadHelperArgument(insertInstr, argsOpnd[i - 1]);
+    }
+
+    IR::Instr * callInstr = IR::Instr::New(Js::OpCode::Call, instr->GetDst(), IR::HelperCallOpnd::New(directHelper, m_func), m_func);
+    insertInstr->InsertBefore(callInstr);
+    m_lowererMD.LowerCall(callInstr, 0);
+
+    InsertBranch(Js::OpCode::Br, doneLabel, insertInstr);
+
+    RelocateCallDirectToHelperPath(tmpInstr, labelHelper);
+}
+
+void
+Lowerer::GenerateMapOrSetTableProbe(IR::Instr * instr, IR::RegOpnd * thisObj, IR::RegOpnd * keyOpnd, Js::TypeId typeId, bool isIntKey,
+    bool returnsValue, IR::LabelInstr * labelDirect, IR::LabelInstr * doneLabel, IR::Instr * insertInstr)
+{
+    // Keys are stored canonicalized, so an int32 valued number is always stored as a tagged int and the tagged int key
+    // only matches an entry holding the same Var. A string key matches an entry holding the same string; any other
+    // string with the same hash has to be compared by the runtime. Int32 valued numbers hash with
+    // MapOrSetDataTable::HashInt32Key, which is cheap enough to compute here, and strings hash in a helper.
+    //
+    //    [tag test / string test on key, $direct]
+    //    MOV store, [thisObj + table.store]
+    //    TEST store, store
+    //    JEQ $notFound
+    //    MOV buckets, [store + buckets]
+    //    TEST buckets, buckets
+    //    JEQ $linear
+    //    hash = key ^ (key >> 16) / CALL GetStringKeyHash(key)
+    //    MOV mask, [store + bucketCount]
+    //    SUB mask, 1
+    //    MOV hashes, [store + hashes]
+    //    MOV bucket, hash
+    //    AND bucket, mask
+    // $probe:
+    //    MOV entry, [buckets + bucket * 4]
+    //    CMP entry, EmptyBucket
+    //    JEQ $notFound
+    //    CMP entry, RemovedBucket
+    //    JEQ $next
+    //    SUB entry, 1
+    //    CMP [hashes + entry * 4], hash
+    //    JNE $next
+    //    index = entry * varsPerEntry
+    //    CMP key, [store + index * sizeof(Var) + entries]
+    //    JEQ $found
+    //    JMP $direct                       ; same hash, different Var
+    // $next:
+    //    ADD bucket, 1
+    //    AND bucket, mask
+    //    JMP $probe
+    // $linear:                             ; small stores have no index and are scanned
+    //    MOV end, [store + used]
+    //    index = 0, end *= varsPerEntry
+    // $scan:
+    //    CMP index, end
+    //    JAE $direct                       ; an equal key could still be stored as a different Var
+    //    CMP key, [store + index * sizeof(Var) + entries]
+    //    JEQ $found
+    //    ADD index, varsPerEntry
+    //    JMP $scan
+    // $found:
+    //    MOV dst, [store + index * sizeof(Var) + entries + value] / true
+    //    JMP $done
+    // $notFound:
+    //    MOV dst, undefined / false
+    //    JMP $done
+
+    uint32 tableOffset;
+    uint32 storeOffset;
+    uint32 bucketsOffset;
+    uint32 hashesOffset;
+    uint32 bucketCountOffset;
+    uint32 usedOffset;
+    uint32 entriesOffset;
+    uint32 keyOffset;
+    uint32 valueOffset = 0;
+    uint32 varsPerEntryLog2;
+    if (typeId == Js::TypeIds_Map)
+    {
+        typedef Js::JavascriptMap::MapDataTable Table;
+        tableOffset = Js::JavascriptMap::GetOffsetOfTable();
+        storeOffset = Table::GetOffsetOfStore();
+        bucketsOffset = Table::GetOffsetOfStoreBuckets();
+        hashesOffset = Table::GetOffsetOfStoreHashes();
+        bucketCountOffset = Table::GetOffsetOfStoreBucketCount();
+        usedOffset = Table::GetOffsetOfStoreUsed();
+        entriesOffset = Table::GetOffsetOfStoreEntries();
+        keyOffset = Js::JavascriptMap::MapDataKeyValuePair::GetOffsetOfKey();
+        valueOffset = Js::JavascriptMap::MapDataKeyValuePair::GetOffsetOfValue();
+        CompileAssert(sizeof(Js::JavascriptMap::MapDataKeyValuePair) == 2 * sizeof(Js::Var));
+        varsPerEntryLog2 = 1;
+    }
+    else
+    {
+        Assert(typeId == Js::TypeIds_Set);
+        Assert(!returnsValue);
+        typedef Js::JavascriptSet::SetDataTable Table;
+        tableOffset = Js::JavascriptSet::GetOffsetOfTable();
+        storeOffset = Table::GetOffsetOfStore();
+        bucketsOffset = Table::GetOffsetOfStoreBuckets();
+        hashesOffset = Table::GetOffsetOfStoreHashes();
+        bucketCountOffset = Table::GetOffsetOfStoreBucketCount();
+        usedOffset = Table::GetOffsetOfStoreUsed();
+        entriesOffset = Table::GetOffsetOfStoreEntries();
+        keyOffset = 0;
+        varsPerEntryLog2 = 0;
+    }
+    CompileAssert(Js::JavascriptMap::MapDataTable::EmptyBucket == Js::JavascriptSet::SetDataTable::EmptyBucket);
+    CompileAssert(Js::JavascriptMap::MapDataTable::RemovedBucket == Js::JavascriptSet::SetDataTable::RemovedBucket);
+
+    IR::LabelInstr * labelNext = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    IR::LabelInstr * labelLinear = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    IR::LabelInstr * labelFound = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+    IR::LabelInstr * labelNotFound = IR::LabelInstr::New(Js::OpCode::Label, m_func);
+
+    IR::RegOpnd * intKeyOpnd = nullptr;
+    if (isIntKey)
+    {
+        intKeyOpnd = GenerateUntagVar(keyOpnd, labelDirect, insertInstr);
+    }
+    else
+    {
+        GenerateStringTest(keyOpnd, insertInstr, labelDirect);
+    }
+
+    IR::RegOpnd * storeOpnd = IR::RegOpnd::New(TyMachPtr, m_func);
+    InsertMove(storeOpnd, IR::IndirOpnd::New(thisObj, (int32)(tableOffset + storeOffset), TyMachPtr, m_func), insertInstr);
+    InsertTestBranch(storeOpnd, storeOpnd, Js::OpCode::BrEq_A, labelNotFound, insertInstr);
+
+    IR::RegOpnd * bucketsOpnd = IR::RegOpnd::New(TyMachPtr, m_func);
+    InsertMove(bucketsOpnd, IR::IndirOpnd::New(storeOpnd, (int32)bucketsOffset, TyMachPtr, m_func), insertInstr);
+    InsertTestBranch(bucketsOpnd, bucketsOpnd, Js::OpCode::BrEq_A, labelLinear, insertInstr);
+
+    IR::RegOpnd * hashOpnd = IR::RegOpnd::New(TyUint32, m_func);
+    if (isIntKey)
+    {
+        IR::RegOpnd * shiftedOpnd = IR::RegOpnd::New(TyUint32, m_func);
+        InsertMove(hashOpnd, intKeyOpnd->UseWithNewType(TyUint32, m_func), insertInstr);
+        InsertShift(Js::OpCode::ShrU_A, false, shiftedOpnd, hashOpnd, IR::IntConstOpnd::New(16, TyInt8, m_func, true), insertInstr);
+        InsertXor(hashOpnd, hashOpnd, shiftedOpnd, insertInstr);
+    }
+    else
+    {
+        m_lowererMD.LoadHelperArgument(insertInstr, keyOpnd);
+        IR::Instr * hashInstr = IR::Instr::New(Js::OpCode::Call, hashOpnd, IR::HelperCallOpnd::New(IR::HelperMapOrSet_GetStringKeyHash, m_func), m_func);
+        insertInstr->InsertBefore(hashInstr);
+        m_lowererMD.LowerCall(hashInstr, 0);
+    }
+
+    IR::RegOpnd * maskOpnd = IR::RegOpnd::New(TyUint32, m_func);
+    InsertMove(maskOpnd, IR::IndirOpnd::New(storeOpnd, (int32)bucketCountOffset, TyUint32, m_func), insertInstr);
+    InsertSub(false, maskOpnd, maskOpnd, IR::IntConstOpnd::New(1, TyUint32, m_func, true), insertInstr);
+
+    IR::RegOpnd * hashesOpnd = IR::RegOpnd::New(TyMachPtr, m_func);
+    InsertMove(hashesOpnd, IR::IndirOpnd::New(storeOpnd, (int32)hashesOffset, TyMachPtr, m_func), insertInstr);
+
+    IR::RegOpnd * bucketOpnd = IR::RegOpnd::New(TyUint32, m_func);
+    InsertAnd(bucketOpnd, hashOpnd, maskOpnd, insertInstr);
+
+    // Both the probe and the scan leave the position of the entry's key, in Vars from the start of the entries, in indexOpnd
+    IR::RegOpnd * indexOpnd = IR::RegOpnd::New(TyUint32, m_func);
+
+    // $probe:
+    IR::LabelInstr * labelProbe = InsertLoopTopLabel(insertInstr);
+    Loop * probeLoop = labelProbe->GetLoop();
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(keyOpnd->m_sym->m_id);
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(storeOpnd->m_sym->m_id);
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(bucketsOpnd->m_sym->m_id);
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(hashesOpnd->m_sym->m_id);
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(hashOpnd->m_sym->m_id);
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(maskOpnd->m_sym->m_id);
+    probeLoop->regAlloc.liveOnBackEdgeSyms->Set(bucketOpnd->m_sym->m_id);
+    IR::RegOpnd * entryOpnd = IR::RegOpnd::New(TyUint32, m_func);
+    InsertMove(entryOpnd, IR::IndirOpnd::New(bucketsOpnd, bucketOpnd, IndirScale4, TyUint32, m_func), insertInstr);
+    InsertCompareBranch(entryOpnd, IR::IntConstOpnd::New(Js::JavascriptMap::MapDataTable::EmptyBucket, TyUint32, m_func, true), Js::OpCode::BrEq_A, labelNotFound, insertInstr);
+    InsertCompareBranch(entryOpnd, IR::IntConstOpnd::New(Js::JavascriptMap::MapDataTable::RemovedBucket, TyUint32, m_func, true), Js::OpCode::BrEq_A, labelNext, insertInstr);
+    InsertSub(false, entryOpnd, entryOpnd, IR::IntConstOpnd::New(1, TyUint32, m_func, true), insertInstr);
+    InsertCompareBranch(IR::IndirOpnd::New(hashesOpnd, entryOpnd, IndirScale4, TyUint32, m_func), hashOpnd, Js::OpCode::BrNeq_A, labelNext, insertInstr);
+    if (varsPerEntryLog2 != 0)
+    {
+        InsertShift(Js::OpCode::Shl_A, false, indexOpnd, entryOpnd, IR::IntConstOpnd::New(varsPerEntryLog2, TyInt8, m_func, true), insertInstr);
+    }
+    else
+    {
+        InsertMove(indexOpnd, entryOpnd, insertInstr);
+    }
+    IR::IndirOpnd * probedKeyOpnd = IR::IndirOpnd::New(storeOpnd, indexOpnd, m_lowererMD.GetDefaultIndirScale(), TyVar, m_func);
+    probedKeyOpnd->SetOffset((int32)(entriesOffset + keyOffset));
+    InsertCompareBranch(keyOpnd, probedKeyOpnd, Js::OpCode::BrEq_A, labelFound, insertInstr);
+    InsertBranch(Js::OpCode::Br, labelDirect, insertInstr);
+
+    // $next:
+    insertInstr->InsertBefore(labelNext);
+    InsertAdd(false, bucketOpnd, bucketOpnd, IR::IntConstOpnd::New(1, TyUint32, m_func, true), insertInstr);
+    InsertAnd(bucketOpnd, bucketOpnd, maskOpnd, insertInstr);
+    InsertBranch(Js::OpCode::Br, labelProbe, insertInstr);
+
+    // $linear:
+    insertInstr->InsertBefore(labelLinear);
+    IR::RegOpnd * endOpnd = IR::RegOpnd::New(TyUint32, m_func);
+    InsertMove(endOpnd, IR::IndirOpnd::New(storeOpnd, (int32)usedOffset, TyUint32, m_func), insertInstr);
+    if (varsPerEntryLog2 != 0)
+    {
+        InsertShift(Js::OpCode::Shl_A, false, endOpnd, endOpnd, IR::IntConstOpnd::New(varsPerEntryLog2, TyInt8, m_func, true), insertInstr);
+    }
+    InsertMove(indexOpnd, IR::IntConstOpnd::New(0, TyUint32, m_func, true), insertInstr);
+
+    // $scan:
+    IR::LabelInstr * labelScan = InsertLoopTopLabel(insertInstr);
+    Loop * scanLoop = labelScan->GetLoop();
+    scanLoop->regAlloc.liveOnBackEdgeSyms->Set(keyOpnd->m_sym->m_id);
+    scanLoop->regAlloc.liveOnBackEdgeSyms->Set(storeOpnd->m_sym->m_id);
+    scanLoop->regAlloc.liveOnBackEdgeSyms->Set(endOpnd->m_sym->m_id);
+    scanLoop->regAlloc.liveOnBackEdgeSyms->Set(indexOpnd->m_sym->m_id);
+    InsertCompareBranch(indexOpnd, endOpnd, Js::OpCode::BrGe_A, true /* isUnsigned */, labelDirect, insertInstr);
+    IR::IndirOpnd * scannedKeyOpnd = IR::IndirOpnd::New(storeOpnd, indexOpnd, m_lowererMD.GetDefaultIndirScale(), TyVar, m_func);
+    scannedKeyOpnd->SetOffset((int32)(entriesOffset + keyOffset));
+    InsertCompareBranch(keyOpnd, scannedKeyOpnd, Js::OpCode::BrEq_A, labelFound, insertInstr);
+    InsertAdd(false, indexOpnd, indexOpnd, IR::IntConstOpnd::New(1 << varsPerEntryLog2, TyUint32, m_func, true), insertInstr);
+    InsertBranch(Js::OpCode::Br, labelScan, insertInstr);
+
+    // $found:
+    insertInstr->InsertBefore(labelFound);
+    if (returnsValue)
+    {
+        IR::IndirOpnd * valueOpnd = IR::IndirOpnd::New(storeOpnd, indexOpnd, m_lowererMD.GetDefaultIndirScale(), TyVar, m_func);
+        valueOpnd->SetOffset((int32)(entriesOffset + valueOffset));
+        InsertMove(instr->GetDst(), valueOpnd, insertInstr);
+    }
+    else
+    {
+        InsertMove(instr->GetDst(), LoadLibraryValueOpnd(insertInstr, LibraryValue::ValueTrue), insertInstr);
+    }
+    InsertBranch(Js::OpCode::Br, doneLabel, insertInstr);
+
+    // $notFound:
+    insertInstr->InsertBefore(labelNotFound);
+    InsertMove(instr->GetDst(), LoadLibraryValueOpnd(insertInstr, returnsValue ? LibraryValue::ValueUndefined : LibraryValue::ValueFalse), insertInstr);
+    InsertBranch(Js::OpCode::Br, doneLabel, insertInstr);
+}
+
 bool
 Lowerer::ShouldGenerateStringReplaceFastPath(IR::Instr * callInstr, IntConstType argCount)
 {
@@ -52,7 +52,7 @@ class Lowerer
     friend class ExternalLowerer;
 
 public:
-    Lowerer(Func * func) : m_func(func), m_lowererMD(func), nextStackFunctionOpnd(nullptr), outerMostLoopLabel(nullptr),
+    Lowerer(Func * func) : m_func(func), m_lowererMD(func), nextStackFunctionOpnd(nullptr), outerMostLoopLabel(nullptr), coldPathEnd(nullptr),
         initializedTempSym(nullptr), addToLiveOnBackEdgeSyms(nullptr), currentRegion(nullptr),
         m_lowerGeneratorHelper(LowerGeneratorHelper(func, this, this->m_lowererMD))
     {
@@ -90,6 +90,8 @@ class Lowerer
     void FinalLower();
     void InsertLazyBailOutThunk();
     void EHBailoutPatchUp();
+    bool DoColdPathLayout() const;
+    bool MarkColdPath(IR::LabelInstr * labelInstr, IR::Instr * endInstr);
     inline Js::ScriptContext* GetScriptContext()
     {
         return m_func->GetScriptContext();
@@ -219,6 +221,7 @@ class Lowerer
     IR::Instr *     LowerMemOp(IR::Instr * instr);
     IR::Instr *     LowerMemset(IR::Instr * instr, IR::RegOpnd * helperRet);
     IR::Instr *     LowerMemcopy(IR::Instr * instr, IR::RegOpnd * helperRet);
+    IR::Instr *     LowerMemarith(IR::Instr * instr, IR::RegOpnd * helperRet);
 
     IR::Instr *     LowerWasmArrayBoundsCheck(IR::Instr * instr, IR::Opnd *addrOpnd);
     IR::Instr *     LowerLdArrViewElem(IR::Instr * instr);
@@ -537,6 +540,9 @@ class Lowerer
     bool            GenerateFastInlineStringReplace(IR::Instr* instr);
     void            GenerateFastInlineIsArray(IR::Instr * instr);
     void            GenerateFastInlineHasOwnProperty(IR::Instr * instr);
+    void            GenerateFastInlineMapOrSetAccess(IR::Instr * instr);
+    void            GenerateMapOrSetTableProbe(IR::Instr * instr, IR::RegOpnd * thisObj, IR::RegOpnd * keyOpnd, Js::TypeId typeId, bool isIntKey,
+                        bool returnsValue, IR::LabelInstr * labelDirect, IR::LabelInstr * doneLabel, IR::Instr * insertInstr);
     void            GenerateFastInlineArrayPush(IR::Instr * instr);
     void            GenerateFastInlineArrayPop(IR::Instr * instr);
     void            GenerateFastInlineStringSplitMatch(IR::Instr * instr);
@@ -602,6 +608,7 @@ class Lowerer
     void            InsertMoveForPolymorphicCacheIndex(IR::Instr * instr, BailOutInfo * bailOutInfo, int bailOutRecordOffset, uint polymorphicCacheIndexValue);
     IR::LabelInstr *GenerateBailOut(IR::Instr * instr, IR::BranchInstr * branchInstr = nullptr, IR::LabelInstr * labelBailOut = nullptr, IR::LabelInstr * collectRuntimeStatsLabel = nullptr);
     void            GenerateJumpToEpilogForBailOut(BailOutInfo * bailOutInfo, IR::Instr *instrAfter, IR::LabelInstr *exitTargetInstr);
+    void            GenerateMaterializedObjectLiterals(BailOutInfo * bailOutInfo, IR::Instr * insertBeforeInstr);
     void            GenerateThrow(IR::Opnd* errorCode, IR::Instr * instr);
     void            LowerDivI4(IR::Instr * const instr);
     void            LowerRemI4(IR::Instr * const instr);
@@ -828,6 +835,7 @@ class Lowerer
     JitArenaAllocator *m_alloc;
     IR::Opnd       * nextStackFunctionOpnd;
     IR::LabelInstr * outerMostLoopLabel;
+    IR::Instr *     coldPathEnd;    // While lowering a block that ends in a throw: the instruction after the throw
     BVSparse<JitArenaAllocator> * initializedTempSym;
     BVSparse<JitArenaAllocator> * addToLiveOnBackEdgeSyms;
     Region *        currentRegion;
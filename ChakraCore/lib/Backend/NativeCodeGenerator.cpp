@@ -30,6 +30,7 @@ NativeCodeGenerator::NativeCodeGenerator(Js::ScriptContext * scriptContext)
     scriptContext(scriptContext),
     pendingCodeGenWorkItems(0),
     queuedFullJitWorkItemCount(0),
+    fullJitQueueSequenceNumber(0),
     foregroundAllocators(nullptr),
     backgroundAllocators(nullptr),
     byteCodeSizeGenerated(0),
@@ -1840,6 +1841,7 @@ NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
             QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->GetQueuedFullJitWorkItem();
             if(queuedFullJitWorkItem)
             {
+                queuedFullJitWorkItem->Prioritize();
                 queuedFullJitWorkItems.MoveToBeginning(queuedFullJitWorkItem);
             }
         }
@@ -2227,6 +2229,7 @@ NativeCodeGenerator::GetJobToProcessProactively()
             QueuedFullJitWorkItem *const queuedFullJitWorkItem = workItem->EnsureQueuedFullJitWorkItem();
             if(queuedFullJitWorkItem) // ignore OOM, this work item just won't be removed from the job processor's queue
             {
+                queuedFullJitWorkItem->OnQueued(fullJitQueueSequenceNumber);
                 queuedFullJitWorkItems.LinkToBeginning(queuedFullJitWorkItem);
                 ++queuedFullJitWorkItemCount;
             }
@@ -3528,9 +3531,17 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     AutoOptionalCriticalSection autoLock(lock ? Processor()->GetCriticalSection() : nullptr);
     scriptContext->GetThreadContext()->RegisterCodeGenRecyclableData(recyclableData);
 
-    // If we have added a lot of jobs that are still waiting to be jitted, remove the oldest job
-    // to ensure we do not spend time jitting stale work items.
     const ExecutionMode jitMode = codeGenWorkItem->GetJitMode();
+    const bool doJitQueuePriority = jitMode == ExecutionMode::FullJit && !PHASE_OFF1(Js::JitQueuePriorityPhase);
+    if(doJitQueuePriority)
+    {
+        ++fullJitQueueSequenceNumber;
+        RemoveColdFullJitWorkItems();
+        SortQueuedFullJitWorkItems();
+    }
+
+    // If we have added a lot of jobs that are still waiting to be jitted, remove the oldest job (or the one with the
+    // lowest priority when the queue is sorted) to ensure we do not spend time jitting stale work items.
     if(jitMode == ExecutionMode::FullJit &&
         queuedFullJitWorkItemCount >= (unsigned int)CONFIG_FLAG(JitQueueThreshold))
     {
@@ -3549,6 +3560,7 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
         QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->EnsureQueuedFullJitWorkItem();
         if(queuedFullJitWorkItem) // ignore OOM, this work item just won't be removed from the job processor's queue
         {
+            queuedFullJitWorkItem->OnQueued(fullJitQueueSequenceNumber);
             if(prioritize)
             {
                 queuedFullJitWorkItems.LinkToBeginning(queuedFullJitWorkItem);
@@ -3558,11 +3570,149 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
                 queuedFullJitWorkItems.LinkToEnd(queuedFullJitWorkItem);
             }
             ++queuedFullJitWorkItemCount;
+
+            if(doJitQueuePriority && prioritize)
+            {
+                // Let the work items that were run while they waited, or that waited the longest, stay in front of this one
+                SortQueuedFullJitWorkItems();
+            }
+        }
+
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        if(doJitQueuePriority && PHASE_TRACE(Js::JitQueuePriorityPhase, codeGenWorkItem->GetFunctionBody()))
+        {
+            Output::Print(_u("JitQueuePriority: queued %s%s for the full JIT\n"),
+                codeGenWorkItem->Type() == JsLoopBodyWorkItemType ? _u("a loop body of ") : _u(""),
+                codeGenWorkItem->GetFunctionBody()->GetDisplayName());
+            Output::Flush();
         }
+#endif
     }
     codeGenWorkItem->OnAddToJitQueue();
 }
 
+// Removes the queued full JIT work items whose loops or functions are still interpreted but were not run since a number of
+// other work items were queued. Their functions re-queue them if they are run enough again.
+void NativeCodeGenerator::RemoveColdFullJitWorkItems()
+{
+    // This function is called from inside the lock
+
+    QueuedFullJitWorkItem *queuedFullJitWorkItem = queuedFullJitWorkItems.Head();
+    while(queuedFullJitWorkItem)
+    {
+        QueuedFullJitWorkItem *const next = queuedFullJitWorkItem->Next();
+        CodeGenWorkItem *const workItem = queuedFullJitWorkItem->WorkItem();
+        if(queuedFullJitWorkItem->IsCold(fullJitQueueSequenceNumber) && Processor()->RemoveJob(workItem))
+        {
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+            if(PHASE_TRACE(Js::JitQueuePriorityPhase, workItem->GetFunctionBody()))
+            {
+                char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+                Output::Print(_u("JitQueuePriority: removed cold work item for %s (%s), interpreted count: %u\n"),
+                    workItem->GetFunctionBody()->GetDisplayName(), workItem->GetFunctionBody()->GetDebugNumberSet(debugStringBuffer),
+                    workItem->GetInterpretedCount());
+                Output::Flush();
+            }
+#endif
+            queuedFullJitWorkItems.Unlink(queuedFullJitWorkItem);
+            --queuedFullJitWorkItemCount;
+            workItem->OnRemoveFromJitQueue(this);
+        }
+        queuedFullJitWorkItem = next;
+    }
+}
+
+// Orders the queued full JIT work items, and their jobs in the job processor's queue, by decreasing priority. Equal
+// priorities keep their order. The queue is short (see JitQueueThreshold), so a selection sort is enough. The job processor's
+// queue is shared with other script contexts, so the jobs are lined up from this context's first queued job onwards, and never
+// moved ahead of the jobs of other contexts, including the ones they prioritized.
+void NativeCodeGenerator::SortQueuedFullJitWorkItems()
+{
+    // This function is called from inside the lock
+
+    const uint count = queuedFullJitWorkItemCount;
+    for(uint sortedCount = 0; sortedCount < count; ++sortedCount)
+    {
+        // The first sortedCount work items have already been moved to the beginning, lowest priority first. Move the one
+        // with the lowest priority among the rest in front of them.
+        QueuedFullJitWorkItem *first = queuedFullJitWorkItems.Head();
+        for(uint i = 0; i < sortedCount; ++i)
+        {
+            first = first->Next();
+        }
+
+        QueuedFullJitWorkItem *lowest = first;
+        uint64 lowestPriority = first->GetPriority(fullJitQueueSequenceNumber);
+        for(QueuedFullJitWorkItem *queuedFullJitWorkItem = first->Next(); queuedFullJitWorkItem; queuedFullJitWorkItem = queuedFullJitWorkItem->Next())
+        {
+            const uint64 priority = queuedFullJitWorkItem->GetPriority(fullJitQueueSequenceNumber);
+            if(priority <= lowestPriority)
+            {
+                lowest = queuedFullJitWorkItem;
+                lowestPriority = priority;
+            }
+        }
+
+        queuedFullJitWorkItems.MoveToBeginning(lowest);
+    }
+
+    // Reorder the jobs in the job processor's queue the same way, but only among the queue slots that this manager's full JIT
+    // jobs already occupy, so that the jobs of other managers keep their places. Jobs that are being processed are no longer
+    // in the queue.
+    const auto getQueuedFullJitWorkItem = [this](JsUtil::Job *const job) -> QueuedFullJitWorkItem *
+    {
+        return job->Manager() == this ? static_cast<CodeGenWorkItem *>(job)->GetQueuedFullJitWorkItem() : nullptr;
+    };
+
+    JsUtil::Job *slot = nullptr;
+    Processor()->ForEachJob([&](JsUtil::Job *const job) -> bool
+    {
+        if(getQueuedFullJitWorkItem(job))
+        {
+            slot = job;
+            return false;
+        }
+        return true;
+    });
+
+    while(slot)
+    {
+        // Find the highest priority job at or after this slot. Equal priorities keep their order.
+        JsUtil::Job *highest = slot;
+        uint64 highestPriority = getQueuedFullJitWorkItem(slot)->GetPriority(fullJitQueueSequenceNumber);
+        for(JsUtil::Job *job = slot->Next(); job; job = job->Next())
+        {
+            QueuedFullJitWorkItem *const queuedFullJitWorkItem = getQueuedFullJitWorkItem(job);
+            if(queuedFullJitWorkItem && queuedFullJitWorkItem->GetPriority(fullJitQueueSequenceNumber) > highestPriority)
+            {
+                highest = job;
+                highestPriority = queuedFullJitWorkItem->GetPriority(fullJitQueueSequenceNumber);
+            }
+        }
+
+        if(highest != slot)
+        {
+            // Swap the two jobs
+            JsUtil::Job *const slotNext = slot->Next();
+            if(slotNext == highest)
+            {
+                Processor()->MoveJobBefore(highest, slot);
+            }
+            else
+            {
+                Processor()->MoveJobBefore(slot, highest);
+                Processor()->MoveJobBefore(highest, slotNext);
+            }
+        }
+
+        slot = highest->Next();
+        while(slot && !getQueuedFullJitWorkItem(slot))
+        {
+            slot = slot->Next();
+        }
+    }
+}
+
 void NativeCodeGenerator::AddWorkItem(CodeGenWorkItem* workitem)
 {
     workitem->ResetJitMode();
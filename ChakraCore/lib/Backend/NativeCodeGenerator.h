@@ -80,6 +80,8 @@ void SetProfileMode(BOOL fSet);
     virtual void JobProcessed(JsUtil::Job *const job, const bool succeeded) override;
     JsUtil::Job *GetJobToProcessProactively();
     void AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem, bool prioritize, bool lock, void* function = nullptr);
+    void RemoveColdFullJitWorkItems();
+    void SortQueuedFullJitWorkItems();
     void RemoveProactiveJobs();
     void UpdateJITState();
     static void LogCodeGenStart(CodeGenWorkItem * workItem, LARGE_INTEGER * start_time);
@@ -196,6 +198,7 @@ void SetProfileMode(BOOL fSet);
     JsUtil::DoublyLinkedList<CodeGenWorkItem> workItems;
     JsUtil::DoublyLinkedList<QueuedFullJitWorkItem> queuedFullJitWorkItems;
     uint queuedFullJitWorkItemCount;
+    uint fullJitQueueSequenceNumber;
     uint byteCodeSizeGenerated;
 
     bool isOptimizedForManyInstances;
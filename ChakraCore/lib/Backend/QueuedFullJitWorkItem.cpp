@@ -4,7 +4,8 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Backend.h"
 
-QueuedFullJitWorkItem::QueuedFullJitWorkItem(CodeGenWorkItem *const workItem) : workItem(workItem)
+QueuedFullJitWorkItem::QueuedFullJitWorkItem(CodeGenWorkItem *const workItem)
+    : workItem(workItem), queuedInterpretedCount(0), queuedSequenceNumber(0), isPrioritized(false)
 {
     Assert(workItem->GetJitMode() == ExecutionMode::FullJit);
 }
@@ -13,3 +14,47 @@ CodeGenWorkItem *QueuedFullJitWorkItem::WorkItem() const
 {
     return workItem;
 }
+
+void QueuedFullJitWorkItem::OnQueued(const uint sequenceNumber)
+{
+    queuedInterpretedCount = workItem->GetInterpretedCount();
+    queuedSequenceNumber = sequenceNumber;
+    isPrioritized = false;
+}
+
+void QueuedFullJitWorkItem::Prioritize()
+{
+    // The main thread asked for this work item, keep it in front of the queue
+    isPrioritized = true;
+}
+
+uint64 QueuedFullJitWorkItem::GetPriority(const uint currentSequenceNumber) const
+{
+    if(isPrioritized)
+    {
+        return UINT64_MAX;
+    }
+
+    // Runs since the work item was queued, plus a bonus for each work item queued after it so that work items whose
+    // functions are not counted while they wait are not starved
+    const uint age = currentSequenceNumber - queuedSequenceNumber;
+    const uint32 interpretedCount = workItem->GetInterpretedCount();
+    const uint32 runsWhileQueued = interpretedCount >= queuedInterpretedCount ? interpretedCount - queuedInterpretedCount : 0;
+    return static_cast<uint64>(runsWhileQueued) + static_cast<uint64>(age) * CONFIG_FLAG(JitQueueAgingWeight);
+}
+
+bool QueuedFullJitWorkItem::IsCold(const uint currentSequenceNumber) const
+{
+    return
+        !isPrioritized &&
+        currentSequenceNumber - queuedSequenceNumber >= static_cast<uint>(CONFIG_FLAG(JitQueueColdAge)) &&
+        HasLiveInterpretedCount() &&
+        workItem->GetInterpretedCount() == queuedInterpretedCount;
+}
+
+bool QueuedFullJitWorkItem::HasLiveInterpretedCount() const
+{
+    // Loop bodies, and functions that go to full JIT straight from the interpreter, keep being interpreted and counted
+    // while they wait. Simple JIT code stops counting once it has requested the full JIT.
+    return workItem->Type() == JsLoopBodyWorkItemType || !workItem->GetFunctionBody()->GetSimpleJitEntryPointInfo();
+}
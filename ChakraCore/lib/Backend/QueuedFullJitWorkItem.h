@@ -10,10 +10,23 @@ class QueuedFullJitWorkItem : public JsUtil::DoublyLinkedListElement<QueuedFullJ
 {
 private:
     CodeGenWorkItem *const workItem;
+    uint32 queuedInterpretedCount;
+    uint queuedSequenceNumber;
+    bool isPrioritized;
 
 public:
     QueuedFullJitWorkItem(CodeGenWorkItem *const workItem);
 
 public:
     CodeGenWorkItem *WorkItem() const;
+
+    // Sequence numbers count the full JIT work items added to the jit queue of a script context, and measure how long a
+    // work item has been waiting
+    void OnQueued(const uint sequenceNumber);
+    void Prioritize();
+    uint64 GetPriority(const uint currentSequenceNumber) const;
+    bool IsCold(const uint currentSequenceNumber) const;
+
+private:
+    bool HasLiveInterpretedCount() const;
 };
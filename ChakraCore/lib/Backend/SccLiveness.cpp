@@ -222,6 +222,7 @@ SCCLiveness::Build()
                 this->curLoop = loop;
                 loop->regAlloc.loopStart = instrNum;
                 loop->regAlloc.loopEnd = lastBranchNum;
+                loop->regAlloc.helperLengthAtStart = this->totalOpHelperFullVisitedLength + CurrentOpHelperVisitedLength(instr);
 
 #if LOWER_SPLIT_INT64
                 func->Int64SplitExtendLoopLifetime(loop);
@@ -579,6 +580,10 @@ SCCLiveness::ProcessStackSymUse(StackSym * stackSym, IR::Instr * instr, int usag
         ExtendLifetime(lifetime, instr);
     }
     lifetime->AddToUseCount(LinearScan::GetUseSpillCost(this->loopNest, (this->lastOpHelperLabel != nullptr)), this->curLoop, this->func);
+    if (this->recordUsePositions && this->lastOpHelperLabel == nullptr)
+    {
+        lifetime->AddUsePosition(instr->GetNumber() - this->totalOpHelperFullVisitedLength);
+    }
     if (lifetime->start < this->lastCall)
     {
         lifetime->isLiveAcrossCalls = true;
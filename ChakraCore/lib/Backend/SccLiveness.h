@@ -43,9 +43,10 @@ class SCCLiveness
     IR::LabelInstr * lastOpHelperLabel;
     Region *        curRegion;
     SListBase<Loop*> * extendedLifetimesLoopList;
+    bool            recordUsePositions;
 public:
-    SCCLiveness(Func *func, JitArenaAllocator *tempAlloc) : func(func),
-        tempAlloc(tempAlloc), loopNest(0), lastCall(0), lastNonOpHelperCall(0),
+    SCCLiveness(Func *func, JitArenaAllocator *tempAlloc, bool recordUsePositions = false) : func(func),
+        tempAlloc(tempAlloc), loopNest(0), lastCall(0), lastNonOpHelperCall(0), recordUsePositions(recordUsePositions),
         curLoop(NULL), lastOpHelperLabel(NULL), opHelperBlockList(tempAlloc),
         curRegion(NULL), lifetimeList(tempAlloc),
         totalOpHelperFullVisitedLength(0)
@@ -9,6 +9,14 @@
 #define _Analysis_assume_(expr)
 #endif
 
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(CHAKRA_NEON_DISABLED)
+#include <arm_neon.h>
+#define UTF8_CODEX_NEON 1
+#elif defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define UTF8_CODEX_SSE2 1
+#endif
+
 #ifdef _MSC_VER
 //=============================
 // Disabled Warnings
@@ -29,14 +37,137 @@ namespace utf8
         return (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
     }
 
-    inline bool IsAligned(LPCOLESTR pch)
+    inline bool IsTrailByteFast(utf8char_t ch)
     {
-        return (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
+        return (ch & 0xC0) == 0x80;
+    }
+
+#if UTF8_CODEX_SSE2
+    inline unsigned int CountTrailingZeros(unsigned int mask)
+    {
+        CodexAssert(mask != 0);
+#if defined(_MSC_VER) && !defined(__clang__)
+        unsigned long index;
+        _BitScanForward(&index, mask);
+        return index;
+#else
+        return __builtin_ctz(mask);
+#endif
+    }
+#endif
+
+    // Widen the run of ASCII bytes at the start of src into dest, 16 bytes per step where SSE2 or NEON is
+    // available (8 bytes per step otherwise). Returns the number of bytes (== units) converted; src[result]
+    // is either past cb or a non-ASCII byte. Only the converted units are written: callers such as the scanner
+    // size dest by character count, so there may be no room for a whole block past a multi-byte sequence.
+    inline size_t DecodeAsciiRun(__out_ecount(cb) char16 *dest, __in_ecount(cb) LPCUTF8 src, size_t cb)
+    {
+        size_t i = 0;
+
+#if UTF8_CODEX_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= cb; i += 16)
+        {
+            __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            int nonAscii = _mm_movemask_epi8(bytes);
+            if (nonAscii != 0)
+            {
+                // Finish the ASCII prefix of this block below; the scalar loop stops at the first lead byte.
+                const size_t prefixEnd = i + CountTrailingZeros(nonAscii);
+                for (; i < prefixEnd; i++)
+                {
+                    dest[i] = static_cast<char16>(src[i]);
+                }
+                return i;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(bytes, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(bytes, zero));
+        }
+#elif UTF8_CODEX_NEON
+        for (; i + 16 <= cb; i += 16)
+        {
+            uint8x16_t bytes = vld1q_u8(src + i);
+            if (vmaxvq_u8(bytes) >= 0x80)
+            {
+                break;
+            }
+            vst1q_u16(reinterpret_cast<uint16_t *>(dest + i), vmovl_u8(vget_low_u8(bytes)));
+            vst1q_u16(reinterpret_cast<uint16_t *>(dest + i + 8), vmovl_high_u8(bytes));
+        }
+#else
+        for (; i + 8 <= cb; i += 8)
+        {
+            unsigned __int64 bytes;
+            memcpy(&bytes, src + i, sizeof(bytes));
+            if ((bytes & 0x8080808080808080ull) != 0)
+            {
+                break;
+            }
+            for (size_t j = 0; j < 8; j++)
+            {
+                dest[i + j] = static_cast<char16>(src[i + j]);
+            }
+        }
+#endif
+
+        for (; i < cb && src[i] < 0x80; i++)
+        {
+            dest[i] = static_cast<char16>(src[i]);
+        }
+        return i;
     }
 
-    inline bool ShouldFastPath(LPCUTF8 pb, LPCOLESTR pch)
+    // Narrow the run of ASCII units at the start of src into dest, 16 units per step where SSE2 or NEON is
+    // available. Returns the number of units (== bytes) converted; src[result] is either past cch or non-ASCII.
+    template <bool countBytesOnly>
+    inline charcount_t EncodeAsciiRun(LPUTF8 dest, const utf8char_t *bufferEnd, __in_ecount(cch) const char16 *src, charcount_t cch)
     {
-        return (reinterpret_cast<size_t>(pb) & mAlignmentMask) == 0 && (reinterpret_cast<size_t>(pch) & mAlignmentMask) == 0;
+        charcount_t i = 0;
+
+#if UTF8_CODEX_SSE2
+        const __m128i nonAsciiBits = _mm_set1_epi16(static_cast<short>(0xFF80));
+        const __m128i zero = _mm_setzero_si128();
+        for (; i + 16 <= cch; i += 16)
+        {
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 8));
+            __m128i bits = _mm_and_si128(_mm_or_si128(low, high), nonAsciiBits);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(bits, zero)) != 0xFFFF)
+            {
+                break;
+            }
+            if (!countBytesOnly)
+            {
+                CodexAssertOrFailFast(dest + i + 16 <= bufferEnd);
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(low, high));
+            }
+        }
+#elif UTF8_CODEX_NEON
+        for (; i + 16 <= cch; i += 16)
+        {
+            uint16x8_t low = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i));
+            uint16x8_t high = vld1q_u16(reinterpret_cast<const uint16_t *>(src + i + 8));
+            if (vmaxvq_u16(vorrq_u16(low, high)) >= 0x80)
+            {
+                break;
+            }
+            if (!countBytesOnly)
+            {
+                CodexAssertOrFailFast(dest + i + 16 <= bufferEnd);
+                vst1q_u8(dest + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+            }
+        }
+#endif
+
+        for (; i < cch && src[i] < 0x80; i++)
+        {
+            if (!countBytesOnly)
+            {
+                CodexAssertOrFailFast(dest + i < bufferEnd);
+                dest[i] = static_cast<utf8char_t>(src[i]);
+            }
+        }
+        return i;
     }
 
     inline size_t EncodedBytes(char16 prefix)
@@ -347,22 +478,43 @@ namespace utf8
         LPCUTF8 p = pbUtf8;
         char16 *dest = buffer;
 
-        if (!ShouldFastPath(p, dest)) goto LSlowPath;
-
-LFastPath:
-        while (p + 3 < pbEnd)
-        {
-            unsigned bytes = *(unsigned *)p;
-            if ((bytes & 0x80808080) != 0) goto LSlowPath;
-            ((uint32 *)dest)[0] = (char16(bytes) & 0x00FF) | ((char16(bytes) & 0xFF00) << 8);
-            ((uint32 *)dest)[1] = (char16(bytes >> 16) & 0x00FF) | ((char16(bytes >> 16) & 0xFF00) << 8);
-            p += 4;
-            dest += 4;
-        }
-
-LSlowPath:
         while (p < pbEnd)
         {
+            // Sequences that can be decoded without consulting the options are handled inline. Everything
+            // else (invalid or truncated input, surrogates, noncharacters, 4-byte sequences and the second
+            // half of a surrogate pair) goes through Decode, which applies the options.
+            if ((localOptions & doSecondSurrogatePair) == 0)
+            {
+                utf8char_t c1 = *p;
+                if (c1 < 0x80)
+                {
+                    size_t converted = DecodeAsciiRun(dest, p, pbEnd - p);
+                    p += converted;
+                    dest += converted;
+                    continue;
+                }
+
+                if (InRange(c1, 0xC2, 0xDF) && p + 1 < pbEnd && IsTrailByteFast(p[1]))
+                {
+                    // U+0080..U+07FF, always a valid wide char
+                    *dest++ = static_cast<char16>((WCHAR(c1 & 0x1F) << 6) | WCHAR(p[1] & 0x3F));
+                    p += 2;
+                    continue;
+                }
+
+                if (InRange(c1, 0xE0, 0xEF) && p + 2 < pbEnd && IsTrailByteFast(p[1]) && IsTrailByteFast(p[2]))
+                {
+                    // U+0800..U+FDCF excluding surrogates; overlong forms (E0 80..9F) are left to Decode
+                    char16 ch = static_cast<char16>((WCHAR(c1 & 0x0F) << 12) | (WCHAR(p[1] & 0x3F) << 6) | WCHAR(p[2] & 0x3F));
+                    if (ch >= 0x0800 && ch < 0xFDD0 && !IsHighSurrogateChar(ch) && !IsLowSurrogateChar(ch))
+                    {
+                        *dest++ = ch;
+                        p += 3;
+                        continue;
+                    }
+                }
+            }
+
             LPCUTF8 s = p;
             char16 chDest = Decode(p, pbEnd, localOptions, chunkEndsAtTruncatedSequence);
 
@@ -376,8 +528,6 @@ namespace utf8
                 // Nothing was converted. This might happen at the end of a buffer with doChunkedEncoding.
                 break;
             }
-
-            if (ShouldFastPath(p, dest)) goto LFastPath;
         }
 
         pbUtf8 = p;
@@ -426,45 +576,29 @@ namespace utf8
 
         CodexAssertOrFailFast(dest <= bufferEnd);
 
-        if (!ShouldFastPath(dest, source)) goto LSlowPath;
-
-LFastPath:
-        while (cch >= 4)
+        while (cch > 0)
         {
-            uint32 first = ((const uint32 *)source)[0];
-            if ( (first & 0xFF80FF80) != 0) goto LSlowPath;
-            uint32 second = ((const uint32 *)source)[1];
-            if ( (second & 0xFF80FF80) != 0) goto LSlowPath;
-
-            if (!countBytesOnly)
+            if (*source < 0x80)
             {
-                CodexAssertOrFailFast(dest + 4 <= bufferEnd);
-                *(uint32 *)dest = (first & 0x0000007F) | ((first & 0x007F0000) >> 8) | ((second & 0x0000007f) << 16) | ((second & 0x007F0000) << 8);
+                charcount_t converted = EncodeAsciiRun<countBytesOnly>(dest, bufferEnd, source, cch);
+                dest += converted;
+                source += converted;
+                cch -= converted;
+                continue;
             }
-            dest += 4;
-            source += 4;
-            cch -= 4;
-        }
 
-LSlowPath:
-        if (encoding == Utf8EncodingKind::Cesu8)
-        {
-            while (cch-- > 0)
+            cch--;
+            if (encoding == Utf8EncodingKind::Cesu8)
             {
                 dest = Encode<countBytesOnly>(*source++, dest, bufferEnd);
-                if (ShouldFastPath(dest, source)) goto LFastPath;
             }
-        }
-        else
-        {
-            while (cch-- > 0)
+            else
             {
                 // We increment the source pointer here since at least one utf16 code unit is read here
                 // If the code unit turns out to be the high surrogate in a surrogate pair, then
                 // EncodeTrueUtf8 will consume the low surrogate code unit too by decrementing cch
                 // and incrementing source
                 dest = EncodeTrueUtf8<countBytesOnly>(*source++, &source, &cch, dest, bufferEnd);
-                if (ShouldFastPath(dest, source)) goto LFastPath;
             }
         }
 
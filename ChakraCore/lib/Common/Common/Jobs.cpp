@@ -335,6 +335,21 @@ namespace JsUtil
         return true;
     }
 
+    bool JobProcessor::MoveJobBefore(Job *const job, Job *const nextJob)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(nextJob);
+        Assert(job != nextJob);
+        Assert(managers.Contains(job->Manager()));
+        Assert(!IsClosed());
+
+        jobs.Unlink(job);
+        jobs.LinkBefore(job, nextJob);
+        return true;
+    }
+
     void JobProcessor::JobProcessed(JobManager *const manager, Job *const job, const bool succeeded)
     {
         Assert(manager);
@@ -1033,6 +1048,22 @@ namespace JsUtil
         return __super::RemoveJob(job);
     }
 
+    bool BackgroundJobProcessor::MoveJobBefore(Job *const job, Job *const nextJob)
+    {
+        // This function is called from inside the lock
+
+        Assert(job);
+        Assert(nextJob);
+        Assert(managers.Contains(job->Manager()));
+        Assert(!IsClosed());
+
+        if (IsBeingProcessed(job))
+        {
+            return false;
+        }
+        return __super::MoveJobBefore(job, nextJob);
+    }
+
     bool BackgroundJobProcessor::Process(Job *const job, ParallelThreadData *threadData)
     {
         try
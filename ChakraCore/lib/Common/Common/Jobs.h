@@ -345,6 +345,10 @@ namespace JsUtil
         // Must be called from inside the lock
         virtual bool RemoveJob(Job *const job);
 
+        // Moves a queued job in front of another queued job, which may belong to a different manager. Returns false if the
+        // job is already being processed. Must be called from inside the lock.
+        virtual bool MoveJobBefore(Job *const job, Job *const nextJob);
+
         // Must be called from inside the lock
         template<class Fn> void ForEachJob(Fn fn);
 
@@ -507,6 +511,7 @@ namespace JsUtil
 
         virtual void AddJob(Job *const job, const bool prioritize = false) override;
         virtual bool RemoveJob(Job *const job) override;
+        virtual bool MoveJobBefore(Job *const job, Job *const nextJob) override;
 
         template<class TJobManager, class TJobHolder>
         void AddJobAndProcessProactively(TJobManager *const jobManager, const TJobHolder holder);
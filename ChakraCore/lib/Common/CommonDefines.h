@@ -260,6 +260,7 @@
 #if DISABLE_JIT
 #define ENABLE_NATIVE_CODEGEN 0
 #define ENABLE_PROFILE_INFO 0
+#define ENABLE_TIER_UP_CACHE 0
 #define ENABLE_BACKGROUND_JOB_PROCESSOR 0
 #define ENABLE_BACKGROUND_PARSING 0                 // Disable background parsing in this mode
                                                     // We need to decouple the Jobs infrastructure out of
@@ -271,6 +272,7 @@
 // By default, enable the JIT
 #define ENABLE_NATIVE_CODEGEN 1
 #define ENABLE_PROFILE_INFO 1
+#define ENABLE_TIER_UP_CACHE 1                     // Keep the profiles of fully jitted functions across runs (-TierUpCache)
 
 #define ENABLE_BACKGROUND_JOB_PROCESSOR 1
 #define ENABLE_COPYONACCESS_ARRAY 1
@@ -294,12 +296,20 @@
 #endif
 
 #if ENABLE_NATIVE_CODEGEN
+// Out of process JIT is Windows only: the JIT client and server talk over the RPC
+// interface in ChakraJIT.idl, which has no transport on other platforms.
 #ifdef _WIN32
 #define ENABLE_OOP_NATIVE_CODEGEN 1     // Out of process JIT
 #endif
 
 // ToDo (SaAgarwa): Disable VirtualTypedArray on ARM64 till we make sure it works correctly
-#if defined(_WIN32) && defined(TARGET_64) && !defined(_M_ARM64)
+// On Linux out of bounds accesses fault into the PAL's signal handlers, which hand
+// them to JavascriptFunction::HardwareExceptionFilter. That is opt-in (build with
+// -DLINUX_FAST_ARRAYBUFFER, which the PAL must be built with as well) until
+// test/AsmJs/outOfBoundsHeapAccess.js and test/wasm/outOfBoundsAccess.js pass with
+// it on Linux; until then jitted code keeps its bounds checks and the PAL's signal
+// handlers are unchanged.
+#if defined(TARGET_64) && !defined(_M_ARM64) && (defined(_WIN32) || (defined(__linux__) && defined(LINUX_FAST_ARRAYBUFFER)))
 #define ENABLE_FAST_ARRAYBUFFER 1
 #endif
 #endif
@@ -423,6 +433,10 @@
 #endif
 #endif // ENABLE_DEBUG_CONFIG_OPTIONS
 
+#if defined(DYNAMIC_PROFILE_STORAGE) || ENABLE_TIER_UP_CACHE
+#define DYNAMIC_PROFILE_SERIALIZATION
+#endif
+
 ////////
 //Time Travel flags
 //Include TTD code in the build when building for Chakra (except NT/Edge) or for debug/test builds
@@ -45,3 +45,4 @@ class FinalizableObject;
 #include "Memory/MarkContextWrapper.h"
 #include "Memory/RecyclerWatsonTelemetry.h"
 #include "Memory/Recycler.h"
+#include "Memory/RecyclerEphemeronTable.h"
@@ -47,6 +47,7 @@ PHASE(All)
         PHASE(OptimizeBlockScope)
     PHASE(Delay)
         PHASE(Speculation)
+        PHASE(JitQueuePriority)
         PHASE(GatherCodeGenData)
     PHASE_DEFAULT_ON(Wasm)
         // Wasm frontend
@@ -109,6 +110,7 @@ PHASE(All)
             PHASE(OptimizeTryFinally)
             PHASE(RemoveBreakBlock)
             PHASE(TailDup)
+            PHASE(LoopUnroll)
         PHASE(FGPeeps)
         PHASE(GlobOpt)
             PHASE(PathDepBranchFolding)
@@ -210,11 +212,13 @@ PHASE(All)
                 PHASE(MemOp)
                     PHASE(MemSet)
                     PHASE(MemCopy)
+                    PHASE(MemArith)
                 PHASE(NeonSimd)
                     PHASE(NeonVectorize)
                 PHASE(IncrementalBailout)
             PHASE(DeadStore)
                 PHASE(ReverseCopyProp)
+                PHASE(ScalarReplacement)
                 PHASE(MarkTemp)
                     PHASE(MarkTempNumber)
                     PHASE(MarkTempObject)
@@ -240,6 +244,7 @@ PHASE(All)
                 PHASE(ArrayCtorFastPath)
                 PHASE(NewScopeSlotFastPath)
                 PHASE(FrameDisplayFastPath)
+                PHASE(MapSetFastPath)
                 PHASE(HoistMarkTempInit)
                 PHASE(HoistConstAddr)
             PHASE(JitWriteBarrier)
@@ -257,10 +262,12 @@ PHASE(All)
                 PHASE(StackPack)
                 PHASE(SecondChance)
                 PHASE(RegionUseCount)
+                PHASE(NextUseSpillCost)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
         PHASE(Peeps)
         PHASE(Layout)
+            PHASE(ColdPathLayout)
         PHASE(EHBailoutPatchUp)
         PHASE(FinalLower)
         PHASE(PrologEpilog)
@@ -326,6 +333,7 @@ PHASE(All)
                 PHASE(Finalize)
                 PHASE(Dispose)
                 PHASE(FinishPartial)
+            PHASE(StringDedup)
         PHASE(Host)
         PHASE(BailOut)
         PHASE(BailIn)
@@ -349,6 +357,7 @@ PHASE(All)
             PHASE(ObjectHeaderInliningForEmptyObjects)
         PHASE(OptUnknownElementName)
         PHASE(TypePropertyCache)
+            PHASE(MegamorphicPropertyCache)
 #if DBG_DUMP
         PHASE(InlineSlots)
 #endif
@@ -385,6 +394,8 @@ PHASE(All)
         PHASE(ConsoleScope)
         PHASE(ScriptProfiler)
         PHASE(JSON)
+            PHASE(JSONStructuralIndex)
+            PHASE(JSONRecordShape)
         PHASE(Intl)
         PHASE(RegexResultNotUsed)
         PHASE(Error)
@@ -723,6 +734,8 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeCount (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_JitQueueAgingWeight    (8)      // Priority a queued full JIT work item gains for each full JIT work item queued after it
+#define DEFAULT_CONFIG_JitQueueColdAge        (16)     // Number of full JIT work items queued after an interpreted work item that was not run meanwhile, before it is removed from the jit queue
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -832,6 +845,10 @@ PHASE(All)
 
 #define DEFAULT_CONFIG_MinMemOpCount (16U)
 #define DEFAULT_CONFIG_MinNeonSimdLoopCount (16U)
+#define DEFAULT_CONFIG_MinLoopUnrollCount (64U)
+#define DEFAULT_CONFIG_LoopUnrollFactor (4U)
+#define DEFAULT_CONFIG_MaxLoopUnrollSize (24U)
+#define DEFAULT_CONFIG_MinNextUseSpillCostLoopWeight (25U)
 
 #if ENABLE_COPYONACCESS_ARRAY
 #define DEFAULT_CONFIG_MaxCopyOnAccessArrayLength (32U)
@@ -1054,6 +1071,7 @@ FLAGNR(NumberTrioSet,  StatementDebugBreak, "Index of the statement where you wa
 FLAGNR(Phases,  DebugBreakOnPhaseBegin, "Break into debugger at the beginning of given phase for listed function", )
 
 FLAGNR(Boolean, DebugWindow           , "Send console output to debugger window", false)
+FLAGR (Boolean, DedupStrings          , "Deduplicate the buffers of long-lived strings created from external data (JSON.parse, JsCreateString) during garbage collection", false)
 FLAGNR(Boolean, ParserStateCache      , "Enable creation of parser state cache", DEFAULT_CONFIG_ParserStateCache)
 FLAGNR(Boolean, CompressParserStateCache, "Enable compression of the parser state cache", DEFAULT_CONFIG_CompressParserStateCache)
 FLAGNR(Boolean, DeferTopLevelTillFirstCall      , "Enable tracking of deferred top level functions in a script file, until the first function of the script context is parsed.", DEFAULT_CONFIG_DeferTopLevelTillFirstCall)
@@ -1087,6 +1105,9 @@ FLAGNR(Boolean, WininetProfileCache, "Use the WININET cache to save the profile
 FLAGNR(Boolean, NoDynamicProfileInMemoryCache, "Enable in-memory cache for dynamic sources", false)
 FLAGNR(Boolean, ProfileBasedSpeculativeJit, "Enable dynamic profile based speculative JIT", DEFAULT_CONFIG_ProfileBasedSpeculativeJit)
 FLAGNR(Number,  ProfileBasedSpeculationCap, "In the presence of dynamic profile speculative JIT is capped to this many bytecode instructions", DEFAULT_CONFIG_ProfileBasedSpeculationCap)
+#if ENABLE_TIER_UP_CACHE
+FLAGR (String,  TierUpCache           , "File to keep the profiles of fully jitted functions in across runs, so that they are jitted right away on the next run", nullptr)
+#endif
 #ifdef DYNAMIC_PROFILE_MUTATOR
 FLAGNR(String,  DynamicProfileMutatorDll , "Path of the mutator DLL", _u("DynamicProfileMutatorImpl.dll"))
 FLAGNR(String,  DynamicProfileMutator , "Type of local, temp, return, param, loop implicit flag and implicit flag. \n\t\t\t\t\ti.e local=LikelyArray_NoMissingValues_NonInts_NonFloats;temp=Int8Array;param=LikelyNumber;return=LikelyString;loopimplicitflag=ImplicitCall_ToPrimitive;implicitflag=ImplicitCall_None\n\t\t\t\t\tor pass DynamicProfileMutator:random\n\t\t\t\t\tSee DynamicProfileInfo.h for enum values", nullptr)
@@ -1308,6 +1329,8 @@ FLAGNR(Number,  AsmJsInlineAdjust       , "Adjustment in the maximum size in byt
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  JitQueueAgingWeight   , "Priority that a queued full JIT work item gains for each full JIT work item queued after it", DEFAULT_CONFIG_JitQueueAgingWeight)
+FLAGNR(Number,  JitQueueColdAge       , "Number of full JIT work items queued after an interpreted work item that did not run meanwhile, before it is removed from the jit queue", DEFAULT_CONFIG_JitQueueColdAge)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
@@ -1368,6 +1391,10 @@ FLAGNRA(Number, MaxInterpretCount     , Mic, "Maximum number of times a function
 FLAGNRA(Number, MaxSimpleJitRunCount  , Msjrc, "Maximum number of times a function will be run in SimpleJitted code", 0)
 FLAGNRA(Number, MinMemOpCount         , Mmoc, "Minimum count of a loop to activate MemOp", DEFAULT_CONFIG_MinMemOpCount)
 FLAGNRA(Number, MinNeonSimdLoopCount  , Mnslc, "Minimum loop iteration count to activate NEON SIMD vectorization (FullJit only)", DEFAULT_CONFIG_MinNeonSimdLoopCount)
+FLAGNRA(Number, MinLoopUnrollCount    , Mluc, "Minimum iteration count of an interpreted loop to unroll it in the full JIT", DEFAULT_CONFIG_MinLoopUnrollCount)
+FLAGNR(Number,  LoopUnrollFactor      , "Number of copies of the loop body that an unrolled loop runs per back edge", DEFAULT_CONFIG_LoopUnrollFactor)
+FLAGNR(Number,  MaxLoopUnrollSize     , "Maximum number of instructions in the body of a loop to unroll", DEFAULT_CONFIG_MaxLoopUnrollSize)
+FLAGNR(Number,  MinNextUseSpillCostLoopWeight, "Minimum percentage of a function's byte code inside loops for the register allocator to weigh spill costs by the distance to the next use", DEFAULT_CONFIG_MinNextUseSpillCostLoopWeight)
 
 #if ENABLE_COPYONACCESS_ARRAY
 FLAGNR(Number,  MaxCopyOnAccessArrayLength, "Maximum length of copy-on-access array", DEFAULT_CONFIG_MaxCopyOnAccessArrayLength)
@@ -32,6 +32,9 @@ namespace JsUtil
 
         TValue Value() { return value; }
         TValue Value() const { return value; }
+
+        static uint32 GetOffsetOfKey() { return offsetof(KeyValuePair, key); }
+        static uint32 GetOffsetOfValue() { return offsetof(KeyValuePair, value); }
     };
 
 }
@@ -17,7 +17,8 @@ MarkContext::MarkContext(Recycler * recycler, PagePool * pagePool) :
 #ifdef RECYCLER_VISITED_HOST
     preciseStack(pagePool),
 #endif
-    trackStack(pagePool)
+    trackStack(pagePool),
+    ephemeronKeyIndex(nullptr)
 {
 }
 
@@ -132,5 +133,41 @@ void MarkContext::ProcessTracked()
     trackStack.Release();
 }
 
+uint MarkContext::MarkEphemeronValues(RecyclerEphemeronTableBase * table, RecyclerEphemeronKeyIndex * pendingIndex)
+{
+    // Script may swap in a new store while we run in the background; the old
+    // one stays intact and the in-thread pass will see the new one.
+    RecyclerEphemeronTableBase::Store * store = table->store;
+    if (store == nullptr)
+    {
+        return 0;
+    }
+
+    uint liveCount = 0;
+    for (uint32 i = 0; i < store->capacity; i++)
+    {
+        void * key = store->entries[i].key;
+        if (!RecyclerEphemeronTableBase::IsLiveKey(key))
+        {
+            continue;
+        }
+
+        if (!recycler->heapBlockMap.IsMarked(key))
+        {
+            if (pendingIndex != nullptr)
+            {
+                // If the index is full, a later pass over the tables will find this entry
+                pendingIndex->Add(key, store->entries[i].value);
+            }
+            continue;
+        }
+
+        liveCount++;
+        this->Mark</* parallel */ false, /* interior */ false, /* doSpecialMark */ false>(store->entries[i].value, key);
+    }
+
+    return liveCount;
+}
+
 
 
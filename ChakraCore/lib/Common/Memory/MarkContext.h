@@ -7,6 +7,8 @@ interface IRecyclerVisitedObject;
 namespace Memory
 {
 class Recycler;
+class RecyclerEphemeronTableBase;
+class RecyclerEphemeronKeyIndex;
 
 typedef JsUtil::SynchronizedDictionary<void *, void *, NoCheckHeapAllocator, PrimeSizePolicy, RecyclerPointerComparer, JsUtil::SimpleDictionaryEntry, Js::DefaultContainerLockPolicy, CriticalSection> MarkMap;
 
@@ -56,6 +58,11 @@ class MarkContext
     template <bool parallel, bool interior>
     void ProcessMark();
 
+    uint MarkEphemeronValues(RecyclerEphemeronTableBase * table, RecyclerEphemeronKeyIndex * pendingIndex);
+    template <bool parallel>
+    void MarkEphemeronValuesOfKey(void * key);
+    void SetEphemeronKeyIndex(RecyclerEphemeronKeyIndex * index) { this->ephemeronKeyIndex = index; }
+
     void MarkTrackedObject(FinalizableObject * obj);
     void ProcessTracked();
 
@@ -133,6 +140,7 @@ class MarkContext
     PageStack<IRecyclerVisitedObject*> preciseStack;
 #endif
     PageStack<FinalizableObject *> trackStack;
+    RecyclerEphemeronKeyIndex * ephemeronKeyIndex;
 
 #ifdef RECYCLER_MARK_TRACK
     MarkMap* markMap;
@@ -148,11 +148,26 @@ void MarkContext::ScanObject(void ** obj, size_t byteCount)
 {
     BEGIN_DUMP_OBJECT(recycler, obj);
 
+    if (this->ephemeronKeyIndex != nullptr)
+    {
+        this->MarkEphemeronValuesOfKey<parallel>(obj);
+    }
+
     ScanMemory<parallel, interior, false>(obj, byteCount);
 
     END_DUMP_OBJECT(recycler);
 }
 
+template <bool parallel>
+inline
+void MarkContext::MarkEphemeronValuesOfKey(void * key)
+{
+    this->ephemeronKeyIndex->MapValues(key, [&](void * value)
+    {
+        this->Mark<parallel, /* interior */ false, /* doSpecialMark */ false>(value, key);
+    });
+}
+
 
 template <bool parallel, bool interior, bool doSpecialMark>
 inline
@@ -191,6 +191,8 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
 #if ENABLE_WEAK_REFERENCE_REGIONS
     weakReferenceRegionList(HeapAllocator::GetNoMemProtectInstance()),
 #endif
+    ephemeronTableList(HeapAllocator::GetNoMemProtectInstance()),
+    pendingEphemeronTableList(HeapAllocator::GetNoMemProtectInstance()),
     collectionWrapper(&DefaultRecyclerCollectionWrapper::Instance),
     isScriptActive(false),
     isInScript(false),
@@ -2778,6 +2780,7 @@ Recycler::FinishWrapperObjectTracing()
     {
         this->collectionWrapper->EndMarkDomWrapperTracingCallback();
         this->ProcessMark(false);
+        this->MarkEphemerons(false);
     } while (!this->collectionWrapper->EndMarkDomWrapperTracingDoneCallback());
 
     // This is just to wait until tracing has finished.
@@ -2785,6 +2788,149 @@ Recycler::FinishWrapperObjectTracing()
     this->ClearNeedExternalWrapperTracing();
 }
 
+void
+Recycler::FinishMark()
+{
+    // Drain the mark stack along with any required DOM wrapper tracing, then keep marking the values
+    // of ephemeron entries whose keys are marked until nothing new is found.
+    if (this->needExternalWrapperTracing)
+    {
+        this->FinishWrapperObjectTracing();
+    }
+    else
+    {
+        this->ProcessMark(false);
+        this->MarkEphemerons(false);
+    }
+}
+
+void
+Recycler::AddPendingEphemeronTables()
+{
+    // Only in-thread, when no background work can be walking ephemeronTableList
+    this->pendingEphemeronTableList.MoveTo(&this->ephemeronTableList);
+}
+
+uint
+Recycler::MarkEphemeronTables(RecyclerEphemeronKeyIndex * pendingIndex, uint * entryCount)
+{
+    uint liveCount = 0;
+    *entryCount = 0;
+    auto iterator = this->ephemeronTableList.GetIterator();
+    while (iterator.Next())
+    {
+        RecyclerEphemeronTableBase * table = iterator.Data();
+
+        // Tables that are not reachable keep nothing alive
+        if (this->heapBlockMap.IsMarked(table))
+        {
+            *entryCount += table->count;
+            liveCount += markContext.MarkEphemeronValues(table, pendingIndex);
+        }
+    }
+    return liveCount;
+}
+
+void
+Recycler::SetEphemeronKeyIndex(RecyclerEphemeronKeyIndex * index)
+{
+    markContext.SetEphemeronKeyIndex(index);
+    parallelMarkContext1.SetEphemeronKeyIndex(index);
+    parallelMarkContext2.SetEphemeronKeyIndex(index);
+    parallelMarkContext3.SetEphemeronKeyIndex(index);
+}
+
+void
+Recycler::ProcessEphemeronMark(bool background)
+{
+#if ENABLE_CONCURRENT_GC
+    if (background)
+    {
+        this->DoBackgroundParallelMark();
+        return;
+    }
+
+    if (this->enableParallelMark)
+    {
+        this->DoParallelMark();
+        return;
+    }
+#endif
+
+    this->ProcessMark(false);
+}
+
+void
+Recycler::MarkEphemerons(bool background)
+{
+    if (!background)
+    {
+        this->AddPendingEphemeronTables();
+    }
+
+    uint entryCount = 0;
+    auto iterator = this->ephemeronTableList.GetIterator();
+    while (iterator.Next())
+    {
+        if (this->heapBlockMap.IsMarked(iterator.Data()))
+        {
+            entryCount += iterator.Data()->count;
+        }
+    }
+
+    if (entryCount == 0)
+    {
+        return;
+    }
+
+    // Mark the values of the entries whose keys are marked, and index the other entries by key
+    // so that draining the mark stack marks their values as soon as it scans their keys.
+    uint liveCount;
+    uint32 indexCapacity = ::Math::NextPowerOf2(entryCount * 2);
+    RecyclerEphemeronKeyIndex::Entry * indexEntries = HeapNewNoThrowArrayZ(RecyclerEphemeronKeyIndex::Entry, indexCapacity);
+    if (indexEntries != nullptr)
+    {
+        RecyclerEphemeronKeyIndex pendingIndex(indexEntries, indexCapacity);
+        liveCount = this->MarkEphemeronTables(&pendingIndex, &entryCount);
+
+        this->SetEphemeronKeyIndex(&pendingIndex);
+        this->ProcessEphemeronMark(background);
+        this->SetEphemeronKeyIndex(nullptr);
+
+        HeapDeleteArray(indexCapacity, indexEntries);
+    }
+    else
+    {
+        liveCount = this->MarkEphemeronTables(nullptr, &entryCount);
+        this->ProcessEphemeronMark(background);
+    }
+
+    // Then pass over the tables until a pass reaches no more keys. Keys never become unmarked,
+    // so once a pass finds no more entries with marked keys than the previous one, every reachable
+    // value has been marked. This picks up what the index could not, such as keys that are leaf
+    // objects and so are never scanned, and usually takes one pass. In the background script may
+    // change the tables under us, so there we only make a bounded number of passes and leave the
+    // rest to the in-thread pass in EndMark.
+    for (uint pass = 0; liveCount != entryCount; pass++)
+    {
+#if ENABLE_CONCURRENT_GC
+        if (background && (this->NeedOOMRescan() || this->isAborting || pass == RecyclerHeuristic::MaxBackgroundEphemeronPassCount))
+        {
+            return;
+        }
+#endif
+
+        uint lastLiveCount = liveCount;
+        liveCount = this->MarkEphemeronTables(nullptr, &entryCount);
+        if (liveCount == lastLiveCount)
+        {
+            break;
+        }
+
+        this->ProcessEphemeronMark(background);
+    }
+}
+
 bool
 Recycler::EndMark()
 {
@@ -2803,6 +2949,10 @@ Recycler::EndMark()
             this->collectionWrapper->EndMarkDomWrapperTracingEnterFinalPauseCallback();
             this->FinishWrapperObjectTracing();
         }
+        else
+        {
+            this->MarkEphemerons(false);
+        }
 
         collectionWrapper->EndMarkCallback();
     }
@@ -2811,7 +2961,12 @@ Recycler::EndMark()
 
     if (ProcessObjectBeforeCollectCallbacks())
     {
-        // callbacks may trigger additional marking, need to check OOMRescan again
+        // Callbacks may revive objects, which can make more ephemeron keys reachable, so finish
+        // marking again. That may trigger additional marking, need to check OOMRescan again
+        {
+            AUTO_NO_EXCEPTION_REGION;
+            this->FinishMark();
+        }
         oomRescan |= EndMarkCheckOOMRescan();
     }
 
@@ -2906,15 +3061,7 @@ Recycler::EndMarkOnLowMemory()
         }
 #endif
 
-        // Drain the mark stack along with any required DOM wrapper tracing.
-        if (this->needExternalWrapperTracing)
-        {
-            this->FinishWrapperObjectTracing();
-        }
-        else
-        {
-            this->ProcessMark(false);
-        }
+        this->FinishMark();
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
         iterations++;
@@ -3268,6 +3415,8 @@ Recycler::SweepWeakReference()
     }
 #endif
 
+    hasCleanup |= this->SweepEphemeronTables();
+
     this->weakReferenceCleanupId += hasCleanup;
 
 #if defined(GCETW) && defined(ENABLE_JS_ETW)
@@ -3278,6 +3427,46 @@ Recycler::SweepWeakReference()
     RECYCLER_PROFILE_EXEC_END(this, Js::SweepWeakPhase);
 }
 
+bool
+Recycler::SweepEphemeronTables()
+{
+    this->AddPendingEphemeronTables();
+
+    bool hasCleanup = false;
+    auto edIt = this->ephemeronTableList.GetEditingIterator();
+    while (edIt.Next())
+    {
+        RecyclerEphemeronTableBase * table = edIt.Data();
+        if (!this->heapBlockMap.IsMarked(table))
+        {
+            // The table itself is going away
+            edIt.RemoveCurrent();
+            continue;
+        }
+
+        RecyclerEphemeronTableBase::Store * store = table->store;
+        if (store == nullptr)
+        {
+            continue;
+        }
+
+        // Remove the entries whose keys are being collected; their values are only
+        // still alive if something else refers to them.
+        for (uint32 i = 0; i < store->capacity; i++)
+        {
+            RecyclerEphemeronTableBase::Entry & entry = store->entries[i];
+            if (RecyclerEphemeronTableBase::IsLiveKey(entry.key) && !this->heapBlockMap.IsMarked(entry.key))
+            {
+                entry.key = (void *)RecyclerEphemeronTableBase::RemovedKey;
+                entry.value = nullptr;
+                table->count--;
+                hasCleanup = true;
+            }
+        }
+    }
+    return hasCleanup;
+}
+
 void
 Recycler::SweepHeap(bool concurrent, RecyclerSweepManager& recyclerSweepManager)
 {
@@ -6183,6 +6372,10 @@ Recycler::DoBackgroundWork(bool forceForeground)
             // fall-through
         case CollectionStateConcurrentMark:
             this->BackgroundMark();
+            if (!this->NeedOOMRescan() && !this->isAborting)
+            {
+                this->MarkEphemerons(true);
+            }
             this->collectionState = CollectionStateConcurrentMarkWeakRef;
             // fall-through
         case CollectionStateConcurrentMarkWeakRef:
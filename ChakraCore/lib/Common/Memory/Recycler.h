@@ -108,6 +108,8 @@ class AutoRestoreValue
 };
 
 class Recycler;
+class RecyclerEphemeronTableBase;
+class RecyclerEphemeronKeyIndex;
 
 class RecyclerScanMemoryCallback
 {
@@ -830,6 +832,10 @@ class Recycler
 #if ENABLE_WEAK_REFERENCE_REGIONS
     SList<RecyclerWeakReferenceRegion, HeapAllocator> weakReferenceRegionList;
 #endif
+    SList<RecyclerEphemeronTableBase *, HeapAllocator> ephemeronTableList;
+    // Tables registered since the last in-thread pass over ephemeronTableList. The background marker walks that list
+    // unsynchronized, so new tables wait here until AddPendingEphemeronTables moves them over in-thread.
+    SList<RecyclerEphemeronTableBase *, HeapAllocator> pendingEphemeronTableList;
 
     void * transientPinnedObject;
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
@@ -1412,6 +1418,7 @@ class Recycler
     template<typename T>
     RecyclerWeakReferenceRegionItem<T>* CreateWeakReferenceRegion(size_t count);
 #endif
+    void RegisterEphemeronTable(RecyclerEphemeronTableBase * table);
 
     uint GetWeakReferenceCleanupId() const { return weakReferenceCleanupId; }
 
@@ -1652,6 +1659,12 @@ class Recycler
     void DoBackgroundParallelMark();
 #endif
     void FinishWrapperObjectTracing();
+    void FinishMark();
+    void AddPendingEphemeronTables();
+    uint MarkEphemeronTables(RecyclerEphemeronKeyIndex * pendingIndex, uint * entryCount);
+    void SetEphemeronKeyIndex(RecyclerEphemeronKeyIndex * index);
+    void ProcessEphemeronMark(bool background);
+    void MarkEphemerons(bool background);
 
     size_t RootMark(CollectionState markState);
 
@@ -1701,6 +1714,7 @@ class Recycler
     bool Sweep(bool concurrent = false);
 #endif
     void SweepWeakReference();
+    bool SweepEphemeronTables();
     void SweepHeap(bool concurrent, RecyclerSweepManager& recyclerSweepManager);
     void FinishSweep(RecyclerSweepManager& recyclerSweepManager);
 
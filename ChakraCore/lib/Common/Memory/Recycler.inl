@@ -444,6 +444,14 @@ inline RecyclerWeakReferenceRegionItem<T>* Recycler::CreateWeakReferenceRegion(s
 }
 #endif
 
+inline void Recycler::RegisterEphemeronTable(RecyclerEphemeronTableBase * table)
+{
+    // The list only holds weak references; tables that die are dropped from it in SweepWeakReference.
+    // The background marker may be walking ephemeronTableList, so the table is queued until the next
+    // in-thread pass (MarkEphemerons(false) or SweepEphemeronTables) moves it over.
+    this->pendingEphemeronTableList.Push(table);
+}
+
 
 
 inline HeapBlock*
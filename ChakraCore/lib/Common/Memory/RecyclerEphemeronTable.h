@@ -0,0 +1,305 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+///
+/// An ephemeron table maps keys to values such that an entry keeps its value
+/// alive only for as long as its key is alive, and the value never keeps its
+/// own key alive.
+///
+/// The entries live in a leaf allocation (the store), so normal marking never
+/// traces through them. Instead the recycler keeps a list of all the tables it
+/// has created, and once the mark stack has drained it marks the value of every
+/// entry in a live table whose key is marked (see Recycler::MarkEphemerons).
+/// The entries whose keys are not marked yet go into a RecyclerEphemeronKeyIndex
+/// that is consulted as objects are scanned, so a key found while draining the
+/// mark stack has its values marked right away, and chains of entries resolve in
+/// a single drain rather than one pass over the tables per link. The sweep then
+/// removes the entries whose keys were not marked.
+///
+/// Entries are found by open addressing (linear probing) on the key address.
+/// A store is never resized in place: growing allocates a new store and swaps
+/// it in, so the background marking thread can keep reading the old store
+/// while script modifies the table.
+///
+class RecyclerEphemeronTableBase
+{
+    friend class Recycler;
+    friend class MarkContext;
+    friend class RecyclerEphemeronKeyIndex;
+
+protected:
+    struct Entry
+    {
+        void * key;
+        void * value;
+    };
+
+    class Store
+    {
+    public:
+        uint32 capacity;
+        Entry entries[];
+
+        Store(uint32 capacity) : capacity(capacity) { }
+    };
+
+    static const uint32 InitialCapacity = 8;
+
+    // Key of an entry that has been removed, so that probing continues past it
+    static const uintptr_t RemovedKey = 1;
+
+    FieldNoBarrier(Recycler *) recycler;
+    Field(Store *) store;
+    // Number of entries with a live key
+    Field(uint32) count;
+    // Number of entries with a live or removed key
+    Field(uint32) used;
+
+    RecyclerEphemeronTableBase(Recycler * recycler) : recycler(recycler), store(nullptr), count(0), used(0) { }
+
+    static bool IsLiveKey(void * key)
+    {
+        return key != nullptr && (uintptr_t)key != RemovedKey;
+    }
+
+    static uint32 HashKey(void * key)
+    {
+        return (uint32)(((uintptr_t)key >> HeapConstants::ObjectAllocationShift) * 0x9E3779B1);
+    }
+
+    Entry * FindEntry(void * key) const
+    {
+        Assert(IsLiveKey(key));
+        Store * current = this->store;
+        if (current == nullptr)
+        {
+            return nullptr;
+        }
+
+        // The store is at most half full, so probing always reaches an empty entry.
+        uint32 mask = current->capacity - 1;
+        for (uint32 i = HashKey(key) & mask; current->entries[i].key != nullptr; i = (i + 1) & mask)
+        {
+            if (current->entries[i].key == key)
+            {
+                return &current->entries[i];
+            }
+        }
+        return nullptr;
+    }
+
+    // Returns whether the entry went into an empty slot rather than a removed one
+    static bool InsertEntry(Store * store, void * key, void * value)
+    {
+        uint32 mask = store->capacity - 1;
+        uint32 i = HashKey(key) & mask;
+        while (IsLiveKey(store->entries[i].key))
+        {
+            i = (i + 1) & mask;
+        }
+
+        // Publish the value before the key, so the background marking thread never
+        // pairs the new key with the value of a removed entry.
+        bool wasEmpty = store->entries[i].key == nullptr;
+        store->entries[i].value = value;
+        store->entries[i].key = key;
+        return wasEmpty;
+    }
+
+    void Resize(uint32 newCapacity)
+    {
+        Assert(::Math::IsPow2(newCapacity));
+        Store * oldStore = this->store;
+        Store * newStore = RecyclerNewPlusLeafZ(this->recycler, AllocSizeMath::Mul(sizeof(Entry), newCapacity), Store, newCapacity);
+
+        if (oldStore != nullptr)
+        {
+            for (uint32 i = 0; i < oldStore->capacity; i++)
+            {
+                if (IsLiveKey(oldStore->entries[i].key))
+                {
+                    InsertEntry(newStore, oldStore->entries[i].key, oldStore->entries[i].value);
+                }
+            }
+        }
+
+        this->used = this->count;
+        this->store = newStore;
+    }
+
+    void SetValue(void * key, void * value)
+    {
+        Entry * entry = FindEntry(key);
+        if (entry != nullptr)
+        {
+            entry->value = value;
+            return;
+        }
+
+        if (this->store == nullptr)
+        {
+            Resize(InitialCapacity);
+        }
+        else if ((this->used + 1) * 2 > this->store->capacity)
+        {
+            // Grow when at least half of the used entries are live, otherwise just squeeze out the removed ones
+            uint32 capacity = this->store->capacity;
+            Resize(this->count * 4 >= capacity ? capacity * 2 : capacity);
+        }
+
+        if (InsertEntry(this->store, key, value))
+        {
+            this->used++;
+        }
+        this->count++;
+    }
+
+    bool RemoveKey(void * key)
+    {
+        Entry * entry = FindEntry(key);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        entry->key = (void *)RemovedKey;
+        entry->value = nullptr;
+        this->count--;
+        return true;
+    }
+
+public:
+    uint32 Count() const { return this->count; }
+
+    void Clear()
+    {
+        this->store = nullptr;
+        this->count = 0;
+        this->used = 0;
+    }
+};
+
+///
+/// The entries of all live ephemeron tables whose keys were not marked when
+/// ephemeron marking started, indexed by key. The recycler only reads it while
+/// draining the mark stack, so the parallel markers can share it. Entries are a
+/// copy, so script changing the tables concurrently cannot corrupt it; the final
+/// in-thread pass over the tables catches anything a stale copy missed.
+///
+class RecyclerEphemeronKeyIndex
+{
+public:
+    typedef RecyclerEphemeronTableBase::Entry Entry;
+
+    RecyclerEphemeronKeyIndex(Entry * entries, uint32 capacity) : entries(entries), capacity(capacity), count(0)
+    {
+        Assert(::Math::IsPow2(capacity));
+    }
+
+    // Returns false if the index is full
+    bool Add(void * key, void * value)
+    {
+        if ((count + 1) * 2 > capacity)
+        {
+            return false;
+        }
+
+        uint32 mask = capacity - 1;
+        uint32 i = RecyclerEphemeronTableBase::HashKey(key) & mask;
+        while (entries[i].key != nullptr)
+        {
+            i = (i + 1) & mask;
+        }
+        entries[i].key = key;
+        entries[i].value = value;
+        count++;
+        return true;
+    }
+
+    // The same key may have entries in several tables
+    template <typename Fn>
+    void MapValues(void * key, Fn fn) const
+    {
+        uint32 mask = capacity - 1;
+        for (uint32 i = RecyclerEphemeronTableBase::HashKey(key) & mask; entries[i].key != nullptr; i = (i + 1) & mask)
+        {
+            if (entries[i].key == key)
+            {
+                fn(entries[i].value);
+            }
+        }
+    }
+
+private:
+    Entry * entries;
+    uint32 capacity;
+    uint32 count;
+};
+
+template <typename TKey, typename TValue>
+class RecyclerEphemeronTable : public RecyclerEphemeronTableBase
+{
+    CompileAssert(sizeof(TKey) == sizeof(void *));
+    CompileAssert(sizeof(TValue) == sizeof(void *));
+
+    RecyclerEphemeronTable(Recycler * recycler) : RecyclerEphemeronTableBase(recycler) { }
+
+public:
+    static RecyclerEphemeronTable * New(Recycler * recycler)
+    {
+        RecyclerEphemeronTable * table = RecyclerNew(recycler, RecyclerEphemeronTable, recycler);
+        recycler->RegisterEphemeronTable(table);
+        return table;
+    }
+
+    bool ContainsKey(TKey key) const
+    {
+        return FindEntry((void *)key) != nullptr;
+    }
+
+    bool TryGetValue(TKey key, TValue * value) const
+    {
+        Entry * entry = FindEntry((void *)key);
+        if (entry == nullptr)
+        {
+            return false;
+        }
+
+        *value = (TValue)entry->value;
+        return true;
+    }
+
+    void Item(TKey key, TValue value)
+    {
+        SetValue((void *)key, (void *)value);
+    }
+
+    bool Remove(TKey key)
+    {
+        return RemoveKey((void *)key);
+    }
+
+    template <typename Fn>
+    void Map(Fn fn) const
+    {
+        Store * current = this->store;
+        if (current == nullptr)
+        {
+            return;
+        }
+
+        for (uint32 i = 0; i < current->capacity; i++)
+        {
+            if (IsLiveKey(current->entries[i].key))
+            {
+                fn((TKey)current->entries[i].key, (TValue)current->entries[i].value);
+            }
+        }
+    }
+};
+}
@@ -65,6 +65,9 @@ class RecyclerHeuristic
     // then trigger a second repeat mark pass.
     static const uint BackgroundSecondRepeatMarkThreshold = 128;
 
+    // Most ephemeron passes the background thread makes before leaving the rest to the in-thread pass.
+    static const uint MaxBackgroundEphemeronPassCount = 16;
+
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
     // Number of blocks a heap bucket needs to have before allocations during concurrent sweep feature kicks-in.
 #if DBG
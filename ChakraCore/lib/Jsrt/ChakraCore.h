@@ -65,6 +65,23 @@ typedef void *JsVarSerializerHandle;
 /// </remarks>
 typedef void *JsVarDeserializerHandle;
 
+/// <summary>
+///     A reference to the contents of the ArrayBuffers transferred by a serializer.
+/// </summary>
+/// <remarks>
+///     This represents heap allocated contents which are not owned by any runtime, they can be passed to
+///     a deserializer in a different runtime, which takes them over without copying.
+/// </remarks>
+typedef void *JsTransferredContentsHandle;
+
+/// <summary>
+///     A reference to an incremental JSON parser.
+/// </summary>
+/// <remarks>
+///     This represents the internal state of a parse started with <c>JsJsonParseBegin</c>.
+/// </remarks>
+typedef void *JsJsonParserHandle;
+
 
 /// <summary>
 ///     Flags for parsing a module.
@@ -1062,6 +1079,136 @@ JsCopyStringOneByte(
     _Out_opt_ char* buffer,
     _Out_opt_ size_t* written);
 
+/// <summary>
+///     Called by <c>JsStringifyUtf8</c> with consecutive chunks of the UTF-8 output.
+/// </summary>
+/// <remarks>
+///     The chunk is only valid for the duration of the call. The callback must not call into the runtime.
+/// </remarks>
+/// <param name="chunk">The next chunk of output.</param>
+/// <param name="length">Number of bytes in the chunk.</param>
+/// <param name="callbackState">The state passed to <c>JsStringifyUtf8</c>.</param>
+/// <returns>
+///     <c>JsNoError</c> to continue, any other code stops the stringification and is returned by
+///     <c>JsStringifyUtf8</c>.
+/// </returns>
+typedef JsErrorCode(CHAKRA_CALLBACK * JsStringifyUtf8Callback)(_In_reads_(length) const char* chunk, _In_ size_t length, _In_opt_ void* callbackState);
+
+/// <summary>
+///     Writes the JSON text of a value, as <c>JSON.stringify(value)</c> would produce it, as UTF-8
+///     without creating the JavaScript string.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         Without a callback, the output is written to `buffer`. When `buffer` is nullptr, nothing
+///         is written and `written` returns the size needed. When the output doesn't fit in `buffer`,
+///         returns <c>JsErrorInvalidArgument</c>, the content of `buffer` is unspecified and `written`
+///         returns the size needed.
+///     </para>
+///     <para>
+///         With a callback, `buffer` is used for chunks of the output, each of which is passed to
+///         the callback as it fills up. `buffer` must then be at least 64 bytes; if it is nullptr
+///         the runtime uses a buffer of its own.
+///     </para>
+///     <para>
+///         If the value has no JSON representation (undefined, a function, a symbol) nothing is
+///         written and `written` is 0. Exceptions thrown while reading the value (by toJSON,
+///         getters, or for cyclic structures) are reported as <c>JsErrorScriptException</c>.
+///     </para>
+/// </remarks>
+/// <param name="value">The value to stringify.</param>
+/// <param name="buffer">The output buffer, or the chunk buffer if a callback is given.</param>
+/// <param name="bufferSize">Size of the buffer in bytes.</param>
+/// <param name="callback">Called with each chunk of output. This parameter can be null.</param>
+/// <param name="callbackState">State passed to the callback.</param>
+/// <param name="written">Total number of bytes in the output.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsStringifyUtf8(
+    _In_ JsValueRef value,
+    _Out_writes_opt_(bufferSize) char* buffer,
+    _In_ size_t bufferSize,
+    _In_opt_ JsStringifyUtf8Callback callback,
+    _In_opt_ void* callbackState,
+    _Out_opt_ size_t* written);
+
+/// <summary>
+///     Starts parsing JSON text that is passed in pieces to <c>JsJsonParseFeed</c>.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context. The parser can only be used in that context.
+///     </para>
+///     <para>
+///         The value is built while the chunks arrive, so the host doesn't need to keep the text.
+///         The parser must be released with <c>JsJsonParseFinish</c>.
+///     </para>
+/// </remarks>
+/// <param name="parser">The new parser.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsJsonParseBegin(
+    _Out_ JsJsonParserHandle* parser);
+
+/// <summary>
+///     Passes the next chunk of UTF-8 JSON text to a parser.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires an active script context.
+///     </para>
+///     <para>
+///         Chunks may end anywhere, including inside a token or a UTF-8 sequence. The chunk is not
+///         referenced after the call returns. Invalid UTF-8 in strings is decoded as U+FFFD.
+///     </para>
+///     <para>
+///         Syntax errors are reported as <c>JsErrorScriptException</c>, with the same SyntaxError
+///         <c>JSON.parse</c> throws and the position counted in bytes. After a failure, the parser
+///         can only be released with <c>JsJsonParseFinish</c>.
+///     </para>
+/// </remarks>
+/// <param name="parser">The parser.</param>
+/// <param name="chunk">The next bytes of the text.</param>
+/// <param name="length">Number of bytes in the chunk.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsJsonParseFeed(
+    _In_ JsJsonParserHandle parser,
+    _In_reads_(length) const char* chunk,
+    _In_ size_t length);
+
+/// <summary>
+///     Ends the text passed to a parser, and releases the parser.
+/// </summary>
+/// <remarks>
+///     <para>
+///         Requires the script context the parse was started in to be active.
+///     </para>
+///     <para>
+///         If the text is incomplete, the SyntaxError is reported as <c>JsErrorScriptException</c>.
+///         If an earlier <c>JsJsonParseFeed</c> failed, the parser is released and
+///         <c>JsErrorInvalidArgument</c> is returned. The parser can't be used after this call.
+///     </para>
+/// </remarks>
+/// <param name="parser">The parser.</param>
+/// <param name="result">The parsed value, as <c>JSON.parse</c> would return it without a reviver.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsJsonParseFinish(
+    _In_ JsJsonParserHandle parser,
+    _Out_opt_ JsValueRef* result);
+
 /// <summary>
 ///     Obtains frequently used properties of a data view.
 /// </summary>
@@ -1788,7 +1935,8 @@ JsVarSerializerWriteRawBytes(
 /// </summary>
 /// <param name="rootObject">A Javascript object to be serialized</param>
 /// <returns>
-///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsSerializerNotSupported</c> if the object
+///     graph holds a SharedArrayBuffer, a failure code otherwise.
 /// </returns>
 CHAKRA_API
 JsVarSerializerWriteValue(
@@ -1832,6 +1980,24 @@ JsVarSerializerSetTransferableVars(
     _In_opt_ JsValueRef *transferableVars,
     _In_ size_t transferableVarsCount);
 
+/// <summary>
+///     Take the contents of the array buffers detached by JsVarSerializerDetachArrayBuffer.
+/// </summary>
+/// <remarks>
+///     The contents are passed to JsVarDeserializerSetTransferredContents so that the deserialized array buffers
+///     use the same memory. If they are not passed to a deserializer, they must be freed with
+///     JsReleaseTransferredContents. Contents that are never taken are freed with the serializer.
+/// </remarks>
+/// <param name="serializerHandle">The serializer which detached the array buffers</param>
+/// <param name="transferredContents">The transferred contents</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsVarSerializerReleaseTransferredContents(
+    _In_ JsVarSerializerHandle serializerHandle,
+    _Out_ JsTransferredContentsHandle *transferredContents);
+
 /// <summary>
 ///     Free current object (which was created upon JsVarSerializer) when the serialization is done. SerializerHandleBase object should not be used further after FreeSelf call.
 /// </summary>
@@ -1921,6 +2087,34 @@ JsVarDeserializerReadValue(_In_ JsVarDeserializerHandle deserializerHandle, _Out
 CHAKRA_API
 JsVarDeserializerSetTransferableVars(_In_ JsVarDeserializerHandle deserializerHandle, _In_opt_ JsValueRef *transferableVars, _In_ size_t transferableVarsCount);
 
+/// <summary>
+///     Host provides the contents taken from the serializer with JsVarSerializerReleaseTransferredContents, in place
+///     of the transferable objects. The transferred array buffers are created over the same memory when the value is
+///     read, so they are not copied.
+/// </summary>
+/// <remarks>
+///     The contents are still owned by the host and must be released with JsReleaseTransferredContents after the
+///     value has been read.
+/// </remarks>
+/// <param name="deserializerHandle">The deserializer</param>
+/// <param name="transferredContents">The transferred contents</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsVarDeserializerSetTransferredContents(_In_ JsVarDeserializerHandle deserializerHandle, _In_ JsTransferredContentsHandle transferredContents);
+
+/// <summary>
+///     Release the contents taken from a serializer with JsVarSerializerReleaseTransferredContents. Contents which
+///     have not been claimed by a deserializer are freed.
+/// </summary>
+/// <param name="transferredContents">The transferred contents</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsReleaseTransferredContents(_In_ JsTransferredContentsHandle transferredContents);
+
 /// <summary>
 ///     Free current object (which was created upon JsVarSerializer) when the serialization is done. JsVarSerializerHandle object should not be used further after FreeSelf call.
 /// </summary>
@@ -1930,6 +2124,68 @@ JsVarDeserializerSetTransferableVars(_In_ JsVarDeserializerHandle deserializerHa
 CHAKRA_API
 JsVarDeserializerFree(_In_ JsVarDeserializerHandle deserializerHandle);
 
+/// <summary>
+///     Creates a snapshot image of the object graph reachable from a value, to warm up new contexts without
+///     re-running the code that built it.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The image holds the objects, arrays, strings, numbers, Dates, RegExps, Maps, Sets, ArrayBuffers and typed
+///     arrays reachable from the value; shared and cyclic references are kept. It doesn't reference any memory
+///     outside itself, so the host can write it to a file and later map it back in with JsCreateExternalArrayBuffer.
+///     </para>
+///     <para>
+///     Functions that only close over the global scope are kept as their source text and evaluated again in the
+///     global scope when the image is inflated. Properties added to such a function aren't kept. Functions that close
+///     over local variables, methods, accessors, classes, generators and async functions can't be in a snapshot, nor
+///     can host objects, SharedArrayBuffers and shared WebAssembly memories.
+///     </para>
+///     <para>
+///     The snapshot is written with the same serializer as JsVarSerializer, without transferable vars: ArrayBuffers
+///     are copied into the image, never detached.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="root">The value to take the snapshot of</param>
+/// <param name="snapshot">An ArrayBuffer holding the image</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorInvalidArgument</c> if the graph holds a
+///     function that can't be captured, a host object or shared memory, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsCreateContextSnapshot(
+    _In_ JsValueRef root,
+    _Out_ JsValueRef *snapshot);
+
+/// <summary>
+///     Rebuilds in the current context the object graph of an image created by JsCreateContextSnapshot.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The image is read in place, in one pass, so it can be an external ArrayBuffer over a mapped file. It
+///     only needs to stay valid until the call returns.
+///     </para>
+///     <para>
+///     The functions in the image are evaluated from their source text, so only inflate images from a trusted
+///     source, as with JsRunSerialized.
+///     </para>
+///     <para>
+///     Requires an active script context.
+///     </para>
+/// </remarks>
+/// <param name="snapshot">An ArrayBuffer holding the image</param>
+/// <param name="root">The copy of the value the snapshot was taken of</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, <c>JsErrorBadSerializedScript</c> if the buffer
+///     isn't a snapshot image or a function in it can't be evaluated, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+JsInflateContextSnapshot(
+    _In_ JsValueRef snapshot,
+    _Out_ JsValueRef *root);
+
 /// <summary>
 ///     Extract extra info stored from an ArrayBuffer object
 /// </summary>
@@ -251,6 +251,12 @@ bool ChakraCoreStreamWriter::DetachArrayBuffer()
     return m_serializerCore->DetachArrayBuffer();
 }
 
+Js::SCACore::TransferredContents* ChakraCoreStreamWriter::ReleaseTransferredContents()
+{
+    Assert(m_serializerCore);
+    return m_serializerCore->ReleaseTransferredContents();
+}
+
 JsErrorCode ChakraCoreStreamWriter::SetTransferableVars(JsValueRef *transferableVars, size_t transferableVarsCount)
 {
     Assert(m_serializerCore);
@@ -322,6 +328,11 @@ JsErrorCode ChakraHostDeserializerHandle::SetTransferableVars(JsValueRef *transf
     return JsSerializerNotSupported;
 }
 
+JsErrorCode ChakraHostDeserializerHandle::SetTransferredContents(Js::SCACore::TransferredContents* transferredContents)
+{
+    Assert(m_deserializer);
+    return m_deserializer->SetTransferredContents(transferredContents) == S_OK ? JsNoError : JsErrorInvalidArgument;
+}
 
 void ChakraHostDeserializerHandle::FreeSelf()
 {
@@ -62,6 +62,7 @@ class ChakraCoreStreamWriter : public HostStream
     bool WriteValue(JsValueRef root);
     bool ReleaseData(byte** data, size_t *dataLength);
     bool DetachArrayBuffer();
+    Js::SCACore::TransferredContents* ReleaseTransferredContents();
     JsErrorCode SetTransferableVars(JsValueRef *transferableVars, size_t transferableVarsCount);
     void FreeSelf();
 
@@ -90,6 +91,7 @@ class ChakraHostDeserializerHandle : public HostReadStream
     bool ReadRawBytes(size_t length, void **data);
     virtual bool ReadBytes(size_t length, void **data);
     virtual JsErrorCode SetTransferableVars(JsValueRef *transferableVars, size_t transferableVarsCount);
+    JsErrorCode SetTransferredContents(Js::SCACore::TransferredContents* transferredContents);
     JsValueRef ReadValue();
     void FreeSelf();
 
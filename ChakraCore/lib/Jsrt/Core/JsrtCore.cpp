@@ -17,6 +17,10 @@
 #include "Library/JavascriptExceptionMetadata.h"
 #include "Base/ThreadContextTlsEntry.h"
 #include "Library/JavascriptPromise.h"
+#include "Library/LazyJSONString.h"
+#include "Library/JSONStringifier.h"
+#include "Library/JSONUtf8Builder.h"
+#include "Library/JSONIncrementalParser.h"
 #include "Codex/Utf8Helper.h"
 
 CHAKRA_API
@@ -322,7 +326,10 @@ JsVarSerializerWriteValue(
     PARAM_NOT_NULL(rootObject);
     return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
         ChakraCoreStreamWriter* streamWriter = reinterpret_cast<ChakraCoreStreamWriter*>(serializerHandle);
-        streamWriter->WriteValue(rootObject);
+        if (!streamWriter->WriteValue(rootObject))
+        {
+            return JsSerializerNotSupported;
+        }
         return JsNoError;
     });
 }
@@ -374,6 +381,24 @@ JsVarSerializerSetTransferableVars(
 
 }
 
+CHAKRA_API
+JsVarSerializerReleaseTransferredContents(
+    _In_ JsVarSerializerHandle serializerHandle,
+    _Out_ JsTransferredContentsHandle *transferredContents)
+{
+    PARAM_NOT_NULL(serializerHandle);
+    PARAM_NOT_NULL(transferredContents);
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        ChakraCoreStreamWriter* streamWriter = reinterpret_cast<ChakraCoreStreamWriter*>(serializerHandle);
+        *transferredContents = streamWriter->ReleaseTransferredContents();
+        if (*transferredContents == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+        return JsNoError;
+    });
+}
+
 CHAKRA_API
 JsVarSerializerFree(_In_ JsVarSerializerHandle serializerHandle)
 {
@@ -458,6 +483,27 @@ JsVarDeserializerSetTransferableVars(_In_ JsVarDeserializerHandle deserializerHa
     });
 }
 
+CHAKRA_API
+JsVarDeserializerSetTransferredContents(_In_ JsVarDeserializerHandle deserializerHandle, _In_ JsTransferredContentsHandle transferredContents)
+{
+    PARAM_NOT_NULL(deserializerHandle);
+    PARAM_NOT_NULL(transferredContents);
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        ChakraHostDeserializerHandle* deserializer = reinterpret_cast<ChakraHostDeserializerHandle*>(deserializerHandle);
+        return deserializer->SetTransferredContents((Js::SCACore::TransferredContents*)transferredContents);
+    });
+}
+
+CHAKRA_API
+JsReleaseTransferredContents(_In_ JsTransferredContentsHandle transferredContents)
+{
+    PARAM_NOT_NULL(transferredContents);
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        ((Js::SCACore::TransferredContents*)transferredContents)->Release();
+        return JsNoError;
+    });
+}
+
 CHAKRA_API
 JsVarDeserializerFree(_In_ JsVarDeserializerHandle deserializerHandle)
 {
@@ -469,6 +515,68 @@ JsVarDeserializerFree(_In_ JsVarDeserializerHandle deserializerHandle)
     });
 }
 
+CHAKRA_API
+JsCreateContextSnapshot(
+    _In_ JsValueRef root,
+    _Out_ JsValueRef *snapshot)
+{
+    VALIDATE_JSREF(root);
+    PARAM_NOT_NULL(snapshot);
+    *snapshot = JS_INVALID_REFERENCE;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(root, scriptContext);
+#if ENABLE_TTD
+        // The image wouldn't be recorded
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        Js::ArrayBuffer* image = Js::SCACore::ContextSnapshot::Create(root, scriptContext);
+        if (image == nullptr)
+        {
+            return JsErrorInvalidArgument;
+        }
+        *snapshot = image;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsInflateContextSnapshot(
+    _In_ JsValueRef snapshot,
+    _Out_ JsValueRef *root)
+{
+    VALIDATE_JSREF(snapshot);
+    PARAM_NOT_NULL(root);
+    *root = JS_INVALID_REFERENCE;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+#if ENABLE_TTD
+        // The inflated objects wouldn't be recorded
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        if (!Js::VarIs<Js::ArrayBuffer>(snapshot))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::Var value = Js::SCACore::ContextSnapshot::Inflate(Js::VarTo<Js::ArrayBuffer>(snapshot), scriptContext);
+        if (value == nullptr)
+        {
+            return JsErrorBadSerializedScript;
+        }
+        *root = value;
+        return JsNoError;
+    });
+}
+
 CHAKRA_API
 JsGetArrayBufferExtraInfo(
     _In_ JsValueRef arrayBuffer,
@@ -892,6 +1000,8 @@ CHAKRA_API JsCreateString(
 
     return ContextAPINoScriptWrapper([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
 
+        // Hosts pass property names through here, so keep the cached PropertyString that
+        // LiteralStringWithPropertyStringPtr carries rather than a one-byte string
         Js::JavascriptString *stringValue = Js::LiteralStringWithPropertyStringPtr::
             NewFromCString(content, (CharCount)length, scriptContext->GetLibrary());
 
@@ -1561,3 +1671,162 @@ JsGetArrayBufferFreeFunction(
         return JsNoError;
       });
 }
+
+namespace
+{
+    struct StringifyUtf8State
+    {
+        JsStringifyUtf8Callback callback;
+        void* callbackState;
+        JsErrorCode errorCode;
+    };
+
+    bool StringifyUtf8Flush(_In_reads_(length) const char* chunk, size_t length, _In_opt_ void* flushState)
+    {
+        StringifyUtf8State* state = static_cast<StringifyUtf8State*>(flushState);
+        state->errorCode = state->callback(chunk, length, state->callbackState);
+        return state->errorCode == JsNoError;
+    }
+}
+
+CHAKRA_API
+JsStringifyUtf8(
+    _In_ JsValueRef value,
+    _Out_writes_opt_(bufferSize) char* buffer,
+    _In_ size_t bufferSize,
+    _In_opt_ JsStringifyUtf8Callback callback,
+    _In_opt_ void* callbackState,
+    _Out_opt_ size_t* written)
+{
+    VALIDATE_JSREF(value);
+    if (written)
+    {
+        *written = 0;
+    }
+    if (callback != nullptr && buffer != nullptr && bufferSize < Js::JSONUtf8Builder::MinChunkSize)
+    {
+        return JsErrorInvalidArgument;
+    }
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext* scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        VALIDATE_INCOMING_REFERENCE(value, scriptContext);
+
+#if ENABLE_TTD
+        // The calls into script made while reading the value (toJSON, getters) wouldn't be recorded
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        Js::JSONProperty* content = Js::JSONStringifier::Read(scriptContext, value);
+        if (content == nullptr)
+        {
+            return JsNoError;
+        }
+
+        char chunk[4096];
+        StringifyUtf8State state = { callback, callbackState, JsNoError };
+        if (callback != nullptr && buffer == nullptr)
+        {
+            buffer = chunk;
+            bufferSize = sizeof(chunk);
+        }
+
+        Js::JSONUtf8Builder builder(scriptContext, buffer, bufferSize, callback != nullptr ? StringifyUtf8Flush : nullptr, &state);
+        builder.Build(content);
+        if (written)
+        {
+            *written = builder.GetLength();
+        }
+        if (callback == nullptr && buffer != nullptr && builder.GetLength() > bufferSize)
+        {
+            // Only part of the output was written
+            return JsErrorInvalidArgument;
+        }
+        return state.errorCode;
+    });
+}
+
+CHAKRA_API
+JsJsonParseBegin(
+    _Out_ JsJsonParserHandle* parser)
+{
+    PARAM_NOT_NULL(parser);
+    *parser = nullptr;
+
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext* scriptContext) -> JsErrorCode {
+#if ENABLE_TTD
+        // The objects built by the parser wouldn't be recorded
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        JSON::JSONIncrementalParser* newParser = JSON::JSONIncrementalParser::New(scriptContext);
+
+        // Keeps the partial result alive between chunks; released by JsJsonParseFinish
+        scriptContext->GetRecycler()->RootAddRef(newParser);
+        *parser = newParser;
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsJsonParseFeed(
+    _In_ JsJsonParserHandle parser,
+    _In_reads_(length) const char* chunk,
+    _In_ size_t length)
+{
+    PARAM_NOT_NULL(parser);
+    if (length != 0)
+    {
+        PARAM_NOT_NULL(chunk);
+    }
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext* scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        JSON::JSONIncrementalParser* jsonParser = static_cast<JSON::JSONIncrementalParser*>(parser);
+        if (jsonParser->GetScriptContext() != scriptContext || jsonParser->HasFailed())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        jsonParser->Feed(reinterpret_cast<const byte*>(chunk), length);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API
+JsJsonParseFinish(
+    _In_ JsJsonParserHandle parser,
+    _Out_opt_ JsValueRef* result)
+{
+    PARAM_NOT_NULL(parser);
+    if (result)
+    {
+        *result = JS_INVALID_REFERENCE;
+    }
+
+    return ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext* scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        JSON::JSONIncrementalParser* jsonParser = static_cast<JSON::JSONIncrementalParser*>(parser);
+        if (jsonParser->GetScriptContext() != scriptContext)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // The parser is collected once unrooted; it stays alive for the rest of this call through the local
+        scriptContext->GetRecycler()->RootRelease(jsonParser);
+        if (jsonParser->HasFailed())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        Js::Var value = jsonParser->Finish();
+        if (result)
+        {
+            *result = value;
+        }
+        return JsNoError;
+    });
+}
@@ -4932,6 +4932,27 @@ CHAKRA_API JsCopyString(
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
 
+    if (Js::VarIs<Js::OneByteString>(value))
+    {
+        // ASCII content is already UTF-8, copy it out without widening or transcoding
+        Js::OneByteString* oneByteString = Js::UnsafeVarTo<Js::OneByteString>(value);
+        const char* oneByteBuffer = oneByteString->GetOneByteBuffer();
+        size_t oneByteLength = oneByteString->GetLength();
+        if (Js::OneByteString::IsAscii(oneByteBuffer, static_cast<charcount_t>(oneByteLength)))
+        {
+            if (buffer)
+            {
+                oneByteLength = min(oneByteLength, bufferSize);
+                memmove(buffer, oneByteBuffer, oneByteLength);
+            }
+            if (length)
+            {
+                *length = oneByteLength;
+            }
+            return JsNoError;
+        }
+    }
+
     const char16* str = nullptr;
     size_t strLength = 0;
     JsErrorCode errorCode = JsStringToPointer(value, &str, &strLength);
@@ -5227,6 +5248,34 @@ CHAKRA_API JsCopyStringOneByte(
 {
     PARAM_NOT_NULL(value);
     VALIDATE_JSREF(value);
+
+    if (Js::VarIs<Js::OneByteString>(value))
+    {
+        // The content is already one byte per character, copy it out without widening the string
+        Js::OneByteString* oneByteString = Js::UnsafeVarTo<Js::OneByteString>(value);
+        if (written)
+        {
+            *written = 0;
+        }
+
+        size_t strLength = oneByteString->GetLength();
+        if (start < 0 || (size_t)start > strLength)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        size_t count = min(static_cast<size_t>(length), strLength - start);
+        if (buffer)
+        {
+            memmove(buffer, oneByteString->GetOneByteBuffer() + start, count);
+        }
+        if (written)
+        {
+            *written = count;
+        }
+        return JsNoError;
+    }
+
     return WriteStringCopy(value, start, length, written,
         [buffer](const char16* src, size_t count, size_t *needed)
     {
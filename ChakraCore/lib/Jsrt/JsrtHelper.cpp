@@ -18,6 +18,9 @@
 #ifdef DYNAMIC_PROFILE_STORAGE
 #include "Language/DynamicProfileStorage.h"
 #endif
+#if ENABLE_TIER_UP_CACHE
+#include "Language/TierUpCache.h"
+#endif
 
 #if !defined(_WIN32) || defined(CHAKRA_STATIC_LIBRARY)
 #include "Core/ConfigParser.h"
@@ -116,6 +119,9 @@ void JsrtCallbackState::ObjectBeforeCallectCallbackWrapper(JsObjectBeforeCollect
 
 #ifdef DYNAMIC_PROFILE_STORAGE
         DynamicProfileStorage::Uninitialize();
+#endif
+#if ENABLE_TIER_UP_CACHE
+        Js::TierUpCache::Uninitialize();
 #endif
         JsrtRuntime::Uninitialize();
 
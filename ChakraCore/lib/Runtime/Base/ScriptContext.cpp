@@ -25,6 +25,7 @@
 
 #include "Language/InterpreterStackFrame.h"
 #include "Language/SourceDynamicProfileManager.h"
+#include "Language/TierUpCache.h"
 #include "Language/JavascriptStackWalker.h"
 #include "Language/AsmJsTypes.h"
 #include "Language/AsmJsModule.h"
@@ -60,6 +61,8 @@ namespace Js
 
 #if ENABLE_NATIVE_CODEGEN
     CriticalSection JITPageAddrToFuncRangeCache::cs;
+    uintptr_t volatile JITPageAddrToFuncRangeCache::lowestFuncAddr = UINTPTR_MAX;
+    uintptr_t volatile JITPageAddrToFuncRangeCache::highestFuncEndAddr = 0;
 #endif
 
     ScriptContext::ScriptContext(ThreadContext* threadContext) :
@@ -1459,6 +1462,17 @@ namespace Js
                     });
                 }
 #endif
+#if ENABLE_TIER_UP_CACHE
+                if (TierUpCache::IsEnabled())
+                {
+                    HRESULT hr = S_OK;
+                    BEGIN_TRANSLATE_OOM_TO_HRESULT_NESTED
+                    {
+                        TierUpCache::Save(this);
+                    }
+                    END_TRANSLATE_OOM_TO_HRESULT(hr);
+                }
+#endif
 
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
                 this->ClearDynamicProfileList();
@@ -6851,6 +6865,17 @@ ScriptContext::GetJitFuncRangeCache()
     {
         AutoCriticalSection autocs(GetCriticalSection());
 
+        // Only written under the lock. Each bound only moves outwards, so a reader that sees one updated and
+        // not the other still gets bounds that held at some point.
+        if ((uintptr_t)address < lowestFuncAddr)
+        {
+            lowestFuncAddr = (uintptr_t)address;
+        }
+        if ((uintptr_t)address + bytes > highestFuncEndAddr)
+        {
+            highestFuncEndAddr = (uintptr_t)address + bytes;
+        }
+
         if (bytes <= AutoSystemInfo::PageSize)
         {
             if (jitPageAddrToFuncRangeMap == nullptr)
@@ -6943,6 +6968,11 @@ ScriptContext::GetJitFuncRangeCache()
         });
     }
 
+    bool JITPageAddrToFuncRangeCache::IsInFuncRangeBounds(void * address)
+    {
+        return (uintptr_t)address >= lowestFuncAddr && (uintptr_t)address < highestFuncEndAddr;
+    }
+
     JITPageAddrToFuncRangeCache::JITPageAddrToFuncRangeMap * JITPageAddrToFuncRangeCache::GetJITPageAddrToFuncRangeMap()
     {
         return jitPageAddrToFuncRangeMap;
@@ -367,6 +367,10 @@ namespace Js
 
         static CriticalSection cs;
 
+        // Bounds of every range added to any cache, only ever widened, so that an address can be checked without the lock
+        static uintptr_t volatile lowestFuncAddr;
+        static uintptr_t volatile highestFuncEndAddr;
+
     public:
         JITPageAddrToFuncRangeCache() :jitPageAddrToFuncRangeMap(nullptr), largeJitFuncToSizeMap(nullptr) {}
         ~JITPageAddrToFuncRangeCache()
@@ -378,6 +382,8 @@ namespace Js
         void RemoveFuncRange(void * address);
         void * GetPageAddr(void * address);
         bool IsNativeAddr(void * address);
+        // Lock free, for signal handlers: false if the address can't be in any jitted function, true if it may be
+        static bool IsInFuncRangeBounds(void * address);
         JITPageAddrToFuncRangeMap * GetJITPageAddrToFuncRangeMap();
         LargeJITFuncAddrToSizeMap * GetLargeJITFuncAddrToSizeMap();
         static CriticalSection * GetCriticalSection() { return &cs; }
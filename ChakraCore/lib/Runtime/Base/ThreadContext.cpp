@@ -7,6 +7,7 @@
 #include "RuntimeBasePch.h"
 #include "ThreadServiceWrapper.h"
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 #ifdef ENABLE_SCRIPT_DEBUGGING
 #include "Debug/DebuggingFlags.h"
 #include "Debug/DiagProbe.h"
@@ -182,6 +183,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
 #endif
     dynamicObjectEnumeratorCacheMap(&HeapAllocator::Instance, 16),
+    stringDeduplicator(nullptr),
+    megamorphicPropertyCache(nullptr),
     //threadContextFlags(ThreadContextFlagNoFlag),
 #ifdef NTBUILD
     telemetryBlock(&localTelemetryBlock),
@@ -381,6 +384,10 @@ void ThreadContext::GlobalInitialize()
     {
         builtInPropertyRecords[i]->SetHash(JsUtil::CharacterBuffer<WCHAR>::StaticGetHashCode(builtInPropertyRecords[i]->GetBuffer(), builtInPropertyRecords[i]->GetLength()));
     }
+
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    PAL_SetHardwareExceptionFilter(Js::JavascriptFunction::HardwareExceptionFilter);
+#endif
 }
 
 ThreadContext::~ThreadContext()
@@ -532,6 +539,18 @@ ThreadContext::~ThreadContext()
 #endif
 
         HeapDelete(recycler);
+
+        if (this->stringDeduplicator)
+        {
+            HeapDelete(this->stringDeduplicator);
+            this->stringDeduplicator = nullptr;
+        }
+
+        if (this->megamorphicPropertyCache)
+        {
+            HeapDelete(this->megamorphicPropertyCache);
+            this->megamorphicPropertyCache = nullptr;
+        }
     }
 
 #if ENABLE_NATIVE_CODEGEN
@@ -719,6 +738,24 @@ uint ThreadContext::ThreadContextRecyclerTelemetryHostInterface::GetClosedContex
     return this->tc->closedScriptContextCount;
 }
 
+Js::StringDeduplicator* ThreadContext::GetStringDeduplicator()
+{
+    if (this->stringDeduplicator == nullptr && CONFIG_FLAG_RELEASE(DedupStrings) && this->recycler != nullptr)
+    {
+        this->stringDeduplicator = HeapNew(Js::StringDeduplicator, this->recycler);
+    }
+    return this->stringDeduplicator;
+}
+
+Js::MegamorphicPropertyCache* ThreadContext::EnsureMegamorphicPropertyCache()
+{
+    if (this->megamorphicPropertyCache == nullptr)
+    {
+        this->megamorphicPropertyCache = HeapNew(Js::MegamorphicPropertyCache);
+    }
+    return this->megamorphicPropertyCache;
+}
+
 Recycler* ThreadContext::EnsureRecycler()
 {
     if (recycler == NULL)
@@ -2581,6 +2618,18 @@ ThreadContext::PreSweepCallback()
     ClearEnumeratorCaches();
 
     this->dynamicObjectEnumeratorCacheMap.Clear();
+
+    if (this->megamorphicPropertyCache)
+    {
+        // The cache doesn't keep its types alive, drop the ones that are about to be swept
+        this->megamorphicPropertyCache->ClearUnusedTypes(this->recycler);
+    }
+
+    if (this->stringDeduplicator)
+    {
+        // Mark bits are final here, and the candidates it holds must be dropped before the sweep frees them
+        this->stringDeduplicator->ProcessAfterMark();
+    }
 }
 
 void
@@ -3983,6 +4032,11 @@ void ThreadContext::InvalidateProtoTypePropertyCaches(const Js::PropertyId prope
 
 void ThreadContext::InternalInvalidateProtoTypePropertyCaches(const Js::PropertyId propertyId)
 {
+    if (megamorphicPropertyCache)
+    {
+        megamorphicPropertyCache->ClearIfPropertyIsOnAPrototype(propertyId);
+    }
+
     // Get the hash set of registered types associated with the property ID, invalidate each type in the hash set, and
     // remove the property ID and its hash set from the map
     PropertyIdToTypeHashSetDictionary &typesWithProtoPropertyCache = recyclableData->typesWithProtoPropertyCache;
@@ -3995,6 +4049,11 @@ void ThreadContext::InternalInvalidateProtoTypePropertyCaches(const Js::Property
 
 void ThreadContext::InvalidateAllProtoTypePropertyCaches()
 {
+    if (megamorphicPropertyCache)
+    {
+        megamorphicPropertyCache->ClearAllOnAPrototype();
+    }
+
     PropertyIdToTypeHashSetDictionary &typesWithProtoPropertyCache = recyclableData->typesWithProtoPropertyCache;
     if (typesWithProtoPropertyCache.Count() > 0)
     {
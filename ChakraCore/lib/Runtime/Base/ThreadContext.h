@@ -20,6 +20,8 @@ namespace Js
     typedef JsUtil::List<ReturnedValue*> ReturnedValueList;
 #endif
     class DelayedFreeArrayBuffer;
+    class StringDeduplicator;
+    class MegamorphicPropertyCache;
 }
 
 typedef BVSparse<ArenaAllocator> ActiveFunctionSet;
@@ -832,6 +834,9 @@ class ThreadContext sealed :
     typedef JsUtil::BaseDictionary<Js::DynamicType const *, void *, HeapAllocator, PowerOf2SizePolicy> DynamicObjectEnumeratorCacheMap;
     DynamicObjectEnumeratorCacheMap dynamicObjectEnumeratorCacheMap;
 
+    Js::StringDeduplicator* stringDeduplicator;
+    Js::MegamorphicPropertyCache* megamorphicPropertyCache;
+
 #ifdef NTBUILD
     ThreadContextWatsonTelemetryBlock localTelemetryBlock;
     ThreadContextWatsonTelemetryBlock * telemetryBlock;
@@ -1125,6 +1130,13 @@ class ThreadContext sealed :
 
     Recycler* EnsureRecycler();
 
+    // Null unless -DedupStrings is on
+    Js::StringDeduplicator* GetStringDeduplicator();
+
+    // Null until a megamorphic property access site caches a property in it
+    Js::MegamorphicPropertyCache* GetMegamorphicPropertyCache() const { return megamorphicPropertyCache; }
+    Js::MegamorphicPropertyCache* EnsureMegamorphicPropertyCache();
+
     ThreadContext::CollectCallBack * AddRecyclerCollectCallBack(RecyclerCollectCallBackFunction callback, void * context);
     void RemoveRecyclerCollectCallBack(ThreadContext::CollectCallBack * collectCallBack);
 
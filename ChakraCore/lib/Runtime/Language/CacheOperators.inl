@@ -97,8 +97,22 @@ namespace Js
         }
 
         TypePropertyCache *const typePropertyCache = object->GetType()->GetPropertyCache();
-        if(!typePropertyCache ||
-            !typePropertyCache->TryGetProperty<OutputExistence>(
+        if(!typePropertyCache)
+        {
+            return false;
+        }
+        if(!typePropertyCache->TryGetProperty<OutputExistence>(
+                CheckMissing,
+                object,
+                propertyId,
+                propertyValue,
+                requestContext,
+                ReturnOperationInfo ? operationInfo : nullptr,
+                propertyValueInfo))
+        {
+            MegamorphicPropertyCache *const megamorphicPropertyCache = requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TryGetProperty<OutputExistence>(
                     CheckMissing,
                     object,
                     propertyId,
@@ -106,8 +120,9 @@ namespace Js
                     requestContext,
                     ReturnOperationInfo ? operationInfo : nullptr,
                     propertyValueInfo))
-        {
-            return false;
+            {
+                return false;
+            }
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -210,8 +225,11 @@ namespace Js
         }
 
         TypePropertyCache *const typePropertyCache = object->GetType()->GetPropertyCache();
-        if(!typePropertyCache ||
-            !typePropertyCache->TrySetProperty(
+        if(!typePropertyCache)
+        {
+            return false;
+        }
+        if(!typePropertyCache->TrySetProperty(
                 object,
                 propertyId,
                 propertyValue,
@@ -219,7 +237,18 @@ namespace Js
                 ReturnOperationInfo ? operationInfo : nullptr,
                 propertyValueInfo))
         {
-            return false;
+            MegamorphicPropertyCache *const megamorphicPropertyCache = requestContext->GetThreadContext()->GetMegamorphicPropertyCache();
+            if(!megamorphicPropertyCache ||
+                !megamorphicPropertyCache->TrySetProperty(
+                    object,
+                    propertyId,
+                    propertyValue,
+                    requestContext,
+                    ReturnOperationInfo ? operationInfo : nullptr,
+                    propertyValueInfo))
+            {
+                return false;
+            }
         }
 
         if(!ReturnOperationInfo || operationInfo->cacheType == CacheType_TypeProperty)
@@ -527,6 +556,23 @@ namespace Js
             typePropertyCache = type->CreatePropertyCache();
         }
 
+        // Entries of the type property cache get evicted by other property IDs with the same hash, keep a copy of them in the
+        // megamorphic property cache
+        if(info->GetFunctionBody()
+                ? !PHASE_OFF(Js::MegamorphicPropertyCachePhase, info->GetFunctionBody())
+                : !PHASE_OFF1(Js::MegamorphicPropertyCachePhase))
+        {
+            MegamorphicPropertyCache *const megamorphicPropertyCache = requestContext->GetThreadContext()->EnsureMegamorphicPropertyCache();
+            if(isProto)
+            {
+                megamorphicPropertyCache->Cache(type, propertyId, propertyIndex, isInlineSlot, isMissing, objectWithProperty);
+            }
+            else
+            {
+                megamorphicPropertyCache->Cache(type, propertyId, propertyIndex, isInlineSlot, info->IsWritable() && info->IsStoreFieldCacheEnabled());
+            }
+        }
+
         if(isProto)
         {
             typePropertyCache->Cache(
@@ -7,7 +7,7 @@
 #if ENABLE_NATIVE_CODEGEN
 namespace Js
 {
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     DynamicProfileInfo::DynamicProfileInfo()
     {
         hasFunctionBody = false;
@@ -1938,10 +1938,12 @@ namespace Js
                     Output::Print(_u("      Loop %d:\n"), i);
                     LoopFlags lf = this->GetLoopFlags(i);
                     Output::Print(
-                        _u("        isInterpreted        : %s\n")
-                        _u("        memopMinCountReached : %s\n"),
+                        _u("        isInterpreted         : %s\n")
+                        _u("        memopMinCountReached  : %s\n")
+                        _u("        unrollMinCountReached : %s\n"),
                         IsTrueOrFalse(lf.isInterpreted),
-                        IsTrueOrFalse(lf.memopMinCountReached)
+                        IsTrueOrFalse(lf.memopMinCountReached),
+                        IsTrueOrFalse(lf.unrollMinCountReached)
                         );
                 }
             }
@@ -2144,25 +2146,24 @@ namespace Js
     }
 #endif
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
 #if DBG_DUMP
-    void BufferWriter::Log(DynamicProfileInfo* info)
+    void BufferWriter::Log(FunctionBody* functionBody, DynamicProfileInfo* info)
     {
-        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, info->GetFunctionBody()->GetSourceContextId(), info->GetFunctionBody()->GetLocalFunctionId()))
+        if (Configuration::Global.flags.Dump.IsEnabled(DynamicProfilePhase, functionBody->GetSourceContextId(), functionBody->GetLocalFunctionId()))
         {
             Output::Print(_u("Saving:"));
-            info->Dump(info->GetFunctionBody());
+            info->Dump(functionBody);
         }
     }
 #endif
 
     template <typename T>
-    bool DynamicProfileInfo::Serialize(T * writer)
+    bool DynamicProfileInfo::Serialize(FunctionBody * functionBody, T * writer)
     {
 #if DBG_DUMP
-        writer->Log(this);
+        writer->Log(functionBody, this);
 #endif
-        FunctionBody * functionBody = this->GetFunctionBody();
         Js::ArgSlot paramInfoCount = functionBody->GetProfiledInParamsCount();
         if (!writer->Write(functionBody->GetLocalFunctionId())
             || !writer->Write(paramInfoCount)
@@ -2505,9 +2506,11 @@ namespace Js
 
     // Explicit instantiations - to force the compiler to generate these - so they can be referenced from other compilation units.
     template DynamicProfileInfo * DynamicProfileInfo::Deserialize<BufferReader>(BufferReader*, Recycler*, Js::LocalFunctionId *);
-    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(BufferSizeCounter*);
-    template bool DynamicProfileInfo::Serialize<BufferWriter>(BufferWriter*);
+    template bool DynamicProfileInfo::Serialize<BufferSizeCounter>(FunctionBody*, BufferSizeCounter*);
+    template bool DynamicProfileInfo::Serialize<BufferWriter>(FunctionBody*, BufferWriter*);
+#endif
 
+#ifdef DYNAMIC_PROFILE_STORAGE
     void DynamicProfileInfo::UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext)
     {
         // We don't clear old dynamic data here, because if a function is inlined, it will never go through the
@@ -136,16 +136,19 @@ namespace Js
         // maintain the bits and the enum at the same time, it must match
         bool isInterpreted : 1;
         bool memopMinCountReached : 1;
+        bool unrollMinCountReached : 1;
         enum
         {
             INTERPRETED,
             MEMOP_MIN_COUNT_FOUND,
+            UNROLL_MIN_COUNT_FOUND,
             COUNT
         };
 
         LoopFlags() :
             isInterpreted(false),
-            memopMinCountReached(false)
+            memopMinCountReached(false),
+            unrollMinCountReached(false)
         {
             CompileAssert((sizeof(LoopFlags) * 8) >= LoopFlags::COUNT);
         }
@@ -656,15 +659,16 @@ namespace Js
 #if DBG_DUMP || defined(DYNAMIC_PROFILE_STORAGE) || defined(RUNTIME_DATA_COLLECTION)
         Field(FunctionBody *) functionBody; // This will only be populated if NeedProfileInfoList is true
 #endif
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
         // Used by de-serialize
         DynamicProfileInfo();
 
         template <typename T>
         static DynamicProfileInfo * Deserialize(T * reader, Recycler* allocator, Js::LocalFunctionId * functionId);
         template <typename T>
-        bool Serialize(T * writer);
-
+        bool Serialize(FunctionBody * functionBody, T * writer);
+#endif
+#ifdef DYNAMIC_PROFILE_STORAGE
         static void UpdateSourceDynamicProfileManagers(ScriptContext * scriptContext);
 #endif
         static Js::LocalFunctionId const CallSiteMixed = (Js::LocalFunctionId)-1;
@@ -684,6 +688,9 @@ namespace Js
         DynamicProfileInfo(FunctionBody * functionBody);
 
         friend class SourceDynamicProfileManager;
+#if ENABLE_TIER_UP_CACHE
+        friend class TierUpCache;
+#endif
 
         static FunctionInfo * GetFunctionInfo(FunctionBody * functionBody, Js::SourceId sourceId, Js::LocalFunctionId functionId);
         static void GetSourceAndFunctionId(FunctionBody * functionBody, FunctionInfo * calleeFunctionInfo, JavascriptFunction * calleeFunction, Js::SourceId * sourceId, Js::LocalFunctionId * functionId);
@@ -751,6 +758,7 @@ namespace Js
 
         void SetLoopInterpreted(int loopNumber) { loopFlags->Set(loopNumber * LoopFlags::COUNT + LoopFlags::INTERPRETED); }
         void SetMemOpMinReached(int loopNumber) { loopFlags->Set(loopNumber * LoopFlags::COUNT + LoopFlags::MEMOP_MIN_COUNT_FOUND); }
+        void SetLoopUnrollMinReached(int loopNumber) { loopFlags->Set(loopNumber * LoopFlags::COUNT + LoopFlags::UNROLL_MIN_COUNT_FOUND); }
         bool IsMemOpDisabled() const { return this->bits.disableMemOp; }
         void DisableMemOp() { this->bits.disableMemOp = true; }
         bool IsTrackCompoundedIntOverflowDisabled() const { return this->bits.disableTrackCompoundedIntOverflow; }
@@ -942,7 +950,7 @@ namespace Js
         }
     };
 
-#ifdef DYNAMIC_PROFILE_STORAGE
+#ifdef DYNAMIC_PROFILE_SERIALIZATION
     class BufferReader
     {
     public:
@@ -987,6 +995,8 @@ namespace Js
             lengthLeft -= size;
             return true;
         }
+
+        size_t GetLengthLeft() const { return lengthLeft; }
     private:
         char const * current;
         size_t lengthLeft;
@@ -1004,7 +1014,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info) {}
+        void Log(FunctionBody* functionBody, DynamicProfileInfo* info) {}
 #endif
 
         template <typename T>
@@ -1036,7 +1046,7 @@ namespace Js
         }
 
 #if DBG_DUMP
-        void Log(DynamicProfileInfo* info);
+        void Log(FunctionBody* functionBody, DynamicProfileInfo* info);
 #endif
         template <typename T>
         bool WriteArray(__in_ecount(len) T * data, size_t len)
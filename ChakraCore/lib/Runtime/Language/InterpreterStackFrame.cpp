@@ -5852,14 +5852,17 @@ namespace Js
         {
             fn->GetAnyDynamicProfileInfo()->SetLoopInterpreted(loopNumber);
             // If the counter is 0, there is a high chance that some config disabled tracking that information. (ie: -off:jitloopbody)
-            // Assume it is valid for memop in this case.
-            if (this->currentLoopCounter >= (uint)CONFIG_FLAG(MinMemOpCount) ||
-                (this->currentLoopCounter == 0 && !this->m_functionBody->DoJITLoopBody())
-                )
+            // Assume it is valid for memop and loop unrolling in this case.
+            const bool loopCounterUnknown = this->currentLoopCounter == 0 && !this->m_functionBody->DoJITLoopBody();
+            if (this->currentLoopCounter >= (uint)CONFIG_FLAG(MinMemOpCount) || loopCounterUnknown)
             {
                 // This flag becomes relevant only if the loop has been interpreted
                 fn->GetAnyDynamicProfileInfo()->SetMemOpMinReached(loopNumber);
             }
+            if (this->currentLoopCounter >= (uint)CONFIG_FLAG(MinLoopUnrollCount) || loopCounterUnknown)
+            {
+                fn->GetAnyDynamicProfileInfo()->SetLoopUnrollMinReached(loopNumber);
+            }
         }
 
         this->currentLoopCounter = 0;
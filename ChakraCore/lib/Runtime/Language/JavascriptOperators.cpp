@@ -20,6 +20,7 @@
 #include "Types/SimpleDictionaryPropertyDescriptor.h"
 #include "Types/SimpleDictionaryTypeHandler.h"
 #include "Language/ModuleNamespace.h"
+#include "Language/MemArithAccel.h"
 
 #ifndef SCRIPT_DIRECT_TYPE
 typedef enum JsNativeValueType: int
@@ -5296,6 +5297,169 @@ using namespace Js;
         JIT_HELPER_END(Op_Memset);
     }
 
+    static bool MemarithNarrow(double value, int32* result)
+    {
+        return JavascriptNumber::TryGetInt32Value(value, result);
+    }
+
+    static bool MemarithNarrow(double value, float* result)
+    {
+        *result = (float)value;
+        return (double)*result == value;
+    }
+
+    static bool MemarithNarrow(double value, double* result)
+    {
+        *result = value;
+        return true;
+    }
+
+    template<typename Op, typename T> bool MemarithApplyInDouble(T* dst, const T* src1, double value, uint32 length)
+    {
+        // The operand has to be a T, except for Float32Array below
+        return false;
+    }
+
+    template<typename Op> bool MemarithApplyInDouble(float* dst, const float* src1, double value, uint32 length)
+    {
+        // The loop computed in double and rounded the result when it was stored
+        for (uint32 i = 0; i < length; i++)
+        {
+            dst[i] = (float)Op::Scalar((double)src1[i], value);
+        }
+        return true;
+    }
+
+    template<typename T> bool MemarithRange(TypedArrayBase* array, int32 start, uint32 length, T** elements)
+    {
+        if (array->IsDetachedBuffer() || (uint32)start > array->GetLength() || length > array->GetLength() - (uint32)start)
+        {
+            return false;
+        }
+        *elements = (T*)array->GetByteBuffer() + start;
+        return true;
+    }
+
+    template<typename T> bool MemarithPartiallyOverlaps(const T* dst, const T* src, uint32 length)
+    {
+        // Reading and writing the same elements is fine; views of one buffer at different offsets are not, since the
+        // kernel doesn't run in the loop's order.
+        return dst != src && dst < src + length && src < dst + length;
+    }
+
+    template<typename Op, typename TArray> bool MemarithTypedArray(Var dstInstance, int32 start, Var src1Instance, Var src2, uint32 length)
+    {
+        typedef typename TArray::TypedArrayType T;
+
+        // Nothing is written unless the whole range can be computed: when the helper fails, the loop runs again from
+        // its start, and updating an array in place is not idempotent.
+        T* dst = nullptr;
+        T* src1 = nullptr;
+        if (!MemarithRange(VarTo<TArray>(dstInstance), start, length, &dst) ||
+            !MemarithRange(VarTo<TArray>(src1Instance), start, length, &src1) ||
+            MemarithPartiallyOverlaps(dst, src1, length))
+        {
+            return false;
+        }
+
+        if (JavascriptOperators::GetTypeId(src2) == JavascriptOperators::GetTypeId(dstInstance))
+        {
+            T* src2Elements = nullptr;
+            if (!MemarithRange(VarTo<TArray>(src2), start, length, &src2Elements) ||
+                MemarithPartiallyOverlaps(dst, src2Elements, length))
+            {
+                return false;
+            }
+            MemArithAccel::Apply<Op>(dst, src1, src2Elements, length);
+            return true;
+        }
+
+        double value;
+        if (TaggedInt::Is(src2))
+        {
+            value = TaggedInt::ToDouble(src2);
+        }
+        else if (JavascriptNumber::Is(src2))
+        {
+            value = JavascriptNumber::GetValue(src2);
+        }
+        else
+        {
+            return false;
+        }
+
+        T typedValue;
+        if (!MemarithNarrow(value, &typedValue))
+        {
+            return MemarithApplyInDouble<Op>(dst, src1, value, length);
+        }
+        MemArithAccel::ApplyScalar<Op>(dst, src1, typedValue, length);
+        return true;
+    }
+
+    BOOL JavascriptOperators::OP_Memarith(Var dstInstance, int32 start, Var src1Instance, Var src2, int32 length, int32 op, ScriptContext* scriptContext)
+    {
+        JIT_HELPER_NOT_REENTRANT_HEADER(Op_Memarith, reentrancylock, scriptContext->GetThreadContext());
+        if (length <= 0 || start < 0)
+        {
+            return false;
+        }
+
+        TypeId instanceType = JavascriptOperators::GetTypeId(dstInstance);
+
+        if (instanceType != JavascriptOperators::GetTypeId(src1Instance))
+        {
+            return false;
+        }
+
+        BOOL  returnValue = false;
+#define MEMARITH_TYPED_ARRAY(operation, type) returnValue = MemarithTypedArray<MemArithAccel::operation, type>(dstInstance, start, src1Instance, src2, (uint32)length)
+        switch (instanceType)
+        {
+        case TypeIds_Int32Array:
+        {
+            // Int32 results wrap when stored, so only add and sub are computed in int32
+            switch ((Js::OpCode)op)
+            {
+            case Js::OpCode::Add_A: MEMARITH_TYPED_ARRAY(Add, Int32Array); break;
+            case Js::OpCode::Sub_A: MEMARITH_TYPED_ARRAY(Sub, Int32Array); break;
+            default: AssertMsg(false, "Unsupported operation for memarith."); break;
+            }
+            break;
+        }
+        case TypeIds_Float32Array:
+        {
+            switch ((Js::OpCode)op)
+            {
+            case Js::OpCode::Add_A: MEMARITH_TYPED_ARRAY(Add, Float32Array); break;
+            case Js::OpCode::Sub_A: MEMARITH_TYPED_ARRAY(Sub, Float32Array); break;
+            case Js::OpCode::Mul_A: MEMARITH_TYPED_ARRAY(Mul, Float32Array); break;
+            case Js::OpCode::Div_A: MEMARITH_TYPED_ARRAY(Div, Float32Array); break;
+            default: AssertMsg(false, "Unsupported operation for memarith."); break;
+            }
+            break;
+        }
+        case TypeIds_Float64Array:
+        {
+            switch ((Js::OpCode)op)
+            {
+            case Js::OpCode::Add_A: MEMARITH_TYPED_ARRAY(Add, Float64Array); break;
+            case Js::OpCode::Sub_A: MEMARITH_TYPED_ARRAY(Sub, Float64Array); break;
+            case Js::OpCode::Mul_A: MEMARITH_TYPED_ARRAY(Mul, Float64Array); break;
+            case Js::OpCode::Div_A: MEMARITH_TYPED_ARRAY(Div, Float64Array); break;
+            default: AssertMsg(false, "Unsupported operation for memarith."); break;
+            }
+            break;
+        }
+        default:
+            AssertMsg(false, "We don't support this type for memarith yet.");
+            break;
+        }
+#undef MEMARITH_TYPED_ARRAY
+        return returnValue;
+        JIT_HELPER_END(Op_Memarith);
+    }
+
     Var JavascriptOperators::OP_DeleteElementI_UInt32(Var instance, uint32 index, ScriptContext* scriptContext, PropertyOperationFlags propertyOperationFlags)
     {
         JIT_HELPER_REENTRANT_HEADER(Op_DeleteElementI_UInt32);
@@ -0,0 +1,190 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// MemArithAccel.h
+//
+// Header-only elementwise kernels for the Memarith MemOp (JavascriptOperators::OP_Memarith), which the
+// full JIT emits in place of typed array loops of the form
+//     for (i = ...) a[i] = b[i] op c[i];    or    a[i] = b[i] op invariant;
+//
+// Each kernel runs 128-bit vector steps (4 int32/float lanes or 2 double lanes) and finishes the last
+// count % lanes elements with the scalar operation. int32 arithmetic wraps, which is what storing the
+// JS result into an Int32Array does; float and double lanes compute the same IEEE results as the scalar
+// path. Only add and sub are provided for int32.
+//
+// SSE2 on x86/x64, NEON on ARM64. When MEM_ARITH_ACCEL_AVAILABLE is 0 the kernels only run the scalar loop.
+//
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(CHAKRA_NEON_DISABLED)
+#include <arm_neon.h>
+#define MEM_ARITH_ACCEL_NEON 1
+#define MEM_ARITH_ACCEL_AVAILABLE 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#define MEM_ARITH_ACCEL_SSE2 1
+#define MEM_ARITH_ACCEL_AVAILABLE 1
+#else
+#define MEM_ARITH_ACCEL_AVAILABLE 0
+#endif
+
+namespace MemArithAccel
+{
+
+// One 128-bit vector of T: its lane count, load/store/splat and the lane-wise operations.
+template <typename T> struct Lanes;
+
+#if MEM_ARITH_ACCEL_SSE2
+
+template <> struct Lanes<int32>
+{
+    typedef __m128i Vector;
+    static const uint32 Count = 4;
+    static Vector Load(const int32* p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+    static void Store(int32* p, Vector v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    static Vector Splat(int32 value) { return _mm_set1_epi32(value); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_epi32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_epi32(a, b); }
+};
+
+template <> struct Lanes<float>
+{
+    typedef __m128 Vector;
+    static const uint32 Count = 4;
+    static Vector Load(const float* p) { return _mm_loadu_ps(p); }
+    static void Store(float* p, Vector v) { _mm_storeu_ps(p, v); }
+    static Vector Splat(float value) { return _mm_set1_ps(value); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_ps(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_ps(a, b); }
+    static Vector Mul(Vector a, Vector b) { return _mm_mul_ps(a, b); }
+    static Vector Div(Vector a, Vector b) { return _mm_div_ps(a, b); }
+};
+
+template <> struct Lanes<double>
+{
+    typedef __m128d Vector;
+    static const uint32 Count = 2;
+    static Vector Load(const double* p) { return _mm_loadu_pd(p); }
+    static void Store(double* p, Vector v) { _mm_storeu_pd(p, v); }
+    static Vector Splat(double value) { return _mm_set1_pd(value); }
+    static Vector Add(Vector a, Vector b) { return _mm_add_pd(a, b); }
+    static Vector Sub(Vector a, Vector b) { return _mm_sub_pd(a, b); }
+    static Vector Mul(Vector a, Vector b) { return _mm_mul_pd(a, b); }
+    static Vector Div(Vector a, Vector b) { return _mm_div_pd(a, b); }
+};
+
+#elif MEM_ARITH_ACCEL_NEON
+
+template <> struct Lanes<int32>
+{
+    typedef int32x4_t Vector;
+    static const uint32 Count = 4;
+    static Vector Load(const int32* p) { return vld1q_s32(p); }
+    static void Store(int32* p, Vector v) { vst1q_s32(p, v); }
+    static Vector Splat(int32 value) { return vdupq_n_s32(value); }
+    static Vector Add(Vector a, Vector b) { return vaddq_s32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_s32(a, b); }
+};
+
+template <> struct Lanes<float>
+{
+    typedef float32x4_t Vector;
+    static const uint32 Count = 4;
+    static Vector Load(const float* p) { return vld1q_f32(p); }
+    static void Store(float* p, Vector v) { vst1q_f32(p, v); }
+    static Vector Splat(float value) { return vdupq_n_f32(value); }
+    static Vector Add(Vector a, Vector b) { return vaddq_f32(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_f32(a, b); }
+    static Vector Mul(Vector a, Vector b) { return vmulq_f32(a, b); }
+    static Vector Div(Vector a, Vector b) { return vdivq_f32(a, b); }
+};
+
+template <> struct Lanes<double>
+{
+    typedef float64x2_t Vector;
+    static const uint32 Count = 2;
+    static Vector Load(const double* p) { return vld1q_f64(p); }
+    static void Store(double* p, Vector v) { vst1q_f64(p, v); }
+    static Vector Splat(double value) { return vdupq_n_f64(value); }
+    static Vector Add(Vector a, Vector b) { return vaddq_f64(a, b); }
+    static Vector Sub(Vector a, Vector b) { return vsubq_f64(a, b); }
+    static Vector Mul(Vector a, Vector b) { return vmulq_f64(a, b); }
+    static Vector Div(Vector a, Vector b) { return vdivq_f64(a, b); }
+};
+
+#endif
+
+struct Add
+{
+    static int32 Scalar(int32 a, int32 b) { return (int32)((uint32)a + (uint32)b); }
+    static float Scalar(float a, float b) { return a + b; }
+    static double Scalar(double a, double b) { return a + b; }
+    template <typename T>
+    static typename Lanes<T>::Vector Vector(typename Lanes<T>::Vector a, typename Lanes<T>::Vector b) { return Lanes<T>::Add(a, b); }
+};
+
+struct Sub
+{
+    static int32 Scalar(int32 a, int32 b) { return (int32)((uint32)a - (uint32)b); }
+    static float Scalar(float a, float b) { return a - b; }
+    static double Scalar(double a, double b) { return a - b; }
+    template <typename T>
+    static typename Lanes<T>::Vector Vector(typename Lanes<T>::Vector a, typename Lanes<T>::Vector b) { return Lanes<T>::Sub(a, b); }
+};
+
+struct Mul
+{
+    static float Scalar(float a, float b) { return a * b; }
+    static double Scalar(double a, double b) { return a * b; }
+    template <typename T>
+    static typename Lanes<T>::Vector Vector(typename Lanes<T>::Vector a, typename Lanes<T>::Vector b) { return Lanes<T>::Mul(a, b); }
+};
+
+struct Div
+{
+    static float Scalar(float a, float b) { return a / b; }
+    static double Scalar(double a, double b) { return a / b; }
+    template <typename T>
+    static typename Lanes<T>::Vector Vector(typename Lanes<T>::Vector a, typename Lanes<T>::Vector b) { return Lanes<T>::Div(a, b); }
+};
+
+// dst[i] = src1[i] op src2[i] for i in [0, count). dst may be src1 or src2, but must not partially overlap them.
+template <typename Op, typename T>
+inline void Apply(T* dst, const T* src1, const T* src2, uint32 count)
+{
+    uint32 i = 0;
+#if MEM_ARITH_ACCEL_AVAILABLE
+    for (; i + Lanes<T>::Count <= count; i += Lanes<T>::Count)
+    {
+        Lanes<T>::Store(dst + i, Op::template Vector<T>(Lanes<T>::Load(src1 + i), Lanes<T>::Load(src2 + i)));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = Op::Scalar(src1[i], src2[i]);
+    }
+}
+
+// dst[i] = src1[i] op value for i in [0, count). dst may be src1, but must not partially overlap it.
+template <typename Op, typename T>
+inline void ApplyScalar(T* dst, const T* src1, T value, uint32 count)
+{
+    uint32 i = 0;
+#if MEM_ARITH_ACCEL_AVAILABLE
+    const typename Lanes<T>::Vector splat = Lanes<T>::Splat(value);
+    for (; i + Lanes<T>::Count <= count; i += Lanes<T>::Count)
+    {
+        Lanes<T>::Store(dst + i, Op::template Vector<T>(Lanes<T>::Load(src1 + i), splat));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        dst[i] = Op::Scalar(src1[i], value);
+    }
+}
+
+} // namespace MemArithAccel
@@ -26,6 +26,7 @@
 #include "Language/DynamicProfileStorage.h"
 #endif
 #include "Language/SourceDynamicProfileManager.h"
+#include "Language/TierUpCache.h"
 #include "Language/SimpleDataCacheWrapper.h"
 
 #include "Base/EtwTrace.h"
@@ -33,6 +34,7 @@
 #include "Library/ArgumentsObject.h"
 
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 #include "Library/JavascriptAsyncFromSyncIterator.h"
 #ifdef _CHAKRACOREBUILD
 #include "Library/CustomExternalWrapperObject.h"
@@ -24,6 +24,12 @@ namespace Js
         DynamicProfileInfo * dynamicProfileInfo = nullptr;
         if (dynamicProfileInfoMap.Count() > 0 && dynamicProfileInfoMap.TryGetValue(functionId, &dynamicProfileInfo))
         {
+#if ENABLE_TIER_UP_CACHE
+            if (!MatchTierUpCacheGuard(functionBody))
+            {
+                return nullptr;
+            }
+#endif
             if (dynamicProfileInfo->MatchFunctionBody(functionBody))
             {
                 return dynamicProfileInfo;
@@ -36,12 +42,46 @@ namespace Js
                     functionId, functionBody->GetSourceContextInfo()->url);
                 Output::Flush();
             }
+#endif
+#if ENABLE_TIER_UP_CACHE
+            if (tierUpCachedFunctions != nullptr && functionId < tierUpCachedFunctions->Length())
+            {
+                tierUpCachedFunctions->Clear(functionId);
+            }
 #endif
             // NOTE: We have profile mismatch, we can invalidate all other profile here.
         }
         return nullptr;
     }
 
+#if ENABLE_TIER_UP_CACHE
+    bool
+    SourceDynamicProfileManager::MatchTierUpCacheGuard(FunctionBody * functionBody)
+    {
+        Js::LocalFunctionId functionId = functionBody->GetLocalFunctionId();
+        TierUpCacheGuard guard;
+        if (tierUpCacheGuards == nullptr || !tierUpCacheGuards->TryGetValueAndRemove(functionId, &guard))
+        {
+            return true;
+        }
+
+        // The function has to be the one whose profile was saved, and not just one with the same id
+        if (guard.sourceLength == functionBody->LengthInBytes() && guard.byteCodeCount == functionBody->GetByteCodeCount()
+            && guard.sourceHash == TierUpCache::GetSourceHash(functionBody))
+        {
+            PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: Restored the profile of %s\n"), functionBody->GetDisplayName());
+            return true;
+        }
+
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("TierUpCache: Profile rejected for function %d in %s\n"),
+            functionId, functionBody->GetSourceContextInfo()->url);
+        PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: Profile rejected for %s\n"), functionBody->GetDisplayName());
+        dynamicProfileInfoMap.Remove(functionId);
+        tierUpCachedFunctions->Clear(functionId);
+        return false;
+    }
+#endif
+
     void SourceDynamicProfileManager::UpdateDynamicProfileInfo(LocalFunctionId functionId, DynamicProfileInfo * dynamicProfileInfo)
     {
         Assert(dynamicProfileInfo != nullptr);
@@ -272,6 +312,12 @@ namespace Js
                 return SourceDynamicProfileManager::Deserialize(&reader, recycler);
             });
         }
+#endif
+#if ENABLE_TIER_UP_CACHE
+        if(manager == nullptr && TierUpCache::IsEnabled() && info->url != nullptr && !info->IsDynamic())
+        {
+            manager = TierUpCache::Load(info->url, recycler);
+        }
 #endif
         if(manager == nullptr)
         {
@@ -288,6 +334,79 @@ namespace Js
         return manager;
     }
 
+#if ENABLE_TIER_UP_CACHE
+    SourceDynamicProfileManager *
+    SourceDynamicProfileManager::DeserializeTierUpCache(BufferReader * reader, Recycler* recycler)
+    {
+        uint functionCount;
+        uint entryCount;
+        if (!reader->Read(&functionCount) || !reader->Read(&entryCount) || functionCount == 0 || entryCount > functionCount)
+        {
+            return nullptr;
+        }
+
+        // The record holds a bit per function, so the function count can't make the bit vector bigger than the record
+        size_t bitsSize = TierUpCache::GetFunctionBitsSize(functionCount);
+        if (bitsSize > reader->GetLengthLeft())
+        {
+            return nullptr;
+        }
+
+        BVFixed * functions = BVFixed::New(functionCount, recycler);
+        for (size_t i = 0; i < bitsSize; i++)
+        {
+            byte bits;
+            if (!reader->Read(&bits))
+            {
+                return nullptr;
+            }
+            for (uint j = 0; bits != 0; j++, bits >>= 1)
+            {
+                uint functionId = (uint)(i * 8 + j);
+                if ((bits & 1) != 0)
+                {
+                    if (functionId >= functionCount)
+                    {
+                        return nullptr;
+                    }
+                    functions->Set(functionId);
+                }
+            }
+        }
+        if (functions->Count() != entryCount)
+        {
+            return nullptr;
+        }
+
+        SourceDynamicProfileManager * sourceDynamicProfileManager = RecyclerNew(recycler, SourceDynamicProfileManager, recycler);
+        sourceDynamicProfileManager->tierUpCacheGuards = RecyclerNew(recycler, TierUpCacheGuardMapType, recycler);
+
+        for (uint i = 0; i < entryCount; i++)
+        {
+            TierUpCacheGuard guard;
+            if (!reader->Read(&guard))
+            {
+                return nullptr;
+            }
+
+            Js::LocalFunctionId functionId;
+            DynamicProfileInfo * dynamicProfileInfo = DynamicProfileInfo::Deserialize(reader, recycler, &functionId);
+            if (dynamicProfileInfo == nullptr || functionId >= functionCount || !functions->Test(functionId)
+                || sourceDynamicProfileManager->tierUpCacheGuards->ContainsKey(functionId))
+            {
+                return nullptr;
+            }
+            sourceDynamicProfileManager->dynamicProfileInfoMap.Item(functionId, dynamicProfileInfo);
+            sourceDynamicProfileManager->tierUpCacheGuards->Item(functionId, guard);
+        }
+
+        // The functions are not deferred when the script is parsed, so that they can be jitted as soon as they are called
+        sourceDynamicProfileManager->tierUpCachedFunctions = functions;
+        sourceDynamicProfileManager->cachedStartupFunctions = functions;
+        return sourceDynamicProfileManager;
+    }
+#endif
+
 #ifdef DYNAMIC_PROFILE_STORAGE
     void SourceDynamicProfileManager::ClearSavingData()
     {
@@ -412,7 +531,7 @@ namespace Js
                 continue;
             }
 
-            if (!dynamicProfileInfo->Serialize(writer))
+            if (!dynamicProfileInfo->Serialize(dynamicProfileInfo->GetFunctionBody(), writer))
             {
                 return false;
             }
@@ -14,6 +14,17 @@ namespace Js
         ExecutionFlags_Executed = 0x01,
         ExecutionFlags_HasNoInfo = 0x02
     };
+
+#if ENABLE_TIER_UP_CACHE
+    // What a function looked like when its profile was saved to the tier-up cache
+    struct TierUpCacheGuard
+    {
+        uint32 sourceHash;
+        uint32 sourceLength;
+        uint32 byteCodeCount;
+    };
+#endif
+
     //
     // For every source file, an instance of SourceDynamicProfileManager is used to save/load data.
     // It uses the WININET cache to save/load profile data.
@@ -25,7 +36,10 @@ namespace Js
 #ifdef DYNAMIC_PROFILE_STORAGE
             dynamicProfileInfoMapSaving(&HeapAllocator::Instance),
 #endif
-            dynamicProfileInfoMap(allocator), startupFunctions(nullptr), dataCacheWrapper(nullptr) 
+            dynamicProfileInfoMap(allocator), startupFunctions(nullptr), dataCacheWrapper(nullptr)
+#if ENABLE_TIER_UP_CACHE
+            , tierUpCacheGuards(nullptr), tierUpCachedFunctions(nullptr)
+#endif
         {
         }
 
@@ -47,9 +61,21 @@ namespace Js
 #ifdef DYNAMIC_PROFILE_STORAGE
         void ClearSavingData();
 #endif
+#if ENABLE_TIER_UP_CACHE
+        bool IsFunctionTierUpCached(LocalFunctionId functionId) const
+        {
+            return tierUpCachedFunctions != nullptr && functionId < tierUpCachedFunctions->Length() && tierUpCachedFunctions->Test(functionId);
+        }
+#endif
 
     private:
         friend class DynamicProfileInfo;
+#if ENABLE_TIER_UP_CACHE
+        friend class TierUpCache;
+
+        static SourceDynamicProfileManager * DeserializeTierUpCache(BufferReader * reader, Recycler* recycler);
+        bool MatchTierUpCacheGuard(FunctionBody * functionBody);
+#endif
         FieldNoBarrier(Recycler*) recycler;
 
 #ifdef DYNAMIC_PROFILE_STORAGE
@@ -78,6 +104,11 @@ namespace Js
                                                             // It's not modified but used as an input for deferred parsing/bytecodegen
         typedef JsUtil::BaseDictionary<LocalFunctionId, DynamicProfileInfo *, Recycler, PowerOf2SizePolicy>  DynamicProfileInfoMapType;
         Field(DynamicProfileInfoMapType) dynamicProfileInfoMap;
+#if ENABLE_TIER_UP_CACHE
+        typedef JsUtil::BaseDictionary<LocalFunctionId, TierUpCacheGuard, Recycler, PowerOf2SizePolicy> TierUpCacheGuardMapType;
+        Field(TierUpCacheGuardMapType *) tierUpCacheGuards; // Functions restored from the tier-up cache that are not yet checked against their guard
+        Field(BVFixed *) tierUpCachedFunctions;             // Functions with a profile from the tier-up cache; cleared when the guard does not match
+#endif
 
         static const uint MAX_FUNCTION_COUNT = 10000;  // Consider data corrupt if there are more functions than this
     };
@@ -0,0 +1,172 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// StringSearchAccel.h
+//
+// Header-only SIMD substring search over UTF-16 buffers, used by String.prototype.indexOf/includes/
+// lastIndexOf and string-separator split (through JavascriptString::strstr).
+//
+// The search compares 8 candidate positions per step against two anchors, the first and the last code
+// unit of the needle, and only runs a full compare for positions where both match. For a single code
+// unit needle both anchors are the same unit, which turns the search into a vectorized memchr.
+//
+// SSE2 on x86/x64, NEON on ARM64. All functions are gated on STRING_SEARCH_ACCEL_AVAILABLE; when it is
+// 0 callers keep their scalar (Boyer-Moore / first char) paths.
+//
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(CHAKRA_NEON_DISABLED)
+#include <arm_neon.h>
+#define STRING_SEARCH_ACCEL_NEON 1
+#define STRING_SEARCH_ACCEL_AVAILABLE 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <emmintrin.h>
+#define STRING_SEARCH_ACCEL_SSE2 1
+#define STRING_SEARCH_ACCEL_AVAILABLE 1
+#else
+#define STRING_SEARCH_ACCEL_AVAILABLE 0
+#endif
+
+#if STRING_SEARCH_ACCEL_AVAILABLE
+
+namespace StringSearchAccel
+{
+
+// Needles at least this long that are pure ASCII go to the Boyer-Moore jump table search instead:
+// its skip distance grows with the needle, while the anchored search always advances 8 positions.
+const charcount_t MaxAnchoredNeedleLength = 32;
+
+// Candidate positions compared per step (one 128-bit vector of char16).
+const charcount_t LanesPerStep = 8;
+
+#if STRING_SEARCH_ACCEL_SSE2
+
+// Bits per lane in the mask returned by AnchorMatchMask.
+const DWORD MaskBitsPerLane = 2;
+
+inline uint64 AnchorMatchMask(const char16* position, charcount_t lastOffset, __m128i first, __m128i last)
+{
+    __m128i atFirst = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+    __m128i atLast = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position + lastOffset));
+    __m128i matches = _mm_and_si128(_mm_cmpeq_epi16(atFirst, first), _mm_cmpeq_epi16(atLast, last));
+    return (uint64)(uint32)_mm_movemask_epi8(matches);
+}
+
+#define STRING_SEARCH_ACCEL_SPLAT(c) _mm_set1_epi16(static_cast<short>(c))
+typedef __m128i AnchorVector;
+
+#else // STRING_SEARCH_ACCEL_NEON
+
+const DWORD MaskBitsPerLane = 8;
+
+inline uint64 AnchorMatchMask(const char16* position, charcount_t lastOffset, uint16x8_t first, uint16x8_t last)
+{
+    uint16x8_t atFirst = vld1q_u16(reinterpret_cast<const uint16_t*>(position));
+    uint16x8_t atLast = vld1q_u16(reinterpret_cast<const uint16_t*>(position + lastOffset));
+    uint16x8_t matches = vandq_u16(vceqq_u16(atFirst, first), vceqq_u16(atLast, last));
+    // Narrow each 16-bit lane to 8 bits so the whole mask fits in a general purpose register
+    uint8x8_t narrowed = vshrn_n_u16(matches, 4);
+    return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+}
+
+#define STRING_SEARCH_ACCEL_SPLAT(c) vdupq_n_u16(static_cast<uint16_t>(c))
+typedef uint16x8_t AnchorVector;
+
+#endif
+
+inline bool MiddleMatches(const char16* candidate, const char16* needle, charcount_t needleLen)
+{
+    // The anchors already matched the first and last unit
+    return needleLen <= 2 || wmemcmp(candidate + 1, needle + 1, needleLen - 2) == 0;
+}
+
+// Returns the smallest index k in [0, hayLen - needleLen] where needle occurs in hay, or -1.
+inline int32 IndexOf(const char16* hay, charcount_t hayLen, const char16* needle, charcount_t needleLen)
+{
+    Assert(needleLen > 0);
+    if (needleLen > hayLen)
+    {
+        return -1;
+    }
+
+    const charcount_t lastOffset = needleLen - 1;
+    const charcount_t candidates = hayLen - needleLen + 1;
+    const AnchorVector first = STRING_SEARCH_ACCEL_SPLAT(needle[0]);
+    const AnchorVector last = STRING_SEARCH_ACCEL_SPLAT(needle[lastOffset]);
+
+    charcount_t i = 0;
+    for (; i + LanesPerStep <= candidates; i += LanesPerStep)
+    {
+        uint64 mask = AnchorMatchMask(hay + i, lastOffset, first, last);
+        while (mask != 0)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, mask);
+            const charcount_t candidate = i + bit / MaskBitsPerLane;
+            if (MiddleMatches(hay + candidate, needle, needleLen))
+            {
+                return (int32)candidate;
+            }
+            mask &= ~((((uint64)1 << MaskBitsPerLane) - 1) << (bit - bit % MaskBitsPerLane));
+        }
+    }
+
+    for (; i < candidates; i++)
+    {
+        if (hay[i] == needle[0] && hay[i + lastOffset] == needle[lastOffset] && MiddleMatches(hay + i, needle, needleLen))
+        {
+            return (int32)i;
+        }
+    }
+    return -1;
+}
+
+// Returns the largest index k in [0, maxStart] where needle occurs in hay, or -1.
+// The caller guarantees maxStart + needleLen <= hayLen.
+inline int32 LastIndexOf(const char16* hay, charcount_t maxStart, const char16* needle, charcount_t needleLen)
+{
+    Assert(needleLen > 0);
+
+    const charcount_t lastOffset = needleLen - 1;
+    const AnchorVector first = STRING_SEARCH_ACCEL_SPLAT(needle[0]);
+    const AnchorVector last = STRING_SEARCH_ACCEL_SPLAT(needle[lastOffset]);
+
+    // Candidates [0, end) are still to be checked
+    charcount_t end = maxStart + 1;
+    for (; end >= LanesPerStep; end -= LanesPerStep)
+    {
+        const charcount_t blockStart = end - LanesPerStep;
+        uint64 mask = AnchorMatchMask(hay + blockStart, lastOffset, first, last);
+        while (mask != 0)
+        {
+            DWORD bit;
+            GetLastBitSet(&bit, mask);
+            const charcount_t candidate = blockStart + bit / MaskBitsPerLane;
+            if (MiddleMatches(hay + candidate, needle, needleLen))
+            {
+                return (int32)candidate;
+            }
+            mask &= ~((((uint64)1 << MaskBitsPerLane) - 1) << (bit - bit % MaskBitsPerLane));
+        }
+    }
+
+    while (end > 0)
+    {
+        end--;
+        if (hay[end] == needle[0] && hay[end + lastOffset] == needle[lastOffset] && MiddleMatches(hay + end, needle, needleLen))
+        {
+            return (int32)end;
+        }
+    }
+    return -1;
+}
+
+#undef STRING_SEARCH_ACCEL_SPLAT
+
+} // namespace StringSearchAccel
+
+#endif // STRING_SEARCH_ACCEL_AVAILABLE
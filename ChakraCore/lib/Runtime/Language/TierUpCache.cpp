@@ -0,0 +1,457 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLanguagePch.h"
+
+#if ENABLE_TIER_UP_CACHE
+#include "ByteCode/ByteCodeCacheReleaseFileVersion.h"
+
+namespace Js
+{
+    TierUpCache::RecordMap TierUpCache::records(&NoCheckHeapAllocator::Instance);
+    CriticalSection TierUpCache::cs;
+    bool TierUpCache::imported = false;
+    bool TierUpCache::modified = false;
+
+    DWORD const TierUpCache::MagicNumber = 20260904;
+    DWORD const TierUpCache::FileFormatVersion = 3;
+    DWORD const TierUpCache::MaxUrlLength = 32 * 1024;
+    DWORD const TierUpCache::MaxRecordSize = 64 * 1024 * 1024;
+
+    class TierUpCacheFile
+    {
+    public:
+        TierUpCacheFile() : file(nullptr) {}
+        ~TierUpCacheFile() { Close(); }
+
+        bool Open(__in_z char16 const * filename, __in_z char16 const * mode)
+        {
+            Assert(file == nullptr);
+            return _wfopen_s(&file, filename, mode) == 0 && file != nullptr;
+        }
+
+        template <typename T>
+        bool Read(T * t) { return ReadArray(t, 1); }
+        template <typename T>
+        bool ReadArray(T * t, size_t len) { return fread(t, sizeof(T), len, file) == len; }
+
+        template <typename T>
+        bool Write(T const& t) { return WriteArray(&t, 1); }
+        template <typename T>
+        bool WriteArray(T const * t, size_t len) { return fwrite(t, sizeof(T), len, file) == len; }
+
+        bool Close()
+        {
+            if (file == nullptr)
+            {
+                return true;
+            }
+            bool success = fclose(file) == 0;
+            file = nullptr;
+            return success;
+        }
+
+    private:
+        FILE * file;
+    };
+
+    void
+    TierUpCache::Uninitialize()
+    {
+        if (!IsEnabled())
+        {
+            return;
+        }
+
+        AutoCriticalSection autocs(&cs);
+        if (modified)
+        {
+            char16 const * filename = Configuration::Global.flags.TierUpCache;
+            if (!ExportFile(filename))
+            {
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("TierUpCache: Unable to write '%s'\n"), filename);
+            }
+            modified = false;
+        }
+        ClearRecords();
+        imported = false;
+    }
+
+    void
+    TierUpCache::EnsureImported()
+    {
+        Assert(cs.IsLocked());
+        if (imported)
+        {
+            return;
+        }
+
+        // Whatever could be read before a failure has been checked, so it is kept
+        imported = true;
+        if (!ImportFile(Configuration::Global.flags.TierUpCache))
+        {
+            PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: Unable to read the whole file\n"));
+        }
+    }
+
+    SourceDynamicProfileManager *
+    TierUpCache::Load(__in_z char16 const * url, Recycler * recycler)
+    {
+        Assert(IsEnabled());
+        AutoCriticalSection autocs(&cs);
+        EnsureImported();
+
+        char * record;
+        if (!records.TryGetValue(url, &record))
+        {
+            return nullptr;
+        }
+
+        BufferReader reader(GetRecordBuffer(record), GetRecordSize(record));
+        SourceDynamicProfileManager * manager = SourceDynamicProfileManager::DeserializeTierUpCache(&reader, recycler);
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("TierUpCache: %s profiles for '%s'\n"), manager != nullptr ? _u("Loaded") : _u("Unable to load"), url);
+        PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: %s\n"), manager != nullptr ? _u("Loaded the cached profiles") : _u("Unable to load the cached profiles"));
+        return manager;
+    }
+
+    uint32
+    TierUpCache::GetSourceHash(FunctionBody * functionBody)
+    {
+        LPCUTF8 source = functionBody->GetSource(_u("TierUpCache::GetSourceHash"));
+        uint32 hash = CC_HASH_OFFSET_VALUE;
+        for (uint i = 0; i < functionBody->LengthInBytes(); i++)
+        {
+            CC_HASH_LOGIC(hash, source[i]);
+        }
+        return hash;
+    }
+
+    size_t
+    TierUpCache::GetFunctionBitsSize(uint functionCount)
+    {
+        return ((size_t)functionCount + 7) / 8;
+    }
+
+    DWORD
+    TierUpCache::GetChecksum(__in_ecount(size) char const * buffer, DWORD size)
+    {
+        DWORD hash = CC_HASH_OFFSET_VALUE;
+        for (DWORD i = 0; i < size; i++)
+        {
+            CC_HASH_LOGIC(hash, (byte)buffer[i]);
+        }
+        return hash;
+    }
+
+    bool
+    TierUpCache::ShouldSave(FunctionBody * functionBody)
+    {
+        if (!functionBody->HasDynamicProfileInfo() || functionBody->IsInDebugMode() ||
+            functionBody->GetIsAsmjsMode() || functionBody->IsJsBuiltInCode())
+        {
+            return false;
+        }
+
+        FunctionEntryPointInfo * entryPointInfo = functionBody->GetDefaultFunctionEntryPointInfo();
+        if (entryPointInfo != nullptr && entryPointInfo->IsCodeGenDone() && entryPointInfo->GetJitMode() == ExecutionMode::FullJit)
+        {
+            return true;
+        }
+
+        // A profile restored from the cache is kept even if this run ended before the function was jitted again
+        SourceDynamicProfileManager * manager = functionBody->GetSourceContextInfo()->sourceDynamicProfileManager;
+        return manager != nullptr && manager->IsFunctionTierUpCached(functionBody->GetLocalFunctionId());
+    }
+
+    template <typename Fn>
+    void
+    TierUpCache::MapFunctionsToSave(ScriptContext * scriptContext, SourceContextInfo * sourceContextInfo, Fn fn)
+    {
+        // A host can run several scripts under one source context; their function ids do not overlap
+        scriptContext->GetSourceList()->Map([&](int, RecyclerWeakReference<Utf8SourceInfo> * sourceInfoWeakRef)
+        {
+            Utf8SourceInfo * sourceInfo = sourceInfoWeakRef->Get();
+            if (sourceInfo == nullptr || sourceInfo->GetSourceContextInfo() != sourceContextInfo)
+            {
+                return;
+            }
+
+            sourceInfo->MapFunction([&](FunctionBody * functionBody)
+            {
+                if (ShouldSave(functionBody))
+                {
+                    fn(functionBody);
+                }
+            });
+        });
+    }
+
+    template <typename T>
+    bool
+    TierUpCache::SerializeFunction(FunctionBody * functionBody, T * writer)
+    {
+        TierUpCacheGuard guard = { GetSourceHash(functionBody), functionBody->LengthInBytes(), functionBody->GetByteCodeCount() };
+        return writer->Write(guard) && functionBody->GetAnyDynamicProfileInfo()->Serialize(functionBody, writer);
+    }
+
+    void
+    TierUpCache::Save(ScriptContext * scriptContext)
+    {
+        Assert(IsEnabled());
+        if (scriptContext->GetSourceList() == nullptr || scriptContext->GetSourceContextInfoMap() == nullptr)
+        {
+            return;
+        }
+
+        scriptContext->GetSourceContextInfoMap()->Map([&](DWORD_PTR, SourceContextInfo * sourceContextInfo)
+        {
+            if (sourceContextInfo->url != nullptr && !sourceContextInfo->IsDynamic())
+            {
+                SaveSource(scriptContext, sourceContextInfo);
+            }
+        });
+    }
+
+    void
+    TierUpCache::SaveSource(ScriptContext * scriptContext, SourceContextInfo * sourceContextInfo)
+    {
+        // Record: function count, entry count, a bit per function that has an entry, then the guard and the
+        // profile of each function
+        uint functionCount = 0;
+        uint entryCount = 0;
+        BufferSizeCounter counter;
+        bool success = counter.Write(functionCount) && counter.Write(entryCount);
+        MapFunctionsToSave(scriptContext, sourceContextInfo, [&](FunctionBody * functionBody)
+        {
+            success = success && SerializeFunction(functionBody, &counter);
+            functionCount = max(functionCount, functionBody->GetLocalFunctionId() + 1);
+            entryCount++;
+        });
+
+        // With nothing fully jitted in this run, keep what an earlier run saved
+        size_t bitsSize = GetFunctionBitsSize(functionCount);
+        if (!success || entryCount == 0 || counter.GetByteCount() + bitsSize > MaxRecordSize)
+        {
+            return;
+        }
+
+        DWORD recordSize = static_cast<DWORD>(counter.GetByteCount() + bitsSize);
+        char * record = AllocRecord(recordSize);
+        if (record == nullptr)
+        {
+            return;
+        }
+
+        byte * bits = NoCheckHeapNewArrayZ(byte, bitsSize);
+        if (bits == nullptr)
+        {
+            DeleteRecord(record);
+            return;
+        }
+        MapFunctionsToSave(scriptContext, sourceContextInfo, [&](FunctionBody * functionBody)
+        {
+            LocalFunctionId functionId = functionBody->GetLocalFunctionId();
+            success = success && functionId < functionCount;
+            if (success)
+            {
+                bits[functionId / 8] |= (byte)(1 << (functionId % 8));
+            }
+        });
+
+        BufferWriter writer(GetRecordBuffer(record), recordSize);
+        success = success && writer.Write(functionCount) && writer.Write(entryCount) && writer.WriteArray(bits, bitsSize);
+        NoCheckHeapDeleteArray(bitsSize, bits);
+
+        uint writtenCount = 0;
+        MapFunctionsToSave(scriptContext, sourceContextInfo, [&](FunctionBody * functionBody)
+        {
+            success = success && SerializeFunction(functionBody, &writer);
+            writtenCount++;
+        });
+
+        // A background job may have finished jitting a function between the passes
+        if (!success || writtenCount != entryCount)
+        {
+            DeleteRecord(record);
+            return;
+        }
+
+        OUTPUT_TRACE(Js::DynamicProfilePhase, _u("TierUpCache: Saved %d profiles for '%s'\n"), entryCount, sourceContextInfo->url);
+        PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: Saved the profiles of %d functions\n"), entryCount);
+        SaveRecord(sourceContextInfo->url, record);
+    }
+
+    void
+    TierUpCache::SaveRecord(__in_z char16 const * url, __in_ecount(sizeof(DWORD) + *record) char * record)
+    {
+        AutoCriticalSection autocs(&cs);
+        EnsureImported();
+
+        char ** oldRecord;
+        if (records.TryGetReference(url, &oldRecord))
+        {
+            DeleteRecord(*oldRecord);
+            *oldRecord = record;
+            modified = true;
+            return;
+        }
+
+        size_t length = wcslen(url);
+        char16 * urlCopy = NoCheckHeapNewArray(char16, length + 1);
+        if (urlCopy == nullptr)
+        {
+            DeleteRecord(record);
+            return;
+        }
+        wmemcpy_s(urlCopy, length + 1, url, length + 1);
+
+        records.Add(urlCopy, record);
+        modified = true;
+    }
+
+    void
+    TierUpCache::ClearRecords()
+    {
+        records.Map([](char16 const * url, char * record)
+        {
+            NoCheckHeapDeleteArray(wcslen(url) + 1, url);
+            DeleteRecord(record);
+        });
+        records.Clear();
+    }
+
+    char *
+    TierUpCache::AllocRecord(DWORD bufferSize)
+    {
+        char * record = NoCheckHeapNewArray(char, sizeof(DWORD) + bufferSize);
+        if (record != nullptr)
+        {
+            *(DWORD *)record = bufferSize;
+        }
+        return record;
+    }
+
+    void
+    TierUpCache::DeleteRecord(__in_ecount(sizeof(DWORD) + *record) char * record)
+    {
+        NoCheckHeapDeleteArray(sizeof(DWORD) + GetRecordSize(record), record);
+    }
+
+    //
+    // File: magic, format version, byte code version, pointer size, record count, then for each record
+    // the url length and url, and the checksum, size and contents of the record.
+    //
+    bool
+    TierUpCache::ImportFile(__in_z char16 const * filename)
+    {
+        TierUpCacheFile file;
+        if (!file.Open(filename, _u("rb")))
+        {
+            // Nothing was saved yet
+            return true;
+        }
+
+        DWORD magic;
+        DWORD version;
+        GUID byteCodeVersion;
+        DWORD pointerSize;
+        DWORD recordCount;
+        if (!file.Read(&magic) || !file.Read(&version) || !file.Read(&byteCodeVersion)
+            || !file.Read(&pointerSize) || !file.Read(&recordCount))
+        {
+            return false;
+        }
+
+        if (magic != MagicNumber || version != FileFormatVersion
+            || byteCodeVersion != byteCodeCacheReleaseFileVersion || pointerSize != sizeof(void *))
+        {
+            OUTPUT_TRACE(Js::DynamicProfilePhase, _u("TierUpCache: '%s' is from another build; ignored\n"), filename);
+            PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: The file is from another build; ignored\n"));
+            return false;
+        }
+
+        for (DWORD i = 0; i < recordCount; i++)
+        {
+            DWORD urlLength;
+            if (!file.Read(&urlLength) || urlLength == 0 || urlLength > MaxUrlLength)
+            {
+                return false;
+            }
+
+            char16 * url = NoCheckHeapNewArray(char16, urlLength + 1);
+            if (url == nullptr)
+            {
+                return false;
+            }
+
+            DWORD checksum;
+            DWORD recordSize;
+            char * record = nullptr;
+            if (!file.ReadArray(url, urlLength) || !file.Read(&checksum) || !file.Read(&recordSize)
+                || recordSize > MaxRecordSize || (record = AllocRecord(recordSize)) == nullptr
+                || !file.ReadArray(GetRecordBuffer(record), recordSize))
+            {
+                NoCheckHeapDeleteArray(urlLength + 1, url);
+                if (record != nullptr)
+                {
+                    DeleteRecord(record);
+                }
+                return false;
+            }
+            url[urlLength] = _u('\0');
+
+            // The profile deserializer trusts its input, so anything that was not written as it is now is dropped
+            if (GetChecksum(GetRecordBuffer(record), recordSize) != checksum || wcslen(url) != urlLength || records.ContainsKey(url))
+            {
+                OUTPUT_TRACE(Js::DynamicProfilePhase, _u("TierUpCache: Corrupt record %d in '%s'; ignored\n"), i, filename);
+                PHASE_PRINT_TESTTRACE1(Js::DynamicProfilePhase, _u("TierUpCache: Corrupt record %d; ignored\n"), i);
+                NoCheckHeapDeleteArray(urlLength + 1, url);
+                DeleteRecord(record);
+                continue;
+            }
+
+            records.Add(url, record);
+        }
+        return true;
+    }
+
+    bool
+    TierUpCache::ExportFile(__in_z char16 const * filename)
+    {
+        // Write a file of our own and move it over the cache, so that processes that exit at the same time
+        // replace the cache with a whole file rather than interleave their writes
+        char16 tempFilename[_MAX_PATH];
+        if (swprintf_s(tempFilename, _countof(tempFilename), _u("%s.%u.tmp"), filename, GetCurrentProcessId()) < 0)
+        {
+            return false;
+        }
+
+        TierUpCacheFile file;
+        if (!file.Open(tempFilename, _u("wb")))
+        {
+            return false;
+        }
+
+        bool success = file.Write(MagicNumber) && file.Write(FileFormatVersion) && file.Write(byteCodeCacheReleaseFileVersion)
+            && file.Write((DWORD)sizeof(void *)) && file.Write((DWORD)records.Count());
+
+        records.Map([&](char16 const * url, char * record)
+        {
+            DWORD recordSize = GetRecordSize(record);
+            success = success
+                && file.Write((DWORD)wcslen(url)) && file.WriteArray(url, wcslen(url))
+                && file.Write(GetChecksum(GetRecordBuffer(record), recordSize)) && file.Write(recordSize)
+                && file.WriteArray(GetRecordBuffer(record), recordSize);
+        });
+
+        success = file.Close() && success;
+        if (!success || !MoveFileExW(tempFilename, filename, MOVEFILE_REPLACE_EXISTING))
+        {
+            _wunlink(tempFilename);
+            return false;
+        }
+        return true;
+    }
+};
+#endif
@@ -0,0 +1,67 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if ENABLE_TIER_UP_CACHE
+namespace Js
+{
+    //
+    // Keeps the dynamic profiles of functions that got to the full JIT in a file (-TierUpCache:<file>), so that
+    // the next run of the same scripts can jit those functions right away instead of going through the interpreter
+    // and the simple JIT to profile them again.
+    //
+    // The jitted code itself is not kept: it embeds the addresses of types, inline caches, property guards and
+    // library objects of the process that jitted it. The profile is what the full JIT needs to produce the same
+    // code, and the guards the code depends on (object types, fixed fields) are established again when it is jitted.
+    //
+    // There is one record per script url. A record is used for a function only if the function's source, byte
+    // code size and profile layout are what they were when it was saved; the file as a whole is only used if it
+    // was written by the same build (byte code version) and the same architecture.
+    //
+    class TierUpCache
+    {
+    public:
+        static bool IsEnabled() { return Configuration::Global.flags.TierUpCache != nullptr; }
+        static void Uninitialize();
+
+        static SourceDynamicProfileManager * Load(__in_z char16 const * url, Recycler * recycler);
+        static void Save(ScriptContext * scriptContext);
+
+        static uint32 GetSourceHash(FunctionBody * functionBody);
+        static size_t GetFunctionBitsSize(uint functionCount);
+
+    private:
+        static void EnsureImported();
+        static bool ImportFile(__in_z char16 const * filename);
+        static bool ExportFile(__in_z char16 const * filename);
+
+        static void SaveSource(ScriptContext * scriptContext, SourceContextInfo * sourceContextInfo);
+        static bool ShouldSave(FunctionBody * functionBody);
+        template <typename Fn>
+        static void MapFunctionsToSave(ScriptContext * scriptContext, SourceContextInfo * sourceContextInfo, Fn fn);
+        template <typename T>
+        static bool SerializeFunction(FunctionBody * functionBody, T * writer);
+
+        static void SaveRecord(__in_z char16 const * url, __in_ecount(sizeof(DWORD) + *record) char * record);
+        static void ClearRecords();
+        static char * AllocRecord(DWORD bufferSize);
+        static void DeleteRecord(__in_ecount(sizeof(DWORD) + *record) char * record);
+        static char * GetRecordBuffer(__in_ecount(sizeof(DWORD) + *record) char * record) { return record + sizeof(DWORD); }
+        static DWORD GetRecordSize(__in_ecount(sizeof(DWORD) + *record) char const * record) { return *(DWORD const *)record; }
+        static DWORD GetChecksum(__in_ecount(size) char const * buffer, DWORD size);
+
+        typedef JsUtil::BaseDictionary<char16 const *, char *, NoCheckHeapAllocator, PrimeSizePolicy, DefaultComparer, JsUtil::DictionaryEntry> RecordMap;
+        static RecordMap records;
+        static CriticalSection cs;
+        static bool imported;
+        static bool modified;
+
+        static DWORD const MagicNumber;
+        static DWORD const FileFormatVersion;
+        static DWORD const MaxUrlLength;
+        static DWORD const MaxRecordSize;
+    };
+};
+#endif
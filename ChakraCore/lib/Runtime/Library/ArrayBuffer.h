@@ -31,7 +31,7 @@ namespace Js
             Js::Throw::FatalInternalError();
         }
 #endif
-#ifdef _WIN32
+#if defined(_WIN32) || ENABLE_FAST_ARRAYBUFFER
         static void* __cdecl AllocWrapper(DECLSPEC_GUARD_OVERFLOW size_t length, size_t MaxVirtualSize)
         {
             LPVOID address = VirtualAlloc(nullptr, MaxVirtualSize, MEM_RESERVE, PAGE_NOACCESS);
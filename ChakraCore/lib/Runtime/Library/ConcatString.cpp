@@ -293,6 +293,52 @@ namespace Js
         return true;
     }
 
+    JavascriptString* ConcatStringBase::GetSubtreeContaining(JavascriptString* str, _Inout_ charcount_t* start, const charcount_t length)
+    {
+        Assert(str);
+        Assert(start);
+        Assert(length != 0);
+        AssertOrFailFast(*start + length <= str->GetLength());
+
+        // Iterative, so the depth of the tree doesn't matter. Nodes without random access items (CompoundString,
+        // ConcatStringBuilder) and flattened nodes end the walk.
+        while (!str->IsFinalized())
+        {
+            JavascriptString * const * items;
+            const int itemCount = str->GetRandomAccessItemsFromConcatString(items);
+
+            JavascriptString* child = nullptr;
+            charcount_t childStart = *start;
+            for (int i = 0; i < itemCount; ++i)
+            {
+                JavascriptString *const s = items[i];
+                if (!s)
+                {
+                    continue;
+                }
+
+                const charcount_t itemLength = s->GetLength();
+                if (childStart < itemLength)
+                {
+                    if (length <= itemLength - childStart)
+                    {
+                        child = s;
+                    }
+                    break;
+                }
+                childStart -= itemLength;
+            }
+
+            if (!child)
+            {
+                break;
+            }
+            str = child;
+            *start = childStart;
+        }
+        return str;
+    }
+
     /////////////////////// ConcatString //////////////////////////
 
     ConcatString::ConcatString(JavascriptString* a, JavascriptString* b) :
@@ -307,6 +353,10 @@ namespace Js
         m_slots[0] = a;
         m_slots[1] = b;
 
+        const uint16 childDepth = max(GetTreeDepth(a), GetTreeDepth(b));
+        Assert(childDepth < MaxDepth);
+        this->depth = static_cast<uint16>(childDepth + 1);
+
         this->SetLength(a->GetLength() + b->GetLength()); // does not include null character
     }
 
@@ -317,10 +367,127 @@ namespace Js
 #ifdef PROFILE_STRINGS
        StringProfiler::RecordConcatenation( left->GetScriptContext(), left->GetLength(), right->GetLength(), ConcatType_ConcatTree);
 #endif
+        if (GetTreeDepth(left) >= MaxDepth && RefreshDepth(static_cast<ConcatString*>(left)) >= MaxDepth)
+        {
+            left = Balance(static_cast<ConcatString*>(left));
+        }
+        if (GetTreeDepth(right) >= MaxDepth && RefreshDepth(static_cast<ConcatString*>(right)) >= MaxDepth)
+        {
+            right = Balance(static_cast<ConcatString*>(right));
+        }
+
         Recycler* recycler = left->GetScriptContext()->GetRecycler();
         return RecyclerNew(recycler, ConcatString, left, right);
     }
 
+    uint16 ConcatString::GetTreeDepth(JavascriptString* str)
+    {
+        if (!str->IsFinalized() && VirtualTableInfo<ConcatString>::HasVirtualTable(str))
+        {
+            return static_cast<ConcatString*>(str)->depth;
+        }
+
+        // Leaves, flattened nodes and other kinds of trees start a new chain
+        return 0;
+    }
+
+    // A node's depth is an upper bound: a node below it that has been flattened since counts as a leaf now, but the nodes
+    // above it still count it. Recomputes the depth of root and of the binary nodes below it from their children, post-order.
+    // A node's depth is always more than its children's, so the path from root is no longer than root's depth.
+    uint16 ConcatString::RefreshDepth(ConcatString* root)
+    {
+        ConcatString* path[MaxDepth];
+        byte nextSlot[MaxDepth];
+        int pathLength = 0;
+
+        AssertOrFailFast(root->depth <= MaxDepth);
+        path[pathLength] = root;
+        nextSlot[pathLength] = 0;
+        pathLength++;
+        while (pathLength != 0)
+        {
+            ConcatString *const node = path[pathLength - 1];
+            if (nextSlot[pathLength - 1] < 2)
+            {
+                JavascriptString *const child = node->m_slots[nextSlot[pathLength - 1]++];
+                if (GetTreeDepth(child) != 0)
+                {
+                    AssertOrFailFast(pathLength < MaxDepth);
+                    path[pathLength] = static_cast<ConcatString*>(child);
+                    nextSlot[pathLength] = 0;
+                    pathLength++;
+                }
+                continue;
+            }
+
+            node->depth = static_cast<uint16>(max(GetTreeDepth(node->m_slots[0]), GetTreeDepth(node->m_slots[1])) + 1);
+            pathLength--;
+        }
+        return root->depth;
+    }
+
+    // Calls fn for each item below the binary nodes of root, left to right. The explicit stack holds one pending right
+    // child per binary node on the current path, which is bounded by the depth of root.
+    template <typename Fn>
+    void ConcatString::ForEachLeaf(ConcatString* root, Fn fn)
+    {
+        JavascriptString* pendingRight[MaxDepth];
+        int pendingCount = 0;
+
+        JavascriptString* current = root;
+        for (;;)
+        {
+            if (GetTreeDepth(current) != 0)
+            {
+                ConcatString *const node = static_cast<ConcatString*>(current);
+                AssertOrFailFast(pendingCount < MaxDepth);
+                pendingRight[pendingCount++] = node->m_slots[1];
+                current = node->m_slots[0];
+                continue;
+            }
+
+            fn(current);
+            if (pendingCount == 0)
+            {
+                break;
+            }
+            current = pendingRight[--pendingCount];
+        }
+    }
+
+    // Rebuilds the binary nodes of str as one ConcatStringMulti holding all of their leaves in order.
+    // Only slot pointers are copied; the leaves themselves (including nested trees of other kinds) are shared.
+    JavascriptString* ConcatString::Balance(ConcatString* str)
+    {
+        Assert(GetTreeDepth(str) == MaxDepth);
+
+        uint itemCount = 0;
+        JavascriptString* firstItems[2] = { nullptr, nullptr };
+        ForEachLeaf(str, [&](JavascriptString* item)
+        {
+            if (itemCount < _countof(firstItems))
+            {
+                firstItems[itemCount] = item;
+            }
+            itemCount++;
+        });
+        Assert(itemCount > MaxDepth);
+
+        ConcatStringMulti *const result = ConcatStringMulti::New(itemCount, firstItems[0], firstItems[1], str->GetScriptContext());
+        uint index = 0;
+        ForEachLeaf(str, [&](JavascriptString* item)
+        {
+            if (index >= _countof(firstItems))
+            {
+                result->SetItem(index, item);
+            }
+            index++;
+        });
+
+        Assert(result->GetLength() == str->GetLength());
+        return result;
+    }
+
     /////////////////////// ConcatStringBuilder //////////////////////////
 
     // MAX number of slots in one chunk. Until we fit into this, we realloc, otherwise create new chunk.
@@ -87,6 +87,10 @@ namespace Js
         template <typename ConcatStringType> const char16 * GetSzImpl();
     public:
         virtual const char16* GetSz() = 0;     // Force subclass to call GetSzImpl with the real type to avoid virtual calls
+
+        // Walks down a concat tree to the deepest node that holds all of [*start, *start + length), adjusting *start to be
+        // relative to that node. Taking a substring of the result only flattens (and caches) that node instead of the whole tree.
+        static JavascriptString* GetSubtreeContaining(JavascriptString* str, _Inout_ charcount_t* start, charcount_t length);
         using JavascriptString::Copy;
         virtual bool IsTree() const override sealed;
     };
@@ -134,17 +138,31 @@ namespace Js
     //   ConcatString* str = ConcatString::New(javascriptString1, javascriptString2);
     // Note: it's preferred you would use the following for concats, that would figure out whether concat string is optimal or create a new string is better.
     //   JavascriptString::Concat(javascriptString1, javascriptString2);
+    // The depth of nested binary nodes is tracked per node. A child that reaches MaxDepth (e.g. from prepending in a loop)
+    // is rebuilt as a single ConcatStringMulti over its leaves before it is used, so the tree stays shallow without copying
+    // any characters. Rebuilding only walks the binary nodes added since the last rebuild, so it costs O(MaxDepth) for every
+    // MaxDepth concats whatever the limit is. A lower limit keeps the walks down a chain (substrings, charAt) and the
+    // MaxDepth-sized stacks of the rebuild short; at 128 those stacks take about 1KB.
     class ConcatString sealed : public ConcatStringN<2>
     {
         ConcatString(JavascriptString* a, JavascriptString* b);
+
+        static uint16 GetTreeDepth(JavascriptString* str);
+        static uint16 RefreshDepth(ConcatString* str);
+        static JavascriptString* Balance(ConcatString* str);
+        template <typename Fn> static void ForEachLeaf(ConcatString* root, Fn fn);
     protected:
         DEFINE_VTABLE_CTOR(ConcatString, ConcatStringN<2>);
     public:
         static ConcatString* New(JavascriptString* a, JavascriptString* b);
-        static const int MaxDepth = 1000;
+        static const int MaxDepth = 128;
 
         JavascriptString *LeftString() const { Assert(!IsFinalized()); return m_slots[0]; }
         JavascriptString *RightString() const { Assert(!IsFinalized()); return m_slots[1]; }
+
+    private:
+        Field(uint16) depth;    // Number of binary nodes on the longest path down from (and including) this one, when it was last
+                                // computed. Nodes below may have been flattened since; see RefreshDepth.
     };
 
     // Concat string with any number of child nodes, can grow dynamically.
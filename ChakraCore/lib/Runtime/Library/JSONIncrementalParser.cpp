@@ -0,0 +1,672 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+#include "JSONIncrementalParser.h"
+
+using namespace Js;
+
+namespace JSON
+{
+    namespace
+    {
+        const charcount_t MinBufferCapacity = 64;
+
+        // Integers with up to this many digits are exact in a double, so they don't need StrToDbl
+        const charcount_t MaxExactIntegerDigits = 15;
+
+        inline bool IsDigit(byte ch)
+        {
+            return ch >= '0' && ch <= '9';
+        }
+
+        inline bool IsPlainStringByte(byte ch)
+        {
+            return ch >= 0x20 && ch < 0x80 && ch != '"' && ch != '\\';
+        }
+    }
+
+    JSONIncrementalParser* JSONIncrementalParser::New(ScriptContext* scriptContext)
+    {
+        Recycler* recycler = scriptContext->GetRecycler();
+        return RecyclerNew(recycler, JSONIncrementalParser, scriptContext, recycler);
+    }
+
+    JSONIncrementalParser::JSONIncrementalParser(ScriptContext* scriptContext, Recycler* recycler) :
+        scriptContext(scriptContext),
+        frames(RecyclerNew(recycler, FrameList, recycler)),
+        result(nullptr),
+        buffer(nullptr),
+        bufferLength(0),
+        bufferCapacity(0),
+        chunkPosition(0),
+        chunkStart(nullptr),
+        expect(Expect::Value),
+        scanState(ScanState::BetweenTokens),
+        isKey(false),
+        hasFailed(false),
+        hexDigitCount(0),
+        hexValue(0),
+        utf8Length(0),
+        utf8Count(0),
+        utf8CodePoint(0),
+        numberState(NumberState::Sign),
+        isNegative(false),
+        literal(nullptr),
+        literalMatched(0)
+    {
+    }
+
+    void JSONIncrementalParser::Feed(_In_reads_(length) const byte* chunk, size_t length)
+    {
+        Assert(!this->hasFailed);
+
+        const byte* current = chunk;
+        const byte* end = chunk + length;
+        this->chunkStart = chunk;
+        this->hasFailed = true;
+
+        while (current < end)
+        {
+            switch (this->scanState)
+            {
+            case ScanState::BetweenTokens:
+                current = ScanBetweenTokens(current, end);
+                break;
+            case ScanState::String:
+                current = ScanString(current, end);
+                break;
+            case ScanState::StringEscape:
+                current = ScanEscape(current, end);
+                break;
+            case ScanState::StringUnicodeEscape:
+                current = ScanUnicodeEscape(current, end);
+                break;
+            case ScanState::StringUtf8Sequence:
+                current = ScanUtf8Sequence(current, end);
+                break;
+            case ScanState::Number:
+                current = ScanNumber(current, end);
+                break;
+            case ScanState::Literal:
+                current = ScanLiteral(current, end);
+                break;
+            default:
+                Assume(UNREACHED);
+            }
+        }
+
+        this->chunkPosition += length;
+        this->chunkStart = nullptr;
+        this->hasFailed = false;
+    }
+
+    Js::Var JSONIncrementalParser::Finish()
+    {
+        Assert(!this->hasFailed);
+        this->hasFailed = true;
+
+        switch (this->scanState)
+        {
+        case ScanState::BetweenTokens:
+            break;
+        case ScanState::Number:
+            // A number ends with the input
+            this->scanState = ScanState::BetweenTokens;
+            CompleteNumber(nullptr);
+            break;
+        case ScanState::Literal:
+            ThrowSyntaxError(JSERR_JsonIllegalChar, nullptr);
+        default:
+            ThrowSyntaxError(JSERR_JsonNoStrEnd, nullptr);
+        }
+
+        if (this->expect != Expect::End)
+        {
+            if (this->frames->Count() == 0)
+            {
+                ThrowSyntaxError(JSERR_JsonSyntax, nullptr);
+            }
+            ThrowSyntaxError(this->frames->Last().isArray ? JSERR_JsonNoRbrack : JSERR_JsonNoRcurly, nullptr);
+        }
+
+        this->hasFailed = false;
+        return this->result;
+    }
+
+    const byte* JSONIncrementalParser::ScanBetweenTokens(const byte* current, const byte* end)
+    {
+        const bool isValueExpected = this->expect == Expect::Value || this->expect == Expect::ValueOrArrayEnd;
+
+        for (; current < end; ++current)
+        {
+            const byte ch = *current;
+            switch (ch)
+            {
+            case ' ':
+            case '\t':
+            case '\n':
+            case '\r':
+                continue;
+
+            case '{':
+            case '[':
+                if (!isValueExpected)
+                {
+                    break;
+                }
+                BeginContainer(ch == '[');
+                return current + 1;
+
+            case '}':
+            case ']':
+                EndContainer(ch == ']', current);
+                return current + 1;
+
+            case ',':
+                if (this->expect != Expect::CommaOrEnd)
+                {
+                    break;
+                }
+                this->expect = this->frames->Last().isArray ? Expect::Value : Expect::Key;
+                return current + 1;
+
+            case ':':
+                if (this->expect != Expect::Colon)
+                {
+                    break;
+                }
+                this->expect = Expect::Value;
+                return current + 1;
+
+            case '"':
+                if (isValueExpected)
+                {
+                    this->isKey = false;
+                }
+                else if (this->expect == Expect::Key || this->expect == Expect::KeyOrObjectEnd)
+                {
+                    this->isKey = true;
+                }
+                else
+                {
+                    break;
+                }
+                this->bufferLength = 0;
+                this->scanState = ScanState::String;
+                return current + 1;
+
+            case 't':
+            case 'f':
+            case 'n':
+                if (!isValueExpected)
+                {
+                    break;
+                }
+                this->literal = ch == 't' ? "true" : ch == 'f' ? "false" : "null";
+                this->literalMatched = 1;
+                this->scanState = ScanState::Literal;
+                return current + 1;
+
+            default:
+                if (!isValueExpected || (ch != '-' && !IsDigit(ch)))
+                {
+                    break;
+                }
+                this->bufferLength = 0;
+                this->isNegative = ch == '-';
+                if (this->isNegative)
+                {
+                    this->numberState = NumberState::Sign;
+                }
+                else
+                {
+                    this->numberState = ch == '0' ? NumberState::Zero : NumberState::Integer;
+                    AppendChar(ch);
+                }
+                this->scanState = ScanState::Number;
+                return current + 1;
+            }
+
+            // Not allowed here
+            switch (this->expect)
+            {
+            case Expect::Colon:
+                ThrowSyntaxError(JSERR_JsonNoColon, current);
+            case Expect::CommaOrEnd:
+                ThrowSyntaxError(this->frames->Last().isArray ? JSERR_JsonNoRbrack : JSERR_JsonNoRcurly, current);
+            case Expect::Key:
+            case Expect::KeyOrObjectEnd:
+                ThrowSyntaxError(JSERR_JsonIllegalChar, current);
+            default:
+                ThrowSyntaxError(JSERR_JsonSyntax, current);
+            }
+        }
+
+        return current;
+    }
+
+    const byte* JSONIncrementalParser::ScanString(const byte* current, const byte* end)
+    {
+        const byte* runStart = current;
+        while (current < end && IsPlainStringByte(*current))
+        {
+            ++current;
+        }
+        AppendAscii(runStart, static_cast<charcount_t>(current - runStart));
+
+        if (current == end)
+        {
+            return current;
+        }
+
+        const byte ch = *current;
+        if (ch == '"')
+        {
+            this->scanState = ScanState::BetweenTokens;
+            CompleteString();
+        }
+        else if (ch == '\\')
+        {
+            this->scanState = ScanState::StringEscape;
+        }
+        else if (ch < 0x20)
+        {
+            //JSON doesn't accept \u0000 - \u001f range
+            ThrowSyntaxError(JSERR_JsonIllegalChar, current);
+        }
+        else if (ch >= 0xC2 && ch <= 0xF4)
+        {
+            this->utf8Length = ch >= 0xF0 ? 4 : ch >= 0xE0 ? 3 : 2;
+            this->utf8Count = 1;
+            this->utf8CodePoint = ch & (0x7F >> this->utf8Length);
+            this->scanState = ScanState::StringUtf8Sequence;
+        }
+        else
+        {
+            // Stray continuation byte, or a lead byte that can't start a valid sequence
+            AppendChar(0xFFFD);
+        }
+        return current + 1;
+    }
+
+    const byte* JSONIncrementalParser::ScanEscape(const byte* current, const byte* end)
+    {
+        Assert(current < end);
+
+        switch (*current)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            AppendChar(*current);
+            break;
+        case 'b':
+            AppendChar(_u('\b'));
+            break;
+        case 'f':
+            AppendChar(_u('\f'));
+            break;
+        case 'n':
+            AppendChar(_u('\n'));
+            break;
+        case 'r':
+            AppendChar(_u('\r'));
+            break;
+        case 't':
+            AppendChar(_u('\t'));
+            break;
+        case 'u':
+            this->hexDigitCount = 0;
+            this->hexValue = 0;
+            this->scanState = ScanState::StringUnicodeEscape;
+            return current + 1;
+        default:
+            // Any other '\o' is an error in JSON
+            ThrowSyntaxError(JSERR_JsonIllegalChar, current);
+        }
+
+        this->scanState = ScanState::String;
+        return current + 1;
+    }
+
+    const byte* JSONIncrementalParser::ScanUnicodeEscape(const byte* current, const byte* end)
+    {
+        for (; current < end && this->hexDigitCount < 4; ++current)
+        {
+            int digit;
+            if (!Js::NumberUtilities::FHexDigit(*current, &digit))
+            {
+                ThrowSyntaxError(JSERR_JsonBadHexDigit, current);
+            }
+            this->hexValue = static_cast<char16>((this->hexValue << 4) | digit);
+            ++this->hexDigitCount;
+        }
+
+        if (this->hexDigitCount == 4)
+        {
+            AppendChar(this->hexValue);
+            this->scanState = ScanState::String;
+        }
+        return current;
+    }
+
+    const byte* JSONIncrementalParser::ScanUtf8Sequence(const byte* current, const byte* end)
+    {
+        for (; current < end && this->utf8Count < this->utf8Length; ++current)
+        {
+            if ((*current & 0xC0) != 0x80)
+            {
+                // Truncated sequence. The byte is read again as part of the string.
+                AppendChar(0xFFFD);
+                this->scanState = ScanState::String;
+                return current;
+            }
+            this->utf8CodePoint = (this->utf8CodePoint << 6) | (*current & 0x3F);
+            ++this->utf8Count;
+        }
+
+        if (this->utf8Count == this->utf8Length)
+        {
+            static const uint32 minimumCodePoint[] = { 0, 0, 0x80, 0x800, 0x10000 };
+            const uint32 codePoint = this->utf8CodePoint;
+            if (codePoint < minimumCodePoint[this->utf8Length] || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+            {
+                // Overlong forms, encoded surrogates and values past the last code point
+                AppendChar(0xFFFD);
+            }
+            else if (codePoint >= 0x10000)
+            {
+                AppendChar(static_cast<char16>(0xD800 + ((codePoint - 0x10000) >> 10)));
+                AppendChar(static_cast<char16>(0xDC00 + (codePoint & 0x3FF)));
+            }
+            else
+            {
+                AppendChar(static_cast<char16>(codePoint));
+            }
+            this->scanState = ScanState::String;
+        }
+        return current;
+    }
+
+    const byte* JSONIncrementalParser::ScanNumber(const byte* current, const byte* end)
+    {
+        for (; current < end; ++current)
+        {
+            const byte ch = *current;
+            NumberState next;
+            switch (this->numberState)
+            {
+            case NumberState::Sign:
+                if (!IsDigit(ch))
+                {
+                    ThrowSyntaxError(JSERR_JsonBadNumber, current);
+                }
+                next = ch == '0' ? NumberState::Zero : NumberState::Integer;
+                break;
+            case NumberState::Zero:
+            case NumberState::Integer:
+                if (IsDigit(ch))
+                {
+                    if (this->numberState == NumberState::Zero)
+                    {
+                        // No leading zeros
+                        ThrowSyntaxError(JSERR_JsonBadNumber, current);
+                    }
+                    next = NumberState::Integer;
+                }
+                else if (ch == '.')
+                {
+                    next = NumberState::Point;
+                }
+                else if (ch == 'e' || ch == 'E')
+                {
+                    next = NumberState::Exponent;
+                }
+                else
+                {
+                    goto LDone;
+                }
+                break;
+            case NumberState::Point:
+                if (!IsDigit(ch))
+                {
+                    ThrowSyntaxError(JSERR_JsonBadNumber, current);
+                }
+                next = NumberState::Fraction;
+                break;
+            case NumberState::Fraction:
+                if (IsDigit(ch))
+                {
+                    next = NumberState::Fraction;
+                }
+                else if (ch == 'e' || ch == 'E')
+                {
+                    next = NumberState::Exponent;
+                }
+                else
+                {
+                    goto LDone;
+                }
+                break;
+            case NumberState::Exponent:
+                if (ch == '+' || ch == '-')
+                {
+                    next = NumberState::ExponentSign;
+                    break;
+                }
+                // fall through
+            case NumberState::ExponentSign:
+                if (!IsDigit(ch))
+                {
+                    ThrowSyntaxError(JSERR_JsonBadNumber, current);
+                }
+                next = NumberState::ExponentDigits;
+                break;
+            case NumberState::ExponentDigits:
+                if (!IsDigit(ch))
+                {
+                    goto LDone;
+                }
+                next = NumberState::ExponentDigits;
+                break;
+            default:
+                Assume(UNREACHED);
+                next = NumberState::Sign;
+            }
+
+            this->numberState = next;
+            AppendChar(ch);
+        }
+        return current;
+
+    LDone:
+        // The character after the number is read as the next token
+        this->scanState = ScanState::BetweenTokens;
+        CompleteNumber(current);
+        return current;
+    }
+
+    const byte* JSONIncrementalParser::ScanLiteral(const byte* current, const byte* end)
+    {
+        for (; current < end && this->literal[this->literalMatched] != '\0'; ++current)
+        {
+            if (*current != static_cast<byte>(this->literal[this->literalMatched]))
+            {
+                ThrowSyntaxError(JSERR_JsonIllegalChar, current);
+            }
+            ++this->literalMatched;
+        }
+
+        if (this->literal[this->literalMatched] == '\0')
+        {
+            JavascriptLibrary* library = this->scriptContext->GetLibrary();
+            this->scanState = ScanState::BetweenTokens;
+            CompleteValue(this->literal[0] == 't' ? library->GetTrue() : this->literal[0] == 'f' ? library->GetFalse() : library->GetNull());
+        }
+        return current;
+    }
+
+    void JSONIncrementalParser::BeginContainer(bool isArray)
+    {
+        JavascriptLibrary* library = this->scriptContext->GetLibrary();
+
+        Frame frame;
+        frame.container = isArray ? static_cast<Js::Var>(library->CreateArray(0)) : static_cast<Js::Var>(library->CreateObject());
+        frame.pendingKey = nullptr;
+        frame.count = 0;
+        frame.isArray = isArray;
+        this->frames->Add(frame);
+
+        this->expect = isArray ? Expect::ValueOrArrayEnd : Expect::KeyOrObjectEnd;
+    }
+
+    void JSONIncrementalParser::EndContainer(bool isArray, const byte* at)
+    {
+        const bool canEnd = this->frames->Count() != 0 && this->frames->Last().isArray == isArray &&
+            (this->expect == Expect::CommaOrEnd || this->expect == (isArray ? Expect::ValueOrArrayEnd : Expect::KeyOrObjectEnd));
+        if (!canEnd)
+        {
+            switch (this->expect)
+            {
+            case Expect::Colon:
+                ThrowSyntaxError(JSERR_JsonNoColon, at);
+            case Expect::CommaOrEnd:
+                ThrowSyntaxError(this->frames->Last().isArray ? JSERR_JsonNoRbrack : JSERR_JsonNoRcurly, at);
+            case Expect::Key:
+            case Expect::KeyOrObjectEnd:
+                ThrowSyntaxError(JSERR_JsonIllegalChar, at);
+            case Expect::Value:
+                // Trailing comma in an array
+                ThrowSyntaxError(isArray && this->frames->Count() != 0 && this->frames->Last().isArray ? JSERR_JsonIllegalChar : JSERR_JsonSyntax, at);
+            default:
+                ThrowSyntaxError(JSERR_JsonSyntax, at);
+            }
+        }
+
+        Frame frame = this->frames->RemoveAtEnd();
+        CompleteValue(frame.container);
+    }
+
+    void JSONIncrementalParser::CompleteValue(Js::Var value)
+    {
+        if (this->frames->Count() == 0)
+        {
+            this->result = value;
+            this->expect = Expect::End;
+            return;
+        }
+
+        Frame& frame = this->frames->Last();
+        if (frame.isArray)
+        {
+            UnsafeVarTo<JavascriptArray>(frame.container)->SetItem(frame.count++, value, PropertyOperation_None);
+        }
+        else
+        {
+            PropertyValueInfo info;
+            UnsafeVarTo<DynamicObject>(frame.container)->SetProperty(frame.pendingKey->GetPropertyId(), value, PropertyOperation_None, &info);
+            frame.pendingKey = nullptr;
+        }
+        this->expect = Expect::CommaOrEnd;
+    }
+
+    void JSONIncrementalParser::CompleteString()
+    {
+        if (this->isKey)
+        {
+            const PropertyRecord* propertyRecord;
+            this->scriptContext->GetOrAddPropertyRecord(this->buffer, this->bufferLength, &propertyRecord);
+            this->frames->Last().pendingKey = propertyRecord;
+            this->expect = Expect::Colon;
+            return;
+        }
+
+        // JSON payloads are overwhelmingly ASCII, store those values one byte per character
+        JavascriptString* value = OneByteString::NewCopyBufferPreferOneByte(this->buffer, this->bufferLength, this->scriptContext);
+        StringDeduplicator::RegisterCandidate(value);
+        CompleteValue(value);
+    }
+
+    void JSONIncrementalParser::CompleteNumber(const byte* at)
+    {
+        if (this->numberState != NumberState::Zero && this->numberState != NumberState::Integer &&
+            this->numberState != NumberState::Fraction && this->numberState != NumberState::ExponentDigits)
+        {
+            ThrowSyntaxError(JSERR_JsonBadNumber, at);
+        }
+
+        double value = 0;
+        if (this->numberState != NumberState::Fraction && this->numberState != NumberState::ExponentDigits &&
+            this->bufferLength <= MaxExactIntegerDigits)
+        {
+            for (charcount_t i = 0; i < this->bufferLength; ++i)
+            {
+                value = value * 10 + (this->buffer[i] - _u('0'));
+            }
+        }
+        else
+        {
+            EnsureBufferCapacity(1);
+            this->buffer[this->bufferLength] = _u('\0');
+            const char16* numberEnd = nullptr;
+            value = NumberUtilities::StrToDbl(static_cast<const char16*>(this->buffer), &numberEnd, this->scriptContext);
+            Assert(numberEnd == this->buffer + this->bufferLength);
+        }
+
+        CompleteValue(JavascriptNumber::ToVarIntCheck(this->isNegative ? -value : value, this->scriptContext));
+    }
+
+    void JSONIncrementalParser::AppendChar(char16 ch)
+    {
+        EnsureBufferCapacity(1);
+        this->buffer[this->bufferLength++] = ch;
+    }
+
+    void JSONIncrementalParser::AppendAscii(_In_reads_(length) const byte* chars, charcount_t length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+        EnsureBufferCapacity(length);
+        OneByteString::Widen(this->buffer + this->bufferLength, reinterpret_cast<const char*>(chars), length);
+        this->bufferLength += length;
+    }
+
+    void JSONIncrementalParser::EnsureBufferCapacity(charcount_t additional)
+    {
+        if (additional <= this->bufferCapacity - this->bufferLength)
+        {
+            return;
+        }
+
+        const charcount_t required = UInt32Math::Add(this->bufferLength, additional);
+        if (!IsValidCharCount(required))
+        {
+            JavascriptError::ThrowOutOfMemoryError(this->scriptContext);
+        }
+
+        charcount_t capacity = max(required, MinBufferCapacity);
+        if (this->bufferCapacity > capacity / 2 && IsValidCharCount(static_cast<size_t>(this->bufferCapacity) * 2))
+        {
+            capacity = this->bufferCapacity * 2;
+        }
+        char16* newBuffer = RecyclerNewArrayLeaf(this->scriptContext->GetRecycler(), char16, capacity);
+        if (this->bufferLength != 0)
+        {
+            js_wmemcpy_s(newBuffer, capacity, this->buffer, this->bufferLength);
+        }
+        this->buffer = newBuffer;
+        this->bufferCapacity = capacity;
+    }
+
+    void JSONIncrementalParser::ThrowSyntaxError(int wErr, const byte* at)
+    {
+        const uint64 position = this->chunkPosition + (at != nullptr ? at - this->chunkStart : 0);
+        char16 scanPos[24];
+        ::_ui64tow_s(position, scanPos, _countof(scanPos), 10);
+        JavascriptError::ThrowSyntaxError(this->scriptContext, wErr, scanPos);
+    }
+} // namespace JSON
@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace JSON
+{
+    // JSON.parse over UTF-8 input that arrives in pieces (JsJsonParseBegin/Feed/Finish).
+    //
+    // The parser is a state machine that can stop at any byte: the open arrays and objects are kept on an explicit
+    // stack, and a string, number or literal that is cut by the end of a chunk is continued by the next one. Values
+    // are added to their container as soon as they are complete, so the object graph is built while the input is
+    // still arriving and the text itself is never kept, only the token being read.
+    //
+    // The result is the same as JSON.parse without a reviver on the decoded text. Invalid UTF-8 in strings decodes
+    // to U+FFFD, as in JsCreateString. Errors are thrown as the usual JSON.parse SyntaxErrors, with the position in
+    // bytes.
+    //
+    // The parser is allocated in the recycler; everything it holds is reachable from it, so keeping the parser
+    // alive between chunks (see JsJsonParseBegin) keeps the partial result alive.
+    class JSONIncrementalParser
+    {
+    public:
+        static JSONIncrementalParser* New(Js::ScriptContext* scriptContext);
+
+        void Feed(_In_reads_(length) const byte* chunk, size_t length);
+        Js::Var Finish();
+
+        Js::ScriptContext* GetScriptContext() const { return scriptContext; }
+
+        // Once Feed or Finish has thrown, the state is inconsistent and the parser can't be used any more
+        bool HasFailed() const { return hasFailed; }
+
+    private:
+        JSONIncrementalParser(Js::ScriptContext* scriptContext, Recycler* recycler);
+
+        // What the grammar allows next, outside of a token
+        enum class Expect : uint8
+        {
+            Value,
+            ValueOrArrayEnd,
+            KeyOrObjectEnd,
+            Key,
+            Colon,
+            CommaOrEnd,
+            End
+        };
+
+        // The token being read, possibly across chunks
+        enum class ScanState : uint8
+        {
+            BetweenTokens,
+            String,
+            StringEscape,
+            StringUnicodeEscape,
+            StringUtf8Sequence,
+            Number,
+            Literal
+        };
+
+        // Position in the JSON number grammar, after the characters read so far
+        enum class NumberState : uint8
+        {
+            Sign,
+            Zero,
+            Integer,
+            Point,
+            Fraction,
+            Exponent,
+            ExponentSign,
+            ExponentDigits
+        };
+
+        struct Frame
+        {
+            Field(Js::Var) container;
+            Field(const Js::PropertyRecord*) pendingKey;    // the key whose value is being read, for objects
+            Field(uint32) count;                            // elements so far, for arrays
+            Field(bool) isArray;
+        };
+
+        typedef JsUtil::List<Frame, Recycler> FrameList;
+
+        const byte* ScanBetweenTokens(const byte* current, const byte* end);
+        const byte* ScanString(const byte* current, const byte* end);
+        const byte* ScanEscape(const byte* current, const byte* end);
+        const byte* ScanUnicodeEscape(const byte* current, const byte* end);
+        const byte* ScanUtf8Sequence(const byte* current, const byte* end);
+        const byte* ScanNumber(const byte* current, const byte* end);
+        const byte* ScanLiteral(const byte* current, const byte* end);
+
+        void BeginContainer(bool isArray);
+        void EndContainer(bool isArray, const byte* at);
+        void CompleteValue(Js::Var value);
+        void CompleteString();
+        void CompleteNumber(const byte* at);
+
+        void AppendChar(char16 ch);
+        void AppendAscii(_In_reads_(length) const byte* chars, charcount_t length);
+        void EnsureBufferCapacity(charcount_t additional);
+
+        void __declspec(noreturn) ThrowSyntaxError(int wErr, const byte* at);
+
+        FieldNoBarrier(Js::ScriptContext*) scriptContext;
+        Field(FrameList*) frames;
+        Field(Js::Var) result;
+
+        // The string or number being read
+        Field(char16*) buffer;
+        Field(charcount_t) bufferLength;
+        Field(charcount_t) bufferCapacity;
+
+        // Input consumed before the current chunk, and the start of the current chunk, for error positions
+        Field(uint64) chunkPosition;
+        FieldNoBarrier(const byte*) chunkStart;
+
+        Field(Expect) expect;
+        Field(ScanState) scanState;
+        Field(bool) isKey;                  // the string being read is an object key
+        Field(bool) hasFailed;
+
+        // \uXXXX escape
+        Field(uint8) hexDigitCount;
+        Field(char16) hexValue;
+
+        // Multi-byte UTF-8 sequence
+        Field(uint8) utf8Length;
+        Field(uint8) utf8Count;
+        Field(uint32) utf8CodePoint;
+
+        // Number
+        Field(NumberState) numberState;
+        Field(bool) isNegative;
+
+        // true, false or null
+        FieldNoBarrier(const char*) literal;
+        Field(uint8) literalMatched;
+    };
+} // namespace JSON
@@ -32,6 +32,23 @@ namespace JSON
             }
         }
         m_scanner.Init(str, length, &m_token, scriptContext, str, this->arenaAllocator);
+
+#if JSON_STRUCTURAL_INDEX_AVAILABLE
+        // Large inputs without a reviver go through the structural index first. It gives up on anything that
+        // isn't plainly valid, and the token parser then runs from the start and reports the error.
+        if (IsCaching() && !reviver && !PHASE_OFF1(Js::JSONStructuralIndexPhase))
+        {
+            Js::Var indexed = ParseIndexed(str, length);
+            if (indexed != nullptr)
+            {
+                return indexed;
+            }
+
+            OUTPUT_TRACE(Js::JSONStructuralIndexPhase, _u("JSONParser: falling back to the token parser\n"));
+            m_scanner.Init(str, length, &m_token, scriptContext, str, this->arenaAllocator);
+        }
+#endif
+
         Scan();
         Js::Var ret = ParseObject();
         if (m_token.tk != tkEOF)
@@ -207,9 +224,7 @@ namespace JSON
 
         case tkStrCon:
             {
-                // will auto-null-terminate the string (as length=len+1)
-                uint len = m_scanner.GetCurrentStringLen();
-                retVal = Js::JavascriptString::NewCopyBuffer(m_scanner.GetCurrentString(), len, scriptContext);
+                retVal = NewStringValue(m_scanner.GetCurrentString(), m_scanner.GetCurrentStringLen());
                 Scan();
                 return retVal;
             }
@@ -379,30 +394,7 @@ namespace JSON
                     PropertyValueInfo info;
                     object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, &info);
 
-                    DynamicType* typeWithProperty = object->GetDynamicType();
-                    if(IsCaching() && !propertyRecord->IsNumeric() && !info.IsNoCache() && typeWithProperty->GetIsShared() && typeWithProperty->GetTypeHandler()->IsPathTypeHandler())
-                    {
-                        PropertyIndex propertyIndex = info.GetPropertyIndex();
-
-                        if(!previousCache)
-                        {
-                            // This is the first property in the set add it to the dictionary.
-                            currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
-                            typeCacheList->AddNew(propertyRecord, currentCache);
-                        }
-                        else if(!currentCache)
-                        {
-                            currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
-                            previousCache->next = currentCache;
-                        }
-                        else
-                        {
-                            // cache miss!!
-                            currentCache->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
-                        }
-                        previousCache = currentCache;
-                        currentCache = currentCache->next;
-                    }
+                    CacheMemberType(propertyRecord, info, typeWithoutProperty, object->GetDynamicType(), &previousCache, &currentCache);
 
                     // if the next token is not a comma consider the list of members done.
                     if (tkComma != m_token.tk)
@@ -419,4 +411,530 @@ namespace JSON
             m_scanner.ThrowSyntaxError(JSERR_JsonSyntax);
         }
     }
+
+    Js::JavascriptString* JSONParser::NewStringValue(const char16* str, uint length)
+    {
+        // will auto-null-terminate the string (as length=len+1)
+        // JSON payloads are overwhelmingly ASCII, store those values one byte per character
+        Js::JavascriptString* value = Js::OneByteString::NewCopyBufferPreferOneByte(str, length, scriptContext);
+        Js::StringDeduplicator::RegisterCandidate(value);
+        return value;
+    }
+
+    void JSONParser::CacheMemberType(const Js::PropertyRecord* propertyRecord, const Js::PropertyValueInfo& info,
+        Js::DynamicType* typeWithoutProperty, Js::DynamicType* typeWithProperty,
+        JsonTypeCache** previousCache, JsonTypeCache** currentCache)
+    {
+        if(IsCaching() && !propertyRecord->IsNumeric() && !info.IsNoCache() && typeWithProperty->GetIsShared() && typeWithProperty->GetTypeHandler()->IsPathTypeHandler())
+        {
+            PropertyIndex propertyIndex = info.GetPropertyIndex();
+
+            if(!*previousCache)
+            {
+                // This is the first property in the set add it to the dictionary.
+                *currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+                typeCacheList->AddNew(propertyRecord, *currentCache);
+            }
+            else if(!*currentCache)
+            {
+                *currentCache = JsonTypeCache::New(this->arenaAllocator, propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+                (*previousCache)->next = *currentCache;
+            }
+            else
+            {
+                // cache miss!!
+                (*currentCache)->Update(propertyRecord, typeWithoutProperty, typeWithProperty, propertyIndex);
+            }
+            *previousCache = *currentCache;
+            *currentCache = (*currentCache)->next;
+        }
+    }
+
+    // -------- Indexed parser ------------//
+    //
+    // Stage two of the structural index parse: the values are built straight from the index entries, so
+    // whitespace and string contents are never looked at again, and unescaped strings and property names
+    // are used in place. Escaped strings and numbers still go through the scanner. Objects use the same
+    // JsonTypeCache as ParseObject.
+    //
+    // Nothing here throws for bad input. A grammar error, a stage one failure or a scalar that doesn't end
+    // at a separator returns false, and Parse re-parses with the token parser, which throws the usual error.
+    // The scanner calls can throw, but only at a position the token parser would reach with the same
+    // valid prefix, so the error is the same.
+
+    Js::Var JSONParser::ParseIndexed(LPCWSTR str, uint length)
+    {
+        if (!m_structuralIndex.Init(str, length, this->arenaAllocator))
+        {
+            return nullptr;
+        }
+
+        Js::Var value;
+        uint32 entry;
+        if (!ParseIndexedValue(&value) || m_structuralIndex.Peek(&entry) || m_structuralIndex.HasFailed())
+        {
+            return nullptr;
+        }
+        return value;
+    }
+
+    bool JSONParser::ParseIndexedValue(Js::Var* value)
+    {
+        PROBE_STACK(scriptContext, Js::Constants::MinStackDefault);
+
+        uint32 entry;
+        if (!m_structuralIndex.Next(&entry))
+        {
+            return false;
+        }
+
+        switch (m_scanner.inputText[entry])
+        {
+        case '"':
+            {
+                const char16* str;
+                uint length;
+                if (!ScanIndexedString(entry, &str, &length))
+                {
+                    return false;
+                }
+                *value = NewStringValue(str, length);
+                return true;
+            }
+
+        case '{':
+            return ParseIndexedObject(value);
+
+        case '[':
+            return ParseIndexedArray(value);
+
+        case '}':
+        case ']':
+        case ',':
+        case ':':
+            return false;
+
+        default:
+            return ParseIndexedScalar(entry, value);
+        }
+    }
+
+    bool JSONParser::ScanIndexedString(uint32 openingQuote, const char16** str, uint* length)
+    {
+        // The entry after an opening quote is always its closing quote
+        uint32 closingQuote;
+        if (!m_structuralIndex.Next(&closingQuote))
+        {
+            return false;
+        }
+
+        const uint32 start = openingQuote + 1;
+        if ((closingQuote & JSONStructuralIndex::StringHasEscapeFlag) == 0)
+        {
+            Assert(m_scanner.inputText[closingQuote] == '"');
+            *str = m_scanner.inputText + start;
+            *length = closingQuote - start;
+            return true;
+        }
+
+        // Unescape in the scanner's buffer, which the next escaped string overwrites
+        m_scanner.currentChar = m_scanner.inputText + start;
+        m_scanner.ScanString();
+        Assert(m_scanner.GetScanPosition() == (closingQuote & JSONStructuralIndex::PositionMask) + 1);
+        *str = m_scanner.GetCurrentString();
+        *length = m_scanner.GetCurrentStringLen();
+        return true;
+    }
+
+    bool JSONParser::ParseIndexedScalar(uint32 entry, Js::Var* value)
+    {
+        m_scanner.currentChar = m_scanner.inputText + entry;
+        switch (Scan())
+        {
+        case tkFltCon:
+            *value = Js::JavascriptNumber::ToVarIntCheck(m_token.GetDouble(), scriptContext);
+            break;
+
+        case tkSub:
+            if (Scan() != tkFltCon)
+            {
+                return false;
+            }
+            *value = Js::JavascriptNumber::ToVarIntCheck(-m_token.GetDouble(), scriptContext);
+            break;
+
+        case tkTRUE:
+            *value = scriptContext->GetLibrary()->GetTrue();
+            break;
+
+        case tkFALSE:
+            *value = scriptContext->GetLibrary()->GetFalse();
+            break;
+
+        case tkNULL:
+            *value = scriptContext->GetLibrary()->GetNull();
+            break;
+
+        default:
+            return false;
+        }
+
+        // Only the first character of a scalar is indexed. It has to end at a separator ("1x" doesn't) and
+        // must not have run into the next entry ("- 1" does, the token parser allows whitespace after '-').
+        const uint end = m_scanner.GetScanPosition();
+        if (end < m_scanner.inputLen)
+        {
+            switch (m_scanner.inputText[end])
+            {
+            case ' ': case '\t': case '\r': case '\n':
+            case ',': case ':': case '[': case ']': case '{': case '}':
+                break;
+            default:
+                return false;
+            }
+        }
+
+        uint32 next;
+        return !m_structuralIndex.Peek(&next) || next >= end;
+    }
+
+    bool JSONParser::ParseIndexedArray(Js::Var* value)
+    {
+        Js::JavascriptArray* arrayObj = scriptContext->GetLibrary()->CreateArray(0);
+
+        uint32 entry;
+        if (!m_structuralIndex.Peek(&entry))
+        {
+            return false;
+        }
+        if (m_scanner.inputText[entry] == ']')
+        {
+            m_structuralIndex.Next(&entry);
+            *value = arrayObj;
+            return true;
+        }
+
+        // Arrays of records: once two object elements in a row end up with the same type, the following ones
+        // are predicted to have it too (see ParseIndexedRecord)
+        JsonRecordShape shape;
+        Js::DynamicType* previousRecordType = nullptr;
+        uint mispredictions = PHASE_OFF1(Js::JSONRecordShapePhase) ? MaxRecordMispredictions : 0;
+
+        uint k = 0;
+        while (true)
+        {
+            Js::Var element;
+            if (shape.type != nullptr && m_structuralIndex.Peek(&entry) && m_scanner.inputText[entry] == '{')
+            {
+                m_structuralIndex.Next(&entry);
+                bool mispredicted = false;
+                if (!ParseIndexedRecord(shape, &element, &mispredicted))
+                {
+                    return false;
+                }
+                if (mispredicted)
+                {
+                    shape.type = nullptr;
+                    previousRecordType = nullptr;
+                    mispredictions++;
+                }
+            }
+            else
+            {
+                if (!ParseIndexedValue(&element))
+                {
+                    return false;
+                }
+                if (mispredictions < MaxRecordMispredictions)
+                {
+                    LearnRecordShape(element, &previousRecordType, &shape);
+                }
+            }
+            arrayObj->SetItem(k++, element, Js::PropertyOperation_None);
+
+            // ',' continues the element list, ']' ends it
+            if (!m_structuralIndex.Next(&entry))
+            {
+                return false;
+            }
+            if (m_scanner.inputText[entry] == ']')
+            {
+                break;
+            }
+            if (m_scanner.inputText[entry] != ',')
+            {
+                return false;
+            }
+        }
+
+        *value = arrayObj;
+        return true;
+    }
+
+    void JSONParser::LearnRecordShape(Js::Var element, Js::DynamicType** previousRecordType, JsonRecordShape* shape)
+    {
+        if (!Js::DynamicObject::IsBaseDynamicObject(element))
+        {
+            *previousRecordType = nullptr;
+            return;
+        }
+
+        Js::DynamicObject* object = Js::UnsafeVarTo<Js::DynamicObject>(element);
+        Js::DynamicType* type = object->GetDynamicType();
+        if (type != *previousRecordType)
+        {
+            *previousRecordType = type;
+            return;
+        }
+
+        // Only layouts that a new object can take as they are: shared path types with every member in a slot
+        Js::DynamicTypeHandler* typeHandler = type->GetTypeHandler();
+        const int memberCount = typeHandler->GetPropertyCount();
+        if (!type->GetIsShared() || !typeHandler->IsPathTypeHandler() || object->HasObjectArray() || memberCount == 0)
+        {
+            return;
+        }
+
+        // Path types keep their properties in slot order
+        const Js::PropertyRecord** members = AnewArray(this->arenaAllocator, const Js::PropertyRecord*, memberCount);
+        for (int i = 0; i < memberCount; i++)
+        {
+            members[i] = scriptContext->GetPropertyName(typeHandler->GetPropertyId(scriptContext, (PropertyIndex)i));
+        }
+
+        shape->type = type;
+        shape->members = members;
+        shape->memberCount = (uint)memberCount;
+    }
+
+    bool JSONParser::ParseIndexedRecord(const JsonRecordShape& shape, Js::Var* value, bool* mispredicted)
+    {
+        // The object gets its final type and slots up front, the members only have to be checked against the
+        // shape and stored. The '{' has been consumed.
+        Js::DynamicObject* object = Js::DynamicObject::New(scriptContext->GetRecycler(), shape.type);
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
+
+        uint32 entry;
+        for (uint i = 0; i < shape.memberCount; i++)
+        {
+            if (!m_structuralIndex.Next(&entry))
+            {
+                return false;
+            }
+            if (i == 0 && m_scanner.inputText[entry] == '}')
+            {
+                // {}
+                *mispredicted = true;
+                return FinishMispredictedRecord(shape, object, 0, nullptr, 0, false, value);
+            }
+
+            const char16* name;
+            uint nameLength;
+            if (m_scanner.inputText[entry] != '"' || !ScanIndexedString(entry, &name, &nameLength))
+            {
+                return false;
+            }
+            if (!shape.members[i]->Equals(JsUtil::CharacterBuffer<WCHAR>(name, nameLength)))
+            {
+                *mispredicted = true;
+                return FinishMispredictedRecord(shape, object, i, name, nameLength, true, value);
+            }
+
+            if (!m_structuralIndex.Next(&entry) || m_scanner.inputText[entry] != ':')
+            {
+                return false;
+            }
+            Js::Var memberValue;
+            if (!ParseIndexedValue(&memberValue))
+            {
+                return false;
+            }
+            object->SetSlot(SetSlotArguments(shape.members[i]->GetPropertyId(), i, memberValue));
+
+            if (!m_structuralIndex.Next(&entry))
+            {
+                return false;
+            }
+            const bool isLastMember = i + 1 == shape.memberCount;
+            if (m_scanner.inputText[entry] == '}')
+            {
+                if (!isLastMember)
+                {
+                    // Fewer members
+                    *mispredicted = true;
+                    return FinishMispredictedRecord(shape, object, i + 1, nullptr, 0, false, value);
+                }
+            }
+            else if (m_scanner.inputText[entry] == ',')
+            {
+                if (isLastMember)
+                {
+                    // More members
+                    *mispredicted = true;
+                    return FinishMispredictedRecord(shape, object, i + 1, nullptr, 0, true, value);
+                }
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        *value = object;
+        return true;
+    }
+
+    bool JSONParser::FinishMispredictedRecord(const JsonRecordShape& shape, Js::DynamicObject* partialObject, uint parsedCount,
+        const char16* name, uint nameLength, bool hasMoreMembers, Js::Var* value)
+    {
+        // The partial object has the wrong type, rebuild the members parsed so far on a new object and go on
+        // with the generic member parse
+        OUTPUT_TRACE(Js::JSONRecordShapePhase, _u("JSONParser: record shape mispredicted after %u members\n"), parsedCount);
+
+        Js::DynamicObject* object = scriptContext->GetLibrary()->CreateObject();
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
+
+        JsonTypeCache* previousCache = nullptr;
+        JsonTypeCache* currentCache = nullptr;
+        for (uint i = 0; i < parsedCount; i++)
+        {
+            const Js::PropertyRecord* propertyRecord = shape.members[i];
+            AddIndexedMember(object, propertyRecord->GetBuffer(), propertyRecord->GetLength(), propertyRecord,
+                partialObject->GetSlot(i), &previousCache, &currentCache);
+        }
+
+        if (hasMoreMembers && !ParseIndexedMembers(object, name, nameLength, &previousCache, &currentCache))
+        {
+            return false;
+        }
+
+        *value = object;
+        return true;
+    }
+
+    bool JSONParser::ParseIndexedObject(Js::Var* value)
+    {
+        if (!typeCacheList)
+        {
+            typeCacheList = Anew(this->arenaAllocator, JsonTypeCacheList, this->arenaAllocator, 8);
+        }
+
+        Js::DynamicObject* object = scriptContext->GetLibrary()->CreateObject();
+        JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_OBJECT(object));
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        if (Js::Configuration::Global.flags.IsEnabled(Js::autoProxyFlag))
+        {
+            object = VarTo<DynamicObject>(JavascriptProxy::AutoProxyWrapper(object));
+        }
+#endif
+
+        uint32 entry;
+        if (!m_structuralIndex.Peek(&entry))
+        {
+            return false;
+        }
+        if (m_scanner.inputText[entry] == '}')
+        {
+            m_structuralIndex.Next(&entry);
+            *value = object;
+            return true;
+        }
+
+        JsonTypeCache* previousCache = nullptr;
+        JsonTypeCache* currentCache = nullptr;
+        if (!ParseIndexedMembers(object, nullptr, 0, &previousCache, &currentCache))
+        {
+            return false;
+        }
+
+        *value = object;
+        return true;
+    }
+
+    bool JSONParser::ParseIndexedMembers(Js::DynamicObject* object, const char16* name, uint nameLength,
+        JsonTypeCache** previousCache, JsonTypeCache** currentCache)
+    {
+        uint32 entry;
+        while (true)
+        {
+            // "name" : value
+            if (name == nullptr)
+            {
+                if (!m_structuralIndex.Next(&entry) || m_scanner.inputText[entry] != '"' || !ScanIndexedString(entry, &name, &nameLength))
+                {
+                    return false;
+                }
+            }
+            if (!m_structuralIndex.Next(&entry) || m_scanner.inputText[entry] != ':')
+            {
+                return false;
+            }
+
+            // An escaped name is in the scanner's buffer, which the value can overwrite
+            Js::PropertyRecord const * propertyRecord = nullptr;
+            if (name < m_scanner.inputText || name >= m_scanner.inputText + m_scanner.inputLen)
+            {
+                scriptContext->GetOrAddPropertyRecord(name, nameLength, &propertyRecord);
+                name = propertyRecord->GetBuffer();
+            }
+
+            Js::Var memberValue;
+            if (!ParseIndexedValue(&memberValue))
+            {
+                return false;
+            }
+            AddIndexedMember(object, name, nameLength, propertyRecord, memberValue, previousCache, currentCache);
+            name = nullptr;
+
+            // ',' continues the member list, '}' ends it
+            if (!m_structuralIndex.Next(&entry))
+            {
+                return false;
+            }
+            if (m_scanner.inputText[entry] == '}')
+            {
+                return true;
+            }
+            if (m_scanner.inputText[entry] != ',')
+            {
+                return false;
+            }
+        }
+    }
+
+    void JSONParser::AddIndexedMember(Js::DynamicObject* object, const char16* name, uint nameLength,
+        const Js::PropertyRecord* propertyRecord, Js::Var value, JsonTypeCache** previousCache, JsonTypeCache** currentCache)
+    {
+        DynamicType* typeWithoutProperty = object->GetDynamicType();
+        if (!*previousCache)
+        {
+            // This is the first property in the list - see if we have an existing cache for it.
+            *currentCache = typeCacheList->LookupWithKey(Js::HashedCharacterBuffer<WCHAR>(name, nameLength), nullptr);
+        }
+
+        JsonTypeCache* cache = *currentCache;
+        if (cache && cache->typeWithoutProperty == typeWithoutProperty &&
+            cache->propertyRecord->Equals(JsUtil::CharacterBuffer<WCHAR>(name, nameLength)))
+        {
+            *previousCache = cache;
+            *currentCache = cache->next;
+
+            // fast path for type transition and property set
+            DynamicType* typeWithProperty = cache->typeWithProperty;
+            object->EnsureSlots(typeWithoutProperty->GetTypeHandler()->GetSlotCapacity(),
+                typeWithProperty->GetTypeHandler()->GetSlotCapacity(), scriptContext, typeWithProperty->GetTypeHandler());
+            object->ReplaceType(typeWithProperty);
+            object->SetSlot(SetSlotArguments(cache->propertyRecord->GetPropertyId(), cache->propertyIndex, value));
+            return;
+        }
+
+        // slow path
+        if (!propertyRecord)
+        {
+            scriptContext->GetOrAddPropertyRecord(name, nameLength, &propertyRecord);
+        }
+        PropertyValueInfo info;
+        object->SetProperty(propertyRecord->GetPropertyId(), value, PropertyOperation_None, &info);
+        CacheMemberType(propertyRecord, info, typeWithoutProperty, object->GetDynamicType(), previousCache, currentCache);
+    }
 } // namespace JSON
@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #pragma once
 #include "JSONScanner.h"
+#include "JSONStructuralIndex.h"
 
 namespace JSON
 {
@@ -46,6 +47,16 @@ namespace JSON
     };
 
 
+    // Layout of the object elements of an array, learned from the elements parsed so far
+    struct JsonRecordShape
+    {
+        Js::DynamicType* type;
+        const Js::PropertyRecord** members;     // in slot order
+        uint memberCount;
+
+        JsonRecordShape() : type(nullptr), members(nullptr), memberCount(0) {}
+    };
+
     class JSONParser
     {
     public:
@@ -67,6 +78,28 @@ namespace JSON
 
         Js::Var ParseObject();
 
+        // Parse driven by the structural index. These return false (without throwing) on input the token
+        // parser has to handle, so that it reports the error at the same position; see ParseIndexed.
+        Js::Var ParseIndexed(LPCWSTR str, uint length);
+        bool ParseIndexedValue(Js::Var* value);
+        bool ParseIndexedObject(Js::Var* value);
+        bool ParseIndexedMembers(Js::DynamicObject* object, const char16* name, uint nameLength,
+            JsonTypeCache** previousCache, JsonTypeCache** currentCache);
+        void AddIndexedMember(Js::DynamicObject* object, const char16* name, uint nameLength,
+            const Js::PropertyRecord* propertyRecord, Js::Var value, JsonTypeCache** previousCache, JsonTypeCache** currentCache);
+        bool ParseIndexedArray(Js::Var* value);
+        void LearnRecordShape(Js::Var element, Js::DynamicType** previousRecordType, JsonRecordShape* shape);
+        bool ParseIndexedRecord(const JsonRecordShape& shape, Js::Var* value, bool* mispredicted);
+        bool FinishMispredictedRecord(const JsonRecordShape& shape, Js::DynamicObject* partialObject, uint parsedCount,
+            const char16* name, uint nameLength, bool hasMoreMembers, Js::Var* value);
+        bool ParseIndexedScalar(uint32 entry, Js::Var* value);
+        bool ScanIndexedString(uint32 openingQuote, const char16** str, uint* length);
+
+        Js::JavascriptString* NewStringValue(const char16* str, uint length);
+        void CacheMemberType(const Js::PropertyRecord* propertyRecord, const Js::PropertyValueInfo& info,
+            Js::DynamicType* typeWithoutProperty, Js::DynamicType* typeWithProperty,
+            JsonTypeCache** previousCache, JsonTypeCache** currentCache);
+
         void CheckCurrentToken(int tk, int wErr)
         {
             if (m_token.tk != tk)
@@ -81,6 +114,7 @@ namespace JSON
 
         Token m_token;
         JSONScanner m_scanner;
+        JSONStructuralIndex m_structuralIndex;
         Js::ScriptContext* scriptContext;
         Js::RecyclableObject* reviver;
         Js::TempGuestArenaAllocatorObject* arenaAllocatorObject;
@@ -88,5 +122,6 @@ namespace JSON
         typedef JsUtil::BaseDictionary<const Js::PropertyRecord *, JsonTypeCache*, ArenaAllocator, PowerOf2SizePolicy, Js::PropertyRecordStringHashComparer>  JsonTypeCacheList;
         JsonTypeCacheList* typeCacheList;
         static const uint MIN_CACHE_LENGTH = 50; // Use Json type cache only if the JSON string is larger than this constant.
+        static const uint MaxRecordMispredictions = 4; // Stop predicting record shapes in an array after this many misses.
     };
 } // namespace JSON
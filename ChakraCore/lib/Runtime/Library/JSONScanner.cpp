@@ -4,6 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLibraryPch.h"
 #include "JSONScanner.h"
+#include "JSONStructuralIndex.h"
 
 using namespace Js;
 
@@ -233,6 +234,15 @@ namespace JSON
 
         while (currentChar < inputText + inputLen)
         {
+            // Skip the run of characters that are copied as they are
+            uint plainLength = JSONStructuralIndex::SkipPlainStringChars(currentChar, inputText + inputLen);
+            currentChar += plainLength;
+            bulkLength += plainLength;
+            if (currentChar >= inputText + inputLen)
+            {
+                break;
+            }
+
             ch = ReadNextChar();
             int tempHex;
 
@@ -17,8 +17,13 @@ JSONStringifier::JSONStringifier(_In_ ScriptContext* scriptContext) :
     indentLength(0),
     gapLength(0),
     gap(nullptr),
+    convertNumbers(true),
     propertyList(nullptr)
 {
+    if (scriptContext->Cache()->toJSONCache == nullptr)
+    {
+        scriptContext->Cache()->toJSONCache = ScriptContextPolymorphicInlineCache::New(32, scriptContext->GetLibrary());
+    }
 }
 
 void
@@ -171,11 +176,6 @@ JSONStringifier::Stringify(_In_ ScriptContext* scriptContext, _In_ Var value, _I
     Recycler* recycler = scriptContext->GetRecycler();
     JavascriptLibrary* library = scriptContext->GetLibrary();
 
-    if (scriptContext->Cache()->toJSONCache == nullptr)
-    {
-        scriptContext->Cache()->toJSONCache = ScriptContextPolymorphicInlineCache::New(32, library);
-    }
-
     JSONProperty* prop = RecyclerNewStruct(recycler, JSONProperty);
     JSONObjectStack objStack = { 0 };
 
@@ -217,6 +217,25 @@ JSONStringifier::Stringify(_In_ ScriptContext* scriptContext, _In_ Var value, _I
     }
 }
 
+JSONProperty*
+JSONStringifier::Read(_In_ ScriptContext* scriptContext, _In_ Var value)
+{
+    JSONProperty* prop = RecyclerNewStruct(scriptContext->GetRecycler(), JSONProperty);
+    JSONObjectStack objStack = { 0 };
+
+    JSONStringifier stringifier(scriptContext);
+    stringifier.convertNumbers = false;
+
+    stringifier.ReadProperty(
+        scriptContext->GetLibrary()->GetEmptyString(),
+        nullptr,
+        prop,
+        value,
+        &objStack);
+
+    return prop->type == JSONContentType::Undefined ? nullptr : prop;
+}
+
 _Ret_notnull_ Var
 JSONStringifier::ReadValue(_In_ JavascriptString* key, _In_opt_ const PropertyRecord* propertyRecord, _In_ RecyclableObject* holder)
 {
@@ -659,8 +678,11 @@ JSONStringifier::SetNumericProperty(double value, _In_ Var valueVar, _Out_ JSONP
     {
         prop->type = JSONContentType::Number;
         prop->numericValue.value = valueVar;
-        prop->numericValue.string = JavascriptConversion::ToString(valueVar, this->scriptContext);
-        this->totalStringLength = UInt32Math::Add(this->totalStringLength, prop->numericValue.string->GetLength());
+        if (this->convertNumbers)
+        {
+            prop->numericValue.string = JavascriptConversion::ToString(valueVar, this->scriptContext);
+            this->totalStringLength = UInt32Math::Add(this->totalStringLength, prop->numericValue.string->GetLength());
+        }
     }
     else
     {
@@ -795,8 +817,11 @@ JSONStringifier::ReadData(_In_ Var value, _Out_ JSONProperty* prop)
     {
         prop->type = JSONContentType::Number;
         prop->numericValue.value = value;
-        prop->numericValue.string = this->scriptContext->GetIntegerString(value);
-        this->totalStringLength = UInt32Math::Add(this->totalStringLength, prop->numericValue.string->GetLength());
+        if (this->convertNumbers)
+        {
+            prop->numericValue.string = this->scriptContext->GetIntegerString(value);
+            this->totalStringLength = UInt32Math::Add(this->totalStringLength, prop->numericValue.string->GetLength());
+        }
         return;
     }
 #if FLOATVAR
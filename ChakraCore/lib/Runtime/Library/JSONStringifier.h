@@ -55,6 +55,8 @@ class JSONStringifier
     charcount_t indentLength;
     charcount_t gapLength;
     char16* gap;
+    // Numbers are converted to strings while reading unless the caller formats them itself (see Read)
+    bool convertNumbers;
 
     Var TryConvertPrimitiveObject(_In_ RecyclableObject* value);
     Var ToJSON(_In_ JavascriptString* key, _In_ RecyclableObject* valueObject);
@@ -118,6 +120,10 @@ class JSONStringifier
 
     static LazyJSONString* Stringify(_In_ ScriptContext* scriptContext, _In_ Var value, _In_opt_ Var replacer, _In_opt_ Var space);
 
+    // Reads value as JSON.stringify(value) would, for callers that write the output themselves (JSONUtf8Builder).
+    // Numbers are left as values, without a string. Returns nullptr if value has no JSON representation.
+    static JSONProperty* Read(_In_ ScriptContext* scriptContext, _In_ Var value);
+
 }; // class JSONStringifier
 
 } //namespace Js
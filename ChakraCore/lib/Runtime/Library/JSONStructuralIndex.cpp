@@ -0,0 +1,365 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+#include "JSONStructuralIndex.h"
+
+#if JSON_STRUCTURAL_INDEX_NEON
+#include <arm_neon.h>
+#elif JSON_STRUCTURAL_INDEX_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace JSON
+{
+    namespace
+    {
+#if JSON_STRUCTURAL_INDEX_AVAILABLE
+        struct BlockMasks
+        {
+            uint64 quote;
+            uint64 backslash;
+            uint64 structural;
+            uint64 whitespace;
+            uint64 control;
+        };
+
+#if JSON_STRUCTURAL_INDEX_SSE2
+        // Narrows 16 code units to bytes. Units above 0xFF become 0x80, which isn't in any of the classes.
+        inline __m128i LoadAsBytes(const char16* position)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i nonLatin1 = _mm_set1_epi16(0x80);
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+            __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position + 8));
+            __m128i lowIsLatin1 = _mm_cmpeq_epi16(_mm_srli_epi16(low, 8), zero);
+            __m128i highIsLatin1 = _mm_cmpeq_epi16(_mm_srli_epi16(high, 8), zero);
+            low = _mm_or_si128(_mm_and_si128(low, lowIsLatin1), _mm_andnot_si128(lowIsLatin1, nonLatin1));
+            high = _mm_or_si128(_mm_and_si128(high, highIsLatin1), _mm_andnot_si128(highIsLatin1, nonLatin1));
+            return _mm_packus_epi16(low, high);
+        }
+
+        inline uint64 MoveMask(__m128i matches, uint shift)
+        {
+            return (uint64)(uint32)_mm_movemask_epi8(matches) << shift;
+        }
+
+        void ClassifyBlock(const char16* block, BlockMasks* masks)
+        {
+            const __m128i quote = _mm_set1_epi8('"');
+            const __m128i backslash = _mm_set1_epi8('\\');
+            const __m128i caseBit = _mm_set1_epi8(0x20);
+            const __m128i leftBrace = _mm_set1_epi8('{');   // '[' | 0x20
+            const __m128i rightBrace = _mm_set1_epi8('}');  // ']' | 0x20
+            const __m128i colon = _mm_set1_epi8(':');
+            const __m128i comma = _mm_set1_epi8(',');
+            const __m128i space = _mm_set1_epi8(' ');
+            const __m128i tab = _mm_set1_epi8('\t');
+            const __m128i lineFeed = _mm_set1_epi8('\n');
+            const __m128i carriageReturn = _mm_set1_epi8('\r');
+            const __m128i lastControl = _mm_set1_epi8(0x1F);
+
+            memset(masks, 0, sizeof(BlockMasks));
+            for (uint i = 0; i < JSONStructuralIndex::BlockSize; i += 16)
+            {
+                __m128i bytes = LoadAsBytes(block + i);
+                __m128i folded = _mm_or_si128(bytes, caseBit);
+
+                masks->quote |= MoveMask(_mm_cmpeq_epi8(bytes, quote), i);
+                masks->backslash |= MoveMask(_mm_cmpeq_epi8(bytes, backslash), i);
+                masks->structural |= MoveMask(_mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(folded, leftBrace), _mm_cmpeq_epi8(folded, rightBrace)),
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, colon), _mm_cmpeq_epi8(bytes, comma))), i);
+                masks->whitespace |= MoveMask(_mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, space), _mm_cmpeq_epi8(bytes, tab)),
+                    _mm_or_si128(_mm_cmpeq_epi8(bytes, lineFeed), _mm_cmpeq_epi8(bytes, carriageReturn))), i);
+                masks->control |= MoveMask(_mm_cmpeq_epi8(_mm_max_epu8(bytes, lastControl), lastControl), i);
+            }
+        }
+
+#elif JSON_STRUCTURAL_INDEX_NEON
+
+        // Narrows 16 code units to bytes. Units above 0xFF saturate to 0xFF, which isn't in any of the classes.
+        inline uint8x16_t LoadAsBytes(const char16* position)
+        {
+            const uint16_t* units = reinterpret_cast<const uint16_t*>(position);
+            return vcombine_u8(vqmovn_u16(vld1q_u16(units)), vqmovn_u16(vld1q_u16(units + 8)));
+        }
+
+        // Packs the four 16 lane compare results of a block into one bit per code unit
+        inline uint64 ToBitMask(uint8x16_t m0, uint8x16_t m1, uint8x16_t m2, uint8x16_t m3)
+        {
+            static const uint8 laneBits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+            const uint8x16_t bits = vld1q_u8(laneBits);
+            uint8x16_t sum0 = vpaddq_u8(vandq_u8(m0, bits), vandq_u8(m1, bits));
+            uint8x16_t sum1 = vpaddq_u8(vandq_u8(m2, bits), vandq_u8(m3, bits));
+            sum0 = vpaddq_u8(sum0, sum1);
+            sum0 = vpaddq_u8(sum0, sum0);
+            return vgetq_lane_u64(vreinterpretq_u64_u8(sum0), 0);
+        }
+
+        void ClassifyBlock(const char16* block, BlockMasks* masks)
+        {
+            const uint8x16_t quote = vdupq_n_u8('"');
+            const uint8x16_t backslash = vdupq_n_u8('\\');
+            const uint8x16_t caseBit = vdupq_n_u8(0x20);
+            const uint8x16_t leftBrace = vdupq_n_u8('{');   // '[' | 0x20
+            const uint8x16_t rightBrace = vdupq_n_u8('}');  // ']' | 0x20
+            const uint8x16_t colon = vdupq_n_u8(':');
+            const uint8x16_t comma = vdupq_n_u8(',');
+            const uint8x16_t space = vdupq_n_u8(' ');
+            const uint8x16_t tab = vdupq_n_u8('\t');
+            const uint8x16_t lineFeed = vdupq_n_u8('\n');
+            const uint8x16_t carriageReturn = vdupq_n_u8('\r');
+            const uint8x16_t lastControl = vdupq_n_u8(0x1F);
+
+            uint8x16_t quotes[4], backslashes[4], structurals[4], whitespaces[4], controls[4];
+            for (uint i = 0; i < 4; i++)
+            {
+                uint8x16_t bytes = LoadAsBytes(block + i * 16);
+                uint8x16_t folded = vorrq_u8(bytes, caseBit);
+
+                quotes[i] = vceqq_u8(bytes, quote);
+                backslashes[i] = vceqq_u8(bytes, backslash);
+                structurals[i] = vorrq_u8(vorrq_u8(vceqq_u8(folded, leftBrace), vceqq_u8(folded, rightBrace)),
+                    vorrq_u8(vceqq_u8(bytes, colon), vceqq_u8(bytes, comma)));
+                whitespaces[i] = vorrq_u8(vorrq_u8(vceqq_u8(bytes, space), vceqq_u8(bytes, tab)),
+                    vorrq_u8(vceqq_u8(bytes, lineFeed), vceqq_u8(bytes, carriageReturn)));
+                controls[i] = vcleq_u8(bytes, lastControl);
+            }
+
+            masks->quote = ToBitMask(quotes[0], quotes[1], quotes[2], quotes[3]);
+            masks->backslash = ToBitMask(backslashes[0], backslashes[1], backslashes[2], backslashes[3]);
+            masks->structural = ToBitMask(structurals[0], structurals[1], structurals[2], structurals[3]);
+            masks->whitespace = ToBitMask(whitespaces[0], whitespaces[1], whitespaces[2], whitespaces[3]);
+            masks->control = ToBitMask(controls[0], controls[1], controls[2], controls[3]);
+        }
+
+#endif
+
+        // Bit i of the result is the xor of bits 0..i of the input: set from an opening quote up to (not including)
+        // the closing quote
+        inline uint64 PrefixXor(uint64 bits)
+        {
+            bits ^= bits << 1;
+            bits ^= bits << 2;
+            bits ^= bits << 4;
+            bits ^= bits << 8;
+            bits ^= bits << 16;
+            bits ^= bits << 32;
+            return bits;
+        }
+#endif
+
+        inline bool IsPlainStringChar(char16 ch)
+        {
+            return ch != '"' && ch != '\\' && ch > 0x1F;
+        }
+    }
+
+    JSONStructuralIndex::JSONStructuralIndex() :
+        input(nullptr), length(0), nextBlockStart(0), entries(nullptr), entryCount(0), entryCursor(0),
+        inStringCarry(0), escapeCarry(false), separatorCarry(true), stringHasEscape(false), failed(false)
+    {
+    }
+
+    bool JSONStructuralIndex::Init(const char16* input, uint length, ArenaAllocator* allocator)
+    {
+#if JSON_STRUCTURAL_INDEX_AVAILABLE
+        // Positions have to fit next to the escape flag
+        if (length > PositionMask)
+        {
+            return false;
+        }
+
+        this->input = input;
+        this->length = length;
+        this->nextBlockStart = 0;
+        if (this->entries == nullptr)
+        {
+            this->entries = AnewArray(allocator, uint32, EntryCapacity);
+        }
+        this->entryCount = 0;
+        this->entryCursor = 0;
+        this->inStringCarry = 0;
+        this->escapeCarry = false;
+        this->separatorCarry = true;    // the start of the input
+        this->stringHasEscape = false;
+        this->failed = false;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool JSONStructuralIndex::Fill()
+    {
+#if JSON_STRUCTURAL_INDEX_AVAILABLE
+        entryCount = 0;
+        entryCursor = 0;
+
+        // Blocks inside long strings add no entries, keep going until there is something to return
+        while (!failed && nextBlockStart < length && entryCount <= EntryCapacity - BlockSize)
+        {
+            const uint remaining = length - nextBlockStart;
+            if (remaining >= BlockSize)
+            {
+                IndexBlock(input + nextBlockStart, nextBlockStart);
+            }
+            else
+            {
+                // Pad the last block with whitespace, which adds no entries
+                char16 lastBlock[BlockSize];
+                js_wmemcpy_s(lastBlock, BlockSize, input + nextBlockStart, remaining);
+                for (uint i = remaining; i < BlockSize; i++)
+                {
+                    lastBlock[i] = ' ';
+                }
+                IndexBlock(lastBlock, nextBlockStart);
+            }
+            nextBlockStart += BlockSize;
+        }
+
+        if (nextBlockStart >= length && inStringCarry != 0)
+        {
+            // Unterminated string
+            failed = true;
+        }
+        return !failed && entryCount > 0;
+#else
+        return false;
+#endif
+    }
+
+    void JSONStructuralIndex::IndexBlock(const char16* block, uint32 blockStart)
+    {
+#if JSON_STRUCTURAL_INDEX_AVAILABLE
+        BlockMasks masks;
+        ClassifyBlock(block, &masks);
+
+        // Escaped characters are the ones after a backslash that isn't escaped itself. Backslashes are rare enough
+        // in practice that walking them is cheaper than the carry-propagation tricks.
+        uint64 escaped = escapeCarry ? 1 : 0;
+        escapeCarry = false;
+        for (uint64 backslashes = masks.backslash; backslashes != 0; backslashes &= backslashes - 1)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, backslashes);
+            const uint64 bitMask = (uint64)1 << bit;
+            if ((escaped & bitMask) != 0)
+            {
+                continue;
+            }
+            if (bit == BlockSize - 1)
+            {
+                escapeCarry = true;
+            }
+            else
+            {
+                escaped |= bitMask << 1;
+            }
+        }
+
+        const uint64 quotes = masks.quote & ~escaped;
+        const uint64 inString = PrefixXor(quotes) ^ inStringCarry;
+        inStringCarry = (uint64)((int64)inString >> 63);
+
+        // Control characters are only allowed as whitespace outside strings; leave the rest (and '\0') to the token parser
+        if ((masks.control & (inString | ~masks.whitespace)) != 0)
+        {
+            failed = true;
+            return;
+        }
+
+        const uint64 openingQuotes = quotes & inString;
+        const uint64 closingQuotes = quotes & ~inString;
+        const uint64 structural = masks.structural & ~inString;
+
+        // Values that aren't strings, objects or arrays start with a character that follows a separator. The
+        // rest of the value isn't indexed, the parser checks the value ends at a separator.
+        const uint64 separators = ((masks.structural | masks.whitespace) & ~inString) | closingQuotes;
+        const uint64 followsSeparator = (separators << 1) | (separatorCarry ? 1 : 0);
+        separatorCarry = (separators >> 63) != 0;
+        const uint64 scalarStarts = ~(masks.structural | masks.whitespace | masks.quote | inString) & followsSeparator;
+
+        // Where the string that is open at the current entry starts in this block (0 if it started earlier)
+        uint openBit = 0;
+        for (uint64 pending = structural | quotes | scalarStarts; pending != 0; pending &= pending - 1)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, pending);
+            const uint64 bitMask = (uint64)1 << bit;
+            uint32 entry = blockStart + bit;
+            if ((openingQuotes & bitMask) != 0)
+            {
+                openBit = bit;
+                stringHasEscape = false;
+            }
+            else if ((closingQuotes & bitMask) != 0)
+            {
+                const uint64 stringBits = (bitMask - 1) & ~(((uint64)1 << openBit) - 1);
+                if (stringHasEscape || (masks.backslash & stringBits) != 0)
+                {
+                    entry |= StringHasEscapeFlag;
+                }
+            }
+            entries[entryCount++] = entry;
+        }
+
+        if (inStringCarry != 0 && (masks.backslash & ~(((uint64)1 << openBit) - 1)) != 0)
+        {
+            stringHasEscape = true;
+        }
+#endif
+    }
+
+    uint JSONStructuralIndex::SkipPlainStringChars(const char16* current, const char16* end)
+    {
+        const char16* position = current;
+
+#if JSON_STRUCTURAL_INDEX_SSE2
+        const __m128i quote = _mm_set1_epi16('"');
+        const __m128i backslash = _mm_set1_epi16('\\');
+        const __m128i lastControl = _mm_set1_epi16(0x1F);
+        const __m128i zero = _mm_setzero_si128();
+        for (; position + 8 <= end; position += 8)
+        {
+            __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+            __m128i special = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(units, quote), _mm_cmpeq_epi16(units, backslash)),
+                _mm_cmpeq_epi16(_mm_subs_epu16(units, lastControl), zero));
+            uint32 mask = (uint32)_mm_movemask_epi8(special);
+            if (mask != 0)
+            {
+                DWORD bit;
+                GetFirstBitSet(&bit, mask);
+                return (uint)(position - current) + bit / 2;
+            }
+        }
+#elif JSON_STRUCTURAL_INDEX_NEON
+        const uint16x8_t quote = vdupq_n_u16('"');
+        const uint16x8_t backslash = vdupq_n_u16('\\');
+        const uint16x8_t lastControl = vdupq_n_u16(0x1F);
+        for (; position + 8 <= end; position += 8)
+        {
+            uint16x8_t units = vld1q_u16(reinterpret_cast<const uint16_t*>(position));
+            uint16x8_t special = vorrq_u16(vorrq_u16(vceqq_u16(units, quote), vceqq_u16(units, backslash)),
+                vcleq_u16(units, lastControl));
+            // 8 bits per lane
+            uint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(special, 4)), 0);
+            if (mask != 0)
+            {
+                DWORD bit;
+                GetFirstBitSet(&bit, mask);
+                return (uint)(position - current) + bit / 8;
+            }
+        }
+#endif
+
+        while (position < end && IsPlainStringChar(*position))
+        {
+            position++;
+        }
+        return (uint)(position - current);
+    }
+} // namespace JSON
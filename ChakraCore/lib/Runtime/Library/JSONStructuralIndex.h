@@ -0,0 +1,94 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(CHAKRA_NEON_DISABLED)
+#define JSON_STRUCTURAL_INDEX_NEON 1
+#define JSON_STRUCTURAL_INDEX_AVAILABLE 1
+#elif defined(_M_X64) || defined(_M_IX86)
+#define JSON_STRUCTURAL_INDEX_SSE2 1
+#define JSON_STRUCTURAL_INDEX_AVAILABLE 1
+#else
+#define JSON_STRUCTURAL_INDEX_AVAILABLE 0
+#endif
+
+namespace JSON
+{
+    // First stage of the indexed JSON.parse (see JSONParser::ParseIndexed), in the style of simdjson.
+    //
+    // The input is classified 64 code units at a time with SIMD compares into bit masks (quotes, backslashes,
+    // structural characters, whitespace, control characters). Escaped quotes are removed, a prefix xor over the
+    // remaining quotes gives the string interiors, and the positions of the structural characters outside strings,
+    // of the opening and closing quotes and of the first character of every other value (numbers, literals) are
+    // written to a small buffer, which is refilled as the parser consumes it.
+    //
+    // The index doesn't validate the grammar. It fails (HasFailed) on input the parser has to leave to the token
+    // parser: control characters in strings, other control characters outside strings (including '\0', which the
+    // token scanner treats as the end of the input) and unterminated strings.
+    class JSONStructuralIndex
+    {
+    public:
+        static const uint BlockSize = 64;
+
+        // An entry is the position of the character in the input. Closing quotes of strings that contain a
+        // backslash are flagged, strings without one can be used in place.
+        static const uint32 PositionMask = 0x7FFFFFFF;
+        static const uint32 StringHasEscapeFlag = 0x80000000;
+
+        JSONStructuralIndex();
+
+        // Returns false if the input can't be indexed
+        bool Init(const char16* input, uint length, ArenaAllocator* allocator);
+
+        bool Peek(uint32* entry)
+        {
+            if (entryCursor == entryCount && !Fill())
+            {
+                return false;
+            }
+            *entry = entries[entryCursor];
+            return true;
+        }
+
+        bool Next(uint32* entry)
+        {
+            if (!Peek(entry))
+            {
+                return false;
+            }
+            entryCursor++;
+            return true;
+        }
+
+        bool HasFailed() const { return failed; }
+
+        // Number of code units from current up to the first '"', '\\' or control character (or end). Used by the
+        // token scanner to skip through string contents; available on every target.
+        static uint SkipPlainStringChars(const char16* current, const char16* end);
+
+    private:
+        // Blocks are indexed until fewer than BlockSize entries are free
+        static const uint EntryCapacity = 64 * BlockSize;
+
+        bool Fill();
+        void IndexBlock(const char16* block, uint32 blockStart);
+
+        const char16* input;
+        uint length;
+        uint nextBlockStart;
+
+        uint32* entries;
+        uint entryCount;
+        uint entryCursor;
+
+        // Carried from one block to the next
+        uint64 inStringCarry;       // all ones if the block ended inside a string
+        bool escapeCarry;           // the block ended with an unescaped backslash
+        bool separatorCarry;        // the block ended with whitespace, a structural character or a closing quote
+        bool stringHasEscape;       // the string that is still open has a backslash in an earlier block
+
+        bool failed;
+    };
+} // namespace JSON
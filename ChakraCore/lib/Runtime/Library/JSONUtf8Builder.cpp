@@ -0,0 +1,533 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#include "RuntimeLibraryPch.h"
+
+#if (defined(__aarch64__) || defined(_M_ARM64)) && !defined(CHAKRA_NEON_DISABLED)
+#define JSON_UTF8_BUILDER_NEON 1
+#include <arm_neon.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#define JSON_UTF8_BUILDER_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Js
+{
+
+namespace
+{
+    inline bool IsPlainCharacter(char16 character)
+    {
+        return character >= _u(' ') && character < 0x80 && character != _u('"') && character != _u('\\');
+    }
+}
+
+JSONUtf8Builder::JSONUtf8Builder(
+    _In_ ScriptContext* scriptContext,
+    _Out_writes_opt_(bufferSize) char* buffer,
+    size_t bufferSize,
+    _In_opt_ FlushCallback flush,
+    _In_opt_ void* flushState) :
+        scriptContext(scriptContext),
+        flush(flush),
+        flushState(flushState),
+        bufferStart(buffer),
+        currentLocation(buffer),
+        endLocation(buffer + bufferSize),
+        flushedLength(0),
+        isDiscarding(false),
+        isStopped(false)
+{
+    Assert(flush == nullptr || (buffer != nullptr && bufferSize >= MinChunkSize));
+    if (buffer == nullptr)
+    {
+        // Only the length is wanted
+        this->isDiscarding = true;
+        this->bufferStart = this->currentLocation = this->discardBuffer;
+        this->endLocation = this->discardBuffer + MinChunkSize;
+    }
+}
+
+void
+JSONUtf8Builder::Flush()
+{
+    const size_t length = this->currentLocation - this->bufferStart;
+    this->flushedLength += length;
+
+    if (!this->isDiscarding)
+    {
+        if (this->flush == nullptr)
+        {
+            // The fixed buffer is full, count the rest of the output
+            this->isDiscarding = true;
+        }
+        else if (length != 0 && !this->flush(this->bufferStart, length, this->flushState))
+        {
+            this->isDiscarding = true;
+            this->isStopped = true;
+        }
+
+        if (this->isDiscarding)
+        {
+            this->bufferStart = this->discardBuffer;
+            this->endLocation = this->discardBuffer + MinChunkSize;
+        }
+    }
+
+    this->currentLocation = this->bufferStart;
+}
+
+void
+JSONUtf8Builder::Reserve(size_t count)
+{
+    Assert(count <= MinChunkSize);
+    if (static_cast<size_t>(this->endLocation - this->currentLocation) < count)
+    {
+        this->Flush();
+    }
+}
+
+void
+JSONUtf8Builder::AppendCharacter(char character)
+{
+    this->Reserve(1);
+    *this->currentLocation = character;
+    ++this->currentLocation;
+}
+
+void
+JSONUtf8Builder::AppendBuffer(_In_reads_(length) const char* buffer, size_t length)
+{
+    this->Reserve(length);
+    memcpy(this->currentLocation, buffer, length);
+    this->currentLocation += length;
+}
+
+void
+JSONUtf8Builder::AppendUnsigned(uint64 value, bool isNegative)
+{
+    char digits[21];
+    char* digit = digits + _countof(digits);
+    do
+    {
+        *--digit = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    if (isNegative)
+    {
+        *--digit = '-';
+    }
+    this->AppendBuffer(digit, digits + _countof(digits) - digit);
+}
+
+void
+JSONUtf8Builder::AppendInteger(int64 value)
+{
+    this->AppendUnsigned(value < 0 ? 0 - static_cast<uint64>(value) : static_cast<uint64>(value), value < 0);
+}
+
+void
+JSONUtf8Builder::AppendNumber(_In_ Var value)
+{
+    // Format straight from the value, JSONStringifier::Read didn't create a string for it
+    if (TaggedInt::Is(value))
+    {
+        this->AppendInteger(TaggedInt::ToInt32(value));
+        return;
+    }
+
+    switch (JavascriptOperators::GetTypeId(value))
+    {
+    case TypeIds_Int64Number:
+        this->AppendInteger(UnsafeVarTo<JavascriptInt64Number>(value)->GetValue());
+        return;
+    case TypeIds_UInt64Number:
+        this->AppendUnsigned(UnsafeVarTo<JavascriptUInt64Number>(value)->GetValue(), false);
+        return;
+    default:
+        break;
+    }
+
+    const double doubleValue = JavascriptNumber::GetValue(value);
+    Assert(NumberUtilities::IsFinite(doubleValue));
+
+    int32 intValue;
+    if (JavascriptNumber::TryGetInt32Value<true>(doubleValue, &intValue))
+    {
+        // Includes -0, which is written as 0
+        this->AppendInteger(intValue);
+        return;
+    }
+
+    // The shortest round trip form is at most 25 characters ("-1.2345678901234567e-300")
+    char16 wideDigits[32];
+    if (!NumberUtilities::FNonZeroFiniteDblToStr(doubleValue, wideDigits, _countof(wideDigits)))
+    {
+        JavascriptError::ThrowOutOfMemoryError(this->scriptContext);
+    }
+
+    char digits[_countof(wideDigits)];
+    size_t length = 0;
+    for (; wideDigits[length] != _u('\0'); ++length)
+    {
+        Assert(wideDigits[length] < 0x80);
+        digits[length] = static_cast<char>(wideDigits[length]);
+    }
+    this->AppendBuffer(digits, length);
+}
+
+void
+JSONUtf8Builder::AppendEscapeSequence(char16 character)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    const char sequence[6] =
+    {
+        '\\', 'u',
+        hexDigits[(character >> 12) & 0xF],
+        hexDigits[(character >> 8) & 0xF],
+        hexDigits[(character >> 4) & 0xF],
+        hexDigits[character & 0xF]
+    };
+    this->AppendBuffer(sequence, _countof(sequence));
+}
+
+// Writes the character at current, which isn't plain, and returns the position after it
+const char16*
+JSONUtf8Builder::AppendSpecialCharacter(_In_ const char16* current, _In_ const char16* end)
+{
+    const char16 character = *current;
+
+    // Each piece is reserved with its exact size, so that a fixed buffer holds as much of the output as fits
+    switch (character)
+    {
+    case _u('"'):
+        this->AppendBuffer("\\\"", 2);
+        return current + 1;
+    case _u('\\'):
+        this->AppendBuffer("\\\\", 2);
+        return current + 1;
+    case _u('\b'):
+        this->AppendBuffer("\\b", 2);
+        return current + 1;
+    case _u('\f'):
+        this->AppendBuffer("\\f", 2);
+        return current + 1;
+    case _u('\n'):
+        this->AppendBuffer("\\n", 2);
+        return current + 1;
+    case _u('\r'):
+        this->AppendBuffer("\\r", 2);
+        return current + 1;
+    case _u('\t'):
+        this->AppendBuffer("\\t", 2);
+        return current + 1;
+    default:
+        break;
+    }
+
+    if (character < _u(' ') || utf8::IsLowSurrogateChar(character))
+    {
+        this->AppendEscapeSequence(character);
+        return current + 1;
+    }
+
+    if (utf8::IsHighSurrogateChar(character))
+    {
+        if (current + 1 < end && utf8::IsLowSurrogateChar(current[1]))
+        {
+            this->Reserve(4);
+            this->currentLocation = reinterpret_cast<char*>(utf8::EncodeSurrogatePair<false>(
+                character, current[1], reinterpret_cast<LPUTF8>(this->currentLocation)));
+            return current + 2;
+        }
+
+        // High-surrogate code unit not followed by a trailing-surrogate code unit should be escaped.
+        this->AppendEscapeSequence(character);
+        return current + 1;
+    }
+
+    this->Reserve(character < 0x800 ? 2 : 3);
+    this->currentLocation = reinterpret_cast<char*>(utf8::Encode<false>(
+        character, reinterpret_cast<LPUTF8>(this->currentLocation), this->endLocation));
+    return current + 1;
+}
+
+void
+JSONUtf8Builder::AppendEscapedContent(_In_reads_(length) const char16* content, charcount_t length)
+{
+    const char16* current = content;
+    const char16* end = content + length;
+    while (current < end && !this->isStopped)
+    {
+        // Narrow the plain run straight into the output, as much of it as fits
+        const charcount_t available = static_cast<charcount_t>(
+            min(static_cast<size_t>(end - current), static_cast<size_t>(this->endLocation - this->currentLocation)));
+        const charcount_t plainLength = NarrowPlainCharacters(current, available, this->currentLocation);
+        this->currentLocation += plainLength;
+        current += plainLength;
+
+        if (current == end)
+        {
+            break;
+        }
+
+        if (plainLength == available)
+        {
+            this->Flush();
+            continue;
+        }
+
+        current = this->AppendSpecialCharacter(current, end);
+    }
+}
+
+void
+JSONUtf8Builder::AppendEscapedOneByteContent(_In_reads_(length) const char* content, charcount_t length)
+{
+    const char* current = content;
+    const char* end = content + length;
+    while (current < end && !this->isStopped)
+    {
+        const charcount_t available = static_cast<charcount_t>(
+            min(static_cast<size_t>(end - current), static_cast<size_t>(this->endLocation - this->currentLocation)));
+        const charcount_t plainLength = CopyPlainCharacters(current, available, this->currentLocation);
+        this->currentLocation += plainLength;
+        current += plainLength;
+
+        if (current == end)
+        {
+            break;
+        }
+
+        if (plainLength == available)
+        {
+            this->Flush();
+            continue;
+        }
+
+        // Latin-1 characters are never surrogates, so only one is looked at
+        const char16 character = static_cast<char16>(static_cast<unsigned char>(*current));
+        this->AppendSpecialCharacter(&character, &character + 1);
+        ++current;
+    }
+}
+
+void
+JSONUtf8Builder::AppendEscapedString(_In_ JavascriptString* str)
+{
+    this->AppendCharacter('"');
+    if (VarIs<OneByteString>(str))
+    {
+        // Don't widen one-byte strings (e.g. from JSON.parse) just to narrow them again
+        OneByteString* oneByteString = UnsafeVarTo<OneByteString>(str);
+        this->AppendEscapedOneByteContent(oneByteString->GetOneByteBuffer(), oneByteString->GetLength());
+    }
+    else
+    {
+        this->AppendEscapedContent(str->GetString(), str->GetLength());
+    }
+    this->AppendCharacter('"');
+}
+
+void
+JSONUtf8Builder::AppendObject(_In_ JSONObject* valueList)
+{
+    this->AppendCharacter('{');
+
+    bool isFirstMember = true;
+    FOREACH_SLISTCOUNTED_ENTRY(JSONObjectProperty, entry, valueList)
+    {
+        if (this->isStopped)
+        {
+            return;
+        }
+
+        if (!isFirstMember)
+        {
+            this->AppendCharacter(',');
+        }
+        this->AppendEscapedString(entry.propertyName);
+        this->AppendCharacter(':');
+        this->AppendProperty(&entry.propertyValue);
+
+        isFirstMember = false;
+    }
+    NEXT_SLISTCOUNTED_ENTRY;
+
+    this->AppendCharacter('}');
+}
+
+void
+JSONUtf8Builder::AppendArray(_In_ JSONArray* valueArray)
+{
+    const uint32 length = valueArray->length;
+    JSONProperty* arr = valueArray->arr;
+
+    this->AppendCharacter('[');
+    for (uint32 i = 0; i < length && !this->isStopped; ++i)
+    {
+        if (i != 0)
+        {
+            this->AppendCharacter(',');
+        }
+        this->AppendProperty(&arr[i]);
+    }
+    this->AppendCharacter(']');
+}
+
+void
+JSONUtf8Builder::AppendProperty(_In_ JSONProperty* prop)
+{
+    switch (prop->type)
+    {
+    case JSONContentType::False:
+        this->AppendBuffer("false", 5);
+        return;
+    case JSONContentType::True:
+        this->AppendBuffer("true", 4);
+        return;
+    case JSONContentType::Null:
+        this->AppendBuffer("null", 4);
+        return;
+    case JSONContentType::Number:
+        this->AppendNumber(prop->numericValue.value);
+        return;
+    case JSONContentType::Object:
+        this->AppendObject(prop->obj);
+        return;
+    case JSONContentType::Array:
+        this->AppendArray(prop->arr);
+        return;
+    case JSONContentType::String:
+        this->AppendEscapedString(prop->stringValue);
+        return;
+    default:
+        Assume(UNREACHED);
+    }
+}
+
+bool
+JSONUtf8Builder::Build(_In_ JSONProperty* prop)
+{
+    this->AppendProperty(prop);
+    if (this->flush != nullptr && !this->isDiscarding)
+    {
+        this->Flush();
+    }
+    return !this->isStopped;
+}
+
+charcount_t
+JSONUtf8Builder::NarrowPlainCharacters(_In_reads_(length) const char16* src, charcount_t length, _Out_writes_(length) char* dst)
+{
+    charcount_t i = 0;
+
+    // Blocks of 8 are narrowed and stored whole; past the first character that isn't plain the bytes are garbage,
+    // but they are inside dst and the caller only keeps the returned count
+#if JSON_UTF8_BUILDER_SSE2
+    const __m128i quote = _mm_set1_epi16('"');
+    const __m128i backslash = _mm_set1_epi16('\\');
+    const __m128i space = _mm_set1_epi16(' ');
+    const __m128i printableRange = _mm_set1_epi16(0x7F - ' ');
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 8 <= length; i += 8)
+    {
+        __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // units - ' ' <= 0x5F (unsigned) for ' ' to 0x7F
+        __m128i printable = _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(units, space), printableRange), zero);
+        __m128i plain = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi16(units, quote), _mm_cmpeq_epi16(units, backslash)), printable);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(units, units));
+        uint32 mask = (uint32)_mm_movemask_epi8(plain) ^ 0xFFFF;
+        if (mask != 0)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, mask);
+            return i + bit / 2;
+        }
+    }
+#elif JSON_UTF8_BUILDER_NEON
+    const uint16x8_t quote = vdupq_n_u16('"');
+    const uint16x8_t backslash = vdupq_n_u16('\\');
+    const uint16x8_t space = vdupq_n_u16(' ');
+    const uint16x8_t printableCount = vdupq_n_u16(0x80 - ' ');
+    for (; i + 8 <= length; i += 8)
+    {
+        uint16x8_t units = vld1q_u16(reinterpret_cast<const uint16_t*>(src + i));
+        uint16x8_t printable = vcltq_u16(vsubq_u16(units, space), printableCount);
+        uint16x8_t special = vmvnq_u16(vbicq_u16(printable, vorrq_u16(vceqq_u16(units, quote), vceqq_u16(units, backslash))));
+        vst1_u8(reinterpret_cast<uint8_t*>(dst + i), vmovn_u16(units));
+        // 8 bits per lane
+        uint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(special, 4)), 0);
+        if (mask != 0)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, mask);
+            return i + bit / 8;
+        }
+    }
+#endif
+
+    for (; i < length && IsPlainCharacter(src[i]); ++i)
+    {
+        dst[i] = static_cast<char>(src[i]);
+    }
+    return i;
+}
+
+charcount_t
+JSONUtf8Builder::CopyPlainCharacters(_In_reads_(length) const char* src, charcount_t length, _Out_writes_(length) char* dst)
+{
+    charcount_t i = 0;
+
+#if JSON_UTF8_BUILDER_SSE2
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i lastControl = _mm_set1_epi8(0x1F);
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        // Signed compare, so bytes of 0x80 and up (two bytes in UTF-8) aren't printable either
+        __m128i printable = _mm_cmpgt_epi8(bytes, lastControl);
+        __m128i plain = _mm_andnot_si128(_mm_or_si128(_mm_cmpeq_epi8(bytes, quote), _mm_cmpeq_epi8(bytes, backslash)), printable);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bytes);
+        uint32 mask = (uint32)_mm_movemask_epi8(plain) ^ 0xFFFF;
+        if (mask != 0)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, mask);
+            return i + bit;
+        }
+    }
+#elif JSON_UTF8_BUILDER_NEON
+    const uint8x16_t quote = vdupq_n_u8('"');
+    const uint8x16_t backslash = vdupq_n_u8('\\');
+    const uint8x16_t space = vdupq_n_u8(' ');
+    const uint8x16_t nonAscii = vdupq_n_u8(0x80);
+    for (; i + 16 <= length; i += 16)
+    {
+        uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(src + i));
+        uint8x16_t printable = vandq_u8(vcgeq_u8(bytes, space), vcltq_u8(bytes, nonAscii));
+        uint8x16_t special = vmvnq_u8(vbicq_u8(printable, vorrq_u8(vceqq_u8(bytes, quote), vceqq_u8(bytes, backslash))));
+        vst1q_u8(reinterpret_cast<uint8_t*>(dst + i), bytes);
+        // 4 bits per byte
+        uint64 mask = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(special), 4)), 0);
+        if (mask != 0)
+        {
+            DWORD bit;
+            GetFirstBitSet(&bit, mask);
+            return i + bit / 4;
+        }
+    }
+#endif
+
+    for (; i < length && IsPlainCharacter(static_cast<unsigned char>(src[i])); ++i)
+    {
+        dst[i] = src[i];
+    }
+    return i;
+}
+
+} // namespace Js
@@ -0,0 +1,79 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+#pragma once
+
+namespace Js
+{
+
+// Writes the JSON text of a JSONProperty tree (see JSONStringifier::Read) as UTF-8, without building the
+// UTF-16 string first. Output goes either to a fixed buffer or, in chunks, to a flush callback that gets the
+// buffer each time it fills up.
+//
+// Plain ASCII runs of strings are narrowed into the output with SIMD; numbers are formatted from their values.
+// Only the compact form is written (no gap).
+class JSONUtf8Builder
+{
+public:
+    // Called with the filled part of the buffer; returning false stops the build
+    typedef bool (*FlushCallback)(_In_reads_(length) const char* chunk, size_t length, _In_opt_ void* flushState);
+
+    // Every piece that is written at once (escape sequences, numbers, literals) fits in this many bytes,
+    // so a flushed buffer must be at least this large
+    static const size_t MinChunkSize = 64;
+
+    JSONUtf8Builder(
+        _In_ ScriptContext* scriptContext,
+        _Out_writes_opt_(bufferSize) char* buffer,
+        size_t bufferSize,
+        _In_opt_ FlushCallback flush,
+        _In_opt_ void* flushState);
+
+    // Returns false if the flush callback stopped the build. With a fixed buffer, the output stops at the first
+    // piece that doesn't fit, and the rest is counted but not written; the buffer content is then incomplete and
+    // GetLength() is larger than the buffer.
+    bool Build(_In_ JSONProperty* prop);
+
+    // Total number of bytes in the output
+    size_t GetLength() const { return this->flushedLength + (this->currentLocation - this->bufferStart); }
+
+private:
+    ScriptContext* scriptContext;
+    FlushCallback flush;
+    void* flushState;
+    char* bufferStart;
+    char* currentLocation;
+    char* endLocation;
+    size_t flushedLength;
+    bool isDiscarding;
+    bool isStopped;
+
+    // Output that can't go anywhere (past the end of a fixed buffer, after the callback stopped the build) is
+    // written here and dropped
+    char discardBuffer[MinChunkSize];
+
+    void Flush();
+    void Reserve(size_t count);
+    void AppendCharacter(char character);
+    void AppendBuffer(_In_reads_(length) const char* buffer, size_t length);
+    void AppendUnsigned(uint64 value, bool isNegative);
+    void AppendInteger(int64 value);
+    void AppendNumber(_In_ Var value);
+    void AppendEscapeSequence(char16 character);
+    const char16* AppendSpecialCharacter(_In_ const char16* current, _In_ const char16* end);
+    void AppendEscapedContent(_In_reads_(length) const char16* content, charcount_t length);
+    void AppendEscapedOneByteContent(_In_reads_(length) const char* content, charcount_t length);
+    void AppendEscapedString(_In_ JavascriptString* str);
+    void AppendObject(_In_ JSONObject* valueList);
+    void AppendArray(_In_ JSONArray* valueArray);
+    void AppendProperty(_In_ JSONProperty* prop);
+
+    // Copy the leading characters that are printable ASCII other than '"' and '\\' to dst, which has room for
+    // length bytes. Return the number of characters copied.
+    static charcount_t NarrowPlainCharacters(_In_reads_(length) const char16* src, charcount_t length, _Out_writes_(length) char* dst);
+    static charcount_t CopyPlainCharacters(_In_reads_(length) const char* src, charcount_t length, _Out_writes_(length) char* dst);
+};
+
+} // namespace Js
@@ -6758,6 +6758,56 @@ using namespace Js;
         return JavascriptString::strcmp(item1->StringValue, item2->StringValue) < 0;
     }
 
+    inline uint32 DecimalDigitCount(uint32 value)
+    {
+        uint32 count = 1;
+        while (value >= 10)
+        {
+            value /= 10;
+            ++count;
+        }
+        return count;
+    }
+
+    // Comparison method used in Array.prototype.sort when no comparison function was provided
+    // and every value is a tagged integer. Orders the integers the way their decimal strings
+    // would be ordered, without creating the strings.
+    bool integerStringCompare(JavascriptArray::CompareVarsInfo* cvInfo, const void* aRef, const void* bRef)
+    {
+        int32 a = TaggedInt::ToInt32(static_cast<const StringItem*>(aRef)->Value);
+        int32 b = TaggedInt::ToInt32(static_cast<const StringItem*>(bRef)->Value);
+
+        if (a == b)
+        {
+            return false;
+        }
+
+        // '-' sorts before every digit
+        if ((a < 0) != (b < 0))
+        {
+            return a < 0;
+        }
+
+        // Past the sign, pad the shorter digit string with zeros and compare the digits as numbers;
+        // if they are still equal the shorter string is a prefix of the longer one and sorts first
+        uint32 aMagnitude = a < 0 ? 0u - (uint32)a : (uint32)a;
+        uint32 bMagnitude = b < 0 ? 0u - (uint32)b : (uint32)b;
+        uint32 aDigits = DecimalDigitCount(aMagnitude);
+        uint32 bDigits = DecimalDigitCount(bMagnitude);
+        uint64 aPadded = aMagnitude;
+        uint64 bPadded = bMagnitude;
+        for (uint32 i = aDigits; i < bDigits; ++i)
+        {
+            aPadded *= 10;
+        }
+        for (uint32 i = bDigits; i < aDigits; ++i)
+        {
+            bPadded *= 10;
+        }
+
+        return aPadded != bPadded ? aPadded < bPadded : aDigits < bDigits;
+    }
+
     // Comparison method used in Array.prototype.sort with provided comparison function
     // from a different context to the .sort call
     bool compareVarsCrossContext(JavascriptArray::CompareVarsInfo* cvInfo, const void* aRef, const void* bRef)
@@ -6806,13 +6856,14 @@ using namespace Js;
         AssertMsg(*(Var*)bRef, "No null expected in sort");
 
         ScriptContext* scriptContext = cvInfo->scriptContext;
-        ThreadContext* threadContext = scriptContext->GetThreadContext();
-        Var undefined = scriptContext->GetLibrary()->GetUndefined();
+        ThreadContext* threadContext = cvInfo->threadContext;
         Var retVal;
 
+        // The call goes straight to compFn's current entry point, which is its jitted code once
+        // it has been jitted; the thread context and undefined are looked up once per sort
         BEGIN_SAFE_REENTRANT_CALL(threadContext)
         {
-            retVal = CALL_FUNCTION(scriptContext->GetThreadContext(), compFn, CallInfo(CallFlags_Value, 3), undefined, *(Var*)aRef, *(Var*)bRef);
+            retVal = CALL_FUNCTION(threadContext, compFn, CallInfo(CallFlags_Value, 3), cvInfo->undefinedValue, *(Var*)aRef, *(Var*)bRef);
         }
         END_SAFE_REENTRANT_CALL
 
@@ -6832,118 +6883,643 @@ using namespace Js;
         return dblResult < 0;
     }
 
-    // Sorting Algorithm used for short arrays
+    // Adaptive merge sort (TimSort) used by Array.prototype.sort and TypedArray.prototype.sort
+    // The list is split into runs that are already in order, strictly descending runs are
+    // reversed, and short runs are extended to a minimum length with a binary insertion sort.
+    // The runs are kept on a stack whose lengths are merged so they stay balanced, and a merge
+    // switches to galloping (an exponential search) while one run keeps supplying the output,
+    // so sorted, reversed and partially sorted input take close to linear time.
+    // Only compareType is used, which tells whether its first argument sorts strictly before the
+    // second, so the sort is stable. An inconsistent comparison function only affects the order
+    // of the result, never which elements are in it.
     template<typename T>
-    void JavascriptArray::InsertionSort(T* list, uint32 length, JavascriptArray::CompareVarsInfo* cvInfo)
+    class TimSortState
     {
-        bool (*compareType)(JavascriptArray::CompareVarsInfo*, const void*, const void*) = cvInfo->compareType;
-        uint32 sortedCount = 1, lowerBound = 0, insertPoint = 0, upperBound = 0;
-        T item;
-        while (sortedCount < length)
+    public:
+        TimSortState(T* list, uint32 length, JavascriptArray::CompareVarsInfo* cvInfo, ArenaAllocator* allocator) :
+            list(list), length(length), cvInfo(cvInfo), compareType(cvInfo->compareType), allocator(allocator),
+            buffer(nullptr), runCount(0), minGallop(MinGallop)
         {
-            item = list[sortedCount];
-            upperBound = sortedCount;
-            insertPoint = sortedCount - 1; // this lets us check for already ordered first
-            lowerBound = 0;
-            for (;;)
+        }
+
+        void Sort()
+        {
+            if (length < 2)
             {
-                if (compareType (cvInfo, &item, &list[insertPoint]) )
+                return;
+            }
+
+            if (length < MinMerge)
+            {
+                BinaryInsertionSort(0, length, CountRunAndMakeAscending(0, length));
+                return;
+            }
+
+            uint32 minRun = MinRunLength(length);
+            uint32 low = 0;
+            uint32 remaining = length;
+            do
+            {
+                uint32 runLength = CountRunAndMakeAscending(low, length);
+                if (runLength < minRun)
                 {
-                    upperBound = insertPoint;
+                    uint32 forced = remaining < minRun ? remaining : minRun;
+                    BinaryInsertionSort(low, low + forced, low + runLength);
+                    runLength = forced;
                 }
-                else
+
+                PushRun(low, runLength);
+                MergeCollapse();
+                low += runLength;
+                remaining -= runLength;
+            } while (remaining != 0);
+
+            MergeForceCollapse();
+            Assert(runCount == 1 && runs[0].length == length);
+        }
+
+    private:
+        // Lists shorter than this are sorted with a single binary insertion sort
+        static const uint32 MinMerge = 32;
+        // Number of consecutive wins by one run before a merge starts galloping
+        static const uint32 MinGallop = 7;
+        // The run lengths on the stack grow faster than the Fibonacci numbers, so this covers any uint32 length
+        static const uint32 MaxRunCount = 64;
+
+        struct Run
+        {
+            uint32 base;
+            uint32 length;
+        };
+
+        T* list;
+        uint32 length;
+        JavascriptArray::CompareVarsInfo* cvInfo;
+        bool (*compareType)(JavascriptArray::CompareVarsInfo*, const void*, const void*);
+        ArenaAllocator* allocator;
+        // Holds the shorter run of a merge, at most half the list
+        T* buffer;
+        Run runs[MaxRunCount];
+        uint32 runCount;
+        int32 minGallop;
+
+        bool Less(const T& a, const T& b)
+        {
+            return compareType(cvInfo, &a, &b);
+        }
+
+        static void CopyElements(T* dst, const T* src, uint32 count)
+        {
+            for (uint32 i = 0; i < count; ++i)
+            {
+                dst[i] = src[i];
+            }
+        }
+
+        // For overlapping copies to a higher address
+        static void CopyElementsBackward(T* dst, const T* src, uint32 count)
+        {
+            while (count > 0)
+            {
+                --count;
+                dst[count] = src[count];
+            }
+        }
+
+        static uint32 MinRunLength(uint32 n)
+        {
+            // Pick a run length in [MinMerge / 2, MinMerge] that splits n into a power of two
+            // number of runs, or slightly fewer, so the final merges are balanced
+            uint32 r = 0;
+            while (n >= MinMerge)
+            {
+                r |= n & 1;
+                n >>= 1;
+            }
+            return n + r;
+        }
+
+        // Sorts [low, high) given that [low, start) is already sorted
+        void BinaryInsertionSort(uint32 low, uint32 high, uint32 start)
+        {
+            Assert(low < start && start <= high);
+            for (; start < high; ++start)
+            {
+                T pivot = list[start];
+                uint32 left = low;
+                uint32 right = start;
+                while (left < right)
+                {
+                    uint32 mid = left + ((right - left) >> 1);
+                    if (Less(pivot, list[mid]))
+                    {
+                        right = mid;
+                    }
+                    else
+                    {
+                        left = mid + 1;
+                    }
+                }
+
+                CopyElementsBackward(list + left + 1, list + left, start - left);
+                list[left] = pivot;
+            }
+        }
+
+        // Returns the length of the run starting at low, reversing it if it is strictly descending
+        uint32 CountRunAndMakeAscending(uint32 low, uint32 high)
+        {
+            Assert(low < high);
+            uint32 runHigh = low + 1;
+            if (runHigh == high)
+            {
+                return 1;
+            }
+
+            if (Less(list[runHigh++], list[low]))
+            {
+                while (runHigh < high && Less(list[runHigh], list[runHigh - 1]))
+                {
+                    ++runHigh;
+                }
+
+                for (uint32 i = low, j = runHigh - 1; i < j; ++i, --j)
+                {
+                    T item = list[i];
+                    list[i] = list[j];
+                    list[j] = item;
+                }
+            }
+            else
+            {
+                while (runHigh < high && !Less(list[runHigh], list[runHigh - 1]))
+                {
+                    ++runHigh;
+                }
+            }
+
+            return runHigh - low;
+        }
+
+        void PushRun(uint32 base, uint32 runLength)
+        {
+            AssertOrFailFast(runCount < MaxRunCount);
+            runs[runCount].base = base;
+            runs[runCount].length = runLength;
+            ++runCount;
+        }
+
+        // Merges runs until, for the top runs X, Y, Z (Z on top), X > Y + Z and Y > Z,
+        // which keeps the stack shallow and the merges balanced
+        void MergeCollapse()
+        {
+            while (runCount > 1)
+            {
+                uint32 n = runCount - 2;
+                if ((n > 0 && runs[n - 1].length <= runs[n].length + runs[n + 1].length) ||
+                    (n > 1 && runs[n - 2].length <= runs[n - 1].length + runs[n].length))
                 {
-                    lowerBound = insertPoint + 1;
+                    if (runs[n - 1].length < runs[n + 1].length)
+                    {
+                        --n;
+                    }
                 }
-                if (lowerBound >= upperBound)
+                else if (runs[n].length > runs[n + 1].length)
                 {
                     break;
                 }
-                insertPoint = lowerBound + ((upperBound - lowerBound) / 2);
+                MergeAt(n);
             }
-            insertPoint = sortedCount;
-            while (insertPoint > lowerBound)
+        }
+
+        void MergeForceCollapse()
+        {
+            while (runCount > 1)
             {
-                list[insertPoint] = list[insertPoint - 1];
-                --insertPoint;
+                uint32 n = runCount - 2;
+                if (n > 0 && runs[n - 1].length < runs[n + 1].length)
+                {
+                    --n;
+                }
+                MergeAt(n);
             }
-            list[lowerBound] = item;
-            ++sortedCount;
         }
-    }
 
-    // Sorting algorithm for longer arrays
-    template<typename T>
-    void JavascriptArray::MergeSort(T* list, uint32 length, JavascriptArray::CompareVarsInfo* cvInfo, ArenaAllocator* allocator)
-    {
-        bool (*compareType)(JavascriptArray::CompareVarsInfo*, const void*, const void*) = cvInfo->compareType;
-        T* buffer = AnewArray(allocator, T, length);
-        uint32 bucketSize = 2, lastSize = 1, position = 0, left = 0, mid = 0, right = 0, i = 0, j = 0, k = 0;
-        uint32 doubleLength = length + length;
-        T rightElement, leftElement;
+        // Merges runs i and i + 1 of the stack
+        void MergeAt(uint32 i)
+        {
+            Assert(runCount >= 2 && (i == runCount - 2 || i == runCount - 3));
+            uint32 base1 = runs[i].base;
+            uint32 length1 = runs[i].length;
+            uint32 base2 = runs[i + 1].base;
+            uint32 length2 = runs[i + 1].length;
+            Assert(base1 + length1 == base2);
+
+            runs[i].length = length1 + length2;
+            if (i == runCount - 3)
+            {
+                runs[i + 1] = runs[i + 2];
+            }
+            --runCount;
+
+            // Elements of the first run that do not sort after the start of the second are already in place
+            uint32 skip = GallopRight(list[base2], list + base1, length1, 0);
+            base1 += skip;
+            length1 -= skip;
+            if (length1 == 0)
+            {
+                return;
+            }
+
+            // And so are the elements of the second run that do not sort before the end of the first
+            length2 = GallopLeft(list[base1 + length1 - 1], list + base2, length2, length2 - 1);
+            if (length2 == 0)
+            {
+                return;
+            }
+
+            if (length1 <= length2)
+            {
+                MergeLow(base1, length1, base2, length2);
+            }
+            else
+            {
+                MergeHigh(base1, length1, base2, length2);
+            }
+        }
+
+        // Returns the position in run at which key would be inserted before any equal elements,
+        // searching outwards from hint
+        uint32 GallopLeft(const T& key, const T* run, uint32 runLength, uint32 hint)
+        {
+            Assert(hint < runLength);
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            uint32 left, right;
+            if (Less(run[hint], key))
+            {
+                // Gallop right until run[hint + lastOffset] < key <= run[hint + offset]
+                uint32 maxOffset = runLength - hint;
+                while (offset < maxOffset && Less(run[hint + offset], key))
+                {
+                    lastOffset = offset;
+                    offset = (offset << 1) + 1;
+                    if (offset <= lastOffset)
+                    {
+                        offset = maxOffset;
+                    }
+                }
+                offset = offset < maxOffset ? offset : maxOffset;
+                left = hint + lastOffset + 1;
+                right = hint + offset;
+            }
+            else
+            {
+                // Gallop left until run[hint - offset] < key <= run[hint - lastOffset]
+                uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && !Less(run[hint - offset], key))
+                {
+                    lastOffset = offset;
+                    offset = (offset << 1) + 1;
+                    if (offset <= lastOffset)
+                    {
+                        offset = maxOffset;
+                    }
+                }
+                offset = offset < maxOffset ? offset : maxOffset;
+                left = hint + 1 - offset;
+                right = hint - lastOffset;
+            }
+
+            // Binary search within run[left - 1] < key <= run[right]
+            while (left < right)
+            {
+                uint32 mid = left + ((right - left) >> 1);
+                if (Less(run[mid], key))
+                {
+                    left = mid + 1;
+                }
+                else
+                {
+                    right = mid;
+                }
+            }
+            return right;
+        }
+
+        // Returns the position in run at which key would be inserted after any equal elements,
+        // searching outwards from hint
+        uint32 GallopRight(const T& key, const T* run, uint32 runLength, uint32 hint)
+        {
+            Assert(hint < runLength);
+            uint32 lastOffset = 0;
+            uint32 offset = 1;
+            uint32 left, right;
+            if (Less(key, run[hint]))
+            {
+                // Gallop left until run[hint - offset] <= key < run[hint - lastOffset]
+                uint32 maxOffset = hint + 1;
+                while (offset < maxOffset && Less(key, run[hint - offset]))
+                {
+                    lastOffset = offset;
+                    offset = (offset << 1) + 1;
+                    if (offset <= lastOffset)
+                    {
+                        offset = maxOffset;
+                    }
+                }
+                offset = offset < maxOffset ? offset : maxOffset;
+                left = hint + 1 - offset;
+                right = hint - lastOffset;
+            }
+            else
+            {
+                // Gallop right until run[hint + lastOffset] <= key < run[hint + offset]
+                uint32 maxOffset = runLength - hint;
+                while (offset < maxOffset && !Less(key, run[hint + offset]))
+                {
+                    lastOffset = offset;
+                    offset = (offset << 1) + 1;
+                    if (offset <= lastOffset)
+                    {
+                        offset = maxOffset;
+                    }
+                }
+                offset = offset < maxOffset ? offset : maxOffset;
+                left = hint + lastOffset + 1;
+                right = hint + offset;
+            }
+
+            // Binary search within run[left - 1] <= key < run[right]
+            while (left < right)
+            {
+                uint32 mid = left + ((right - left) >> 1);
+                if (Less(key, run[mid]))
+                {
+                    right = mid;
+                }
+                else
+                {
+                    left = mid + 1;
+                }
+            }
+            return right;
+        }
+
+        T* EnsureBuffer()
+        {
+            if (buffer == nullptr)
+            {
+                buffer = AnewArray(allocator, T, length / 2);
+            }
+            return buffer;
+        }
 
-        while (bucketSize < doubleLength)
+        // Merges adjacent runs, front to back, when the first is the shorter one. The first element
+        // of the second run sorts before the first run, and the last element of the first run sorts
+        // after the second run, which MergeAt has ensured.
+        void MergeLow(uint32 base1, uint32 length1, uint32 base2, uint32 length2)
         {
-            while (position < length)
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+            T* temp = EnsureBuffer();
+            CopyElements(temp, list + base1, length1);
+
+            uint32 cursor1 = 0;
+            uint32 cursor2 = base2;
+            uint32 dest = base1;
+            int32 gallop = minGallop;
+
+            list[dest++] = list[cursor2++];
+            if (--length2 == 0)
+            {
+                CopyElements(list + dest, temp + cursor1, length1);
+                return;
+            }
+            if (length1 == 1)
             {
-                left = position;
-                mid = left + lastSize;
+                CopyElements(list + dest, list + cursor2, length2);
+                list[dest + length2] = temp[cursor1];
+                return;
+            }
 
-                // perform a merge but only if it's necessary
-                if (mid < length && compareType (cvInfo, &list[mid], &list[mid - 1]))
+            for (;;)
+            {
+                uint32 count1 = 0;
+                uint32 count2 = 0;
+
+                // Take one element at a time until one run starts winning consistently
+                do
                 {
-                    right = position + bucketSize;
-                    right = right < length ? right : length;
-                    i = mid - 1, j = 0, k = mid;
+                    Assert(length1 > 1 && length2 > 0);
+                    if (Less(list[cursor2], temp[cursor1]))
+                    {
+                        list[dest++] = list[cursor2++];
+                        ++count2;
+                        count1 = 0;
+                        if (--length2 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    else
+                    {
+                        list[dest++] = temp[cursor1++];
+                        ++count1;
+                        count2 = 0;
+                        if (--length1 == 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                } while ((count1 | count2) < (uint32)gallop);
 
-                    while (k < right)
+                // Gallop until neither run supplies MinGallop elements in a row
+                do
+                {
+                    Assert(length1 > 1 && length2 > 0);
+                    count1 = GallopRight(list[cursor2], temp + cursor1, length1, 0);
+                    if (count1 != 0)
                     {
-                        buffer[j++] = list[k++];
+                        CopyElements(list + dest, temp + cursor1, count1);
+                        dest += count1;
+                        cursor1 += count1;
+                        length1 -= count1;
+                        if (length1 <= 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                    list[dest++] = list[cursor2++];
+                    if (--length2 == 0)
+                    {
+                        goto Done;
                     }
-    
-                    rightElement = buffer[--j];
-                    leftElement = list[i];
 
-                    for (;;)
+                    count2 = GallopLeft(temp[cursor1], list + cursor2, length2, 0);
+                    if (count2 != 0)
                     {
-                        if (compareType (cvInfo, &rightElement, &leftElement))
+                        CopyElements(list + dest, list + cursor2, count2);
+                        dest += count2;
+                        cursor2 += count2;
+                        length2 -= count2;
+                        if (length2 == 0)
                         {
-                            list[--k] = leftElement;
-                            if (i > left)
-                            {
-                                leftElement = list[--i];
-                            }
-                            else
-                            {
-                                list[--k] = rightElement;
-                                break;
-                            }
+                            goto Done;
                         }
-                        else
+                    }
+                    list[dest++] = temp[cursor1++];
+                    if (--length1 == 1)
+                    {
+                        goto Done;
+                    }
+                    --gallop;
+                } while (count1 >= MinGallop || count2 >= MinGallop);
+
+                // Make it harder to start galloping again
+                gallop = (gallop < 0 ? 0 : gallop) + 2;
+            }
+
+        Done:
+            minGallop = gallop < 1 ? 1 : gallop;
+            if (length1 == 1)
+            {
+                CopyElements(list + dest, list + cursor2, length2);
+                list[dest + length2] = temp[cursor1];
+            }
+            else
+            {
+                // When the first run ran out early (only possible with an inconsistent comparison
+                // function) the rest of the second run is already in place
+                Assert(length2 == 0 || length1 == 0);
+                CopyElements(list + dest, temp + cursor1, length1);
+            }
+        }
+
+        // Merges adjacent runs, back to front, when the second is the shorter one. The cursors
+        // and dest are one past the next element to read or write.
+        void MergeHigh(uint32 base1, uint32 length1, uint32 base2, uint32 length2)
+        {
+            Assert(length1 > 0 && length2 > 0 && base1 + length1 == base2);
+            T* temp = EnsureBuffer();
+            CopyElements(temp, list + base2, length2);
+
+            uint32 cursor1 = base1 + length1;
+            uint32 cursor2 = length2;
+            uint32 dest = base2 + length2;
+            int32 gallop = minGallop;
+
+            list[--dest] = list[--cursor1];
+            if (--length1 == 0)
+            {
+                CopyElements(list + dest - length2, temp, length2);
+                return;
+            }
+            if (length2 == 1)
+            {
+                dest -= length1;
+                cursor1 -= length1;
+                CopyElementsBackward(list + dest, list + cursor1, length1);
+                list[dest - 1] = temp[cursor2 - 1];
+                return;
+            }
+
+            for (;;)
+            {
+                uint32 count1 = 0;
+                uint32 count2 = 0;
+
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    if (Less(temp[cursor2 - 1], list[cursor1 - 1]))
+                    {
+                        list[--dest] = list[--cursor1];
+                        ++count1;
+                        count2 = 0;
+                        if (--length1 == 0)
                         {
-                            list[--k] = rightElement;
-                            if (j > 0)
-                            {
-                                rightElement = buffer[--j];
-                            }
-                            else
-                            {
-                                break;
-                            }
+                            goto Done;
+                        }
+                    }
+                    else
+                    {
+                        list[--dest] = temp[--cursor2];
+                        ++count2;
+                        count1 = 0;
+                        if (--length2 == 1)
+                        {
+                            goto Done;
                         }
                     }
+                } while ((count1 | count2) < (uint32)gallop);
 
-                    while (j > 0)
+                do
+                {
+                    Assert(length1 > 0 && length2 > 1);
+                    count1 = length1 - GallopRight(temp[cursor2 - 1], list + base1, length1, length1 - 1);
+                    if (count1 != 0)
                     {
-                        list[--k] = buffer[--j];
+                        dest -= count1;
+                        cursor1 -= count1;
+                        length1 -= count1;
+                        CopyElementsBackward(list + dest, list + cursor1, count1);
+                        if (length1 == 0)
+                        {
+                            goto Done;
+                        }
+                    }
+                    list[--dest] = temp[--cursor2];
+                    if (--length2 == 1)
+                    {
+                        goto Done;
                     }
-                }  
-                position += bucketSize;
+
+                    count2 = length2 - GallopLeft(list[cursor1 - 1], temp, length2, length2 - 1);
+                    if (count2 != 0)
+                    {
+                        dest -= count2;
+                        cursor2 -= count2;
+                        length2 -= count2;
+                        CopyElements(list + dest, temp + cursor2, count2);
+                        if (length2 <= 1)
+                        {
+                            goto Done;
+                        }
+                    }
+                    list[--dest] = list[--cursor1];
+                    if (--length1 == 0)
+                    {
+                        goto Done;
+                    }
+                    --gallop;
+                } while (count1 >= MinGallop || count2 >= MinGallop);
+
+                gallop = (gallop < 0 ? 0 : gallop) + 2;
+            }
+
+        Done:
+            minGallop = gallop < 1 ? 1 : gallop;
+            if (length2 == 1)
+            {
+                dest -= length1;
+                cursor1 -= length1;
+                CopyElementsBackward(list + dest, list + cursor1, length1);
+                list[dest - 1] = temp[cursor2 - 1];
+            }
+            else
+            {
+                // As in MergeLow, if the second run ran out early the rest of the first is in place
+                Assert(length1 == 0 || length2 == 0);
+                CopyElements(list + dest - length2, temp, length2);
             }
-            position = 0;
-            lastSize = bucketSize;
-            bucketSize *= 2;
         }
+    };
+
+    template<typename T>
+    void JavascriptArray::TimSort(T* list, uint32 length, JavascriptArray::CompareVarsInfo* cvInfo, ArenaAllocator* allocator)
+    {
+        TimSortState<T> state(list, length, cvInfo, allocator);
+        state.Sort();
     }
 
     // Set and Get helpers used in JavascriptArray::SortHelper below
@@ -6957,11 +7533,58 @@ using namespace Js;
     {
         StringItem current;
         current.Value = item;
-        JsReentLock lock = *jsReentLock;
-        JS_REENTRANT(lock, current.StringValue = JavascriptConversion::ToString(item, scriptContext));
+        if (TaggedInt::Is(item))
+        {
+            // Converting an integer cannot run script, so its string is left to SortPrepareHelper
+            current.StringValue = nullptr;
+        }
+        else
+        {
+            JsReentLock lock = *jsReentLock;
+            JS_REENTRANT(lock, current.StringValue = JavascriptConversion::ToString(item, scriptContext));
+        }
         list[index] = current;
     }
 
+    inline bool SortCanCopyDirectlyHelper(Field(Var)* list, JavascriptArray* arr)
+    {
+        return true;
+    }
+
+    inline bool SortCanCopyDirectlyHelper(StringItem* list, JavascriptArray* arr)
+    {
+        // Numbers convert to strings without running script, other values may not
+        return JavascriptNativeArray::Is(arr->GetTypeId());
+    }
+
+    inline void SortPrepareHelper(Field(Var)* list, uint32 count, JavascriptArray::CompareVarsInfo* cvInfo, ScriptContext* scriptContext)
+    {
+    }
+
+    // If every value is an integer the strings are never needed, otherwise fill in the integer strings
+    inline void SortPrepareHelper(StringItem* list, uint32 count, JavascriptArray::CompareVarsInfo* cvInfo, ScriptContext* scriptContext)
+    {
+        uint32 i = 0;
+        while (i < count && list[i].StringValue == nullptr)
+        {
+            ++i;
+        }
+
+        if (i == count)
+        {
+            cvInfo->compareType = &integerStringCompare;
+            return;
+        }
+
+        for (i = 0; i < count; ++i)
+        {
+            if (list[i].StringValue == nullptr)
+            {
+                list[i].StringValue = scriptContext->GetIntegerString(list[i].Value);
+            }
+        }
+    }
+
     inline Var SortGetHelper(Field(Var)* list, uint32 index)
     {
         return list[index];
@@ -7015,6 +7638,34 @@ using namespace Js;
             uint32 holes = 0;
             uint32 i = 0, j = 0;
 
+            // A dense array is copied straight out of its head segment, skipping the HasItem/GetItem
+            // lookups for each index, as long as reading and converting its elements cannot run script
+            JavascriptArray* arr = JavascriptArray::TryVarToNonES5Array(obj);
+#if ENABLE_COPYONACCESS_ARRAY
+            if (arr != nullptr)
+            {
+                JavascriptLibrary::CheckAndConvertCopyOnAccessNativeIntArray<Var>(arr);
+            }
+#endif
+            if (arr != nullptr && arr->GetLength() == len && !arr->IsFillFromPrototypes() && SortCanCopyDirectlyHelper(list, arr))
+            {
+                for (; i < len; ++i)
+                {
+                    Var item = nullptr;
+                    DebugOnly(BOOL gotItem =) arr->DirectGetVarItemAt(i, &item, scriptContext);
+                    Assert(gotItem);
+                    if (JavascriptOperators::GetTypeId(item) != TypeIds_Undefined)
+                    {
+                        SortSetHelper(list, item, values, &jsReentLock, scriptContext);
+                        values++;
+                    }
+                    else
+                    {
+                        ++undefinedValues;
+                    }
+                }
+            }
+
             for (; i < len; ++i)
             {
                 JS_REENTRANT(jsReentLock, BOOL hasItem = JavascriptOperators::HasItem(obj, i));
@@ -7049,16 +7700,8 @@ using namespace Js;
                 }
             }
 
-            // Call the appropriate Sorting Algorithm
-            // Insertion sort uses less memory and is quicker on short arrays but gets less efficient as arrays get longer
-            if (values < 512)
-            {
-                JS_REENTRANT(jsReentLock, JavascriptArray::InsertionSort<T>(list, values, cvInfo));
-            }
-            else
-            {
-                JS_REENTRANT(jsReentLock, JavascriptArray::MergeSort<T>(list, values, cvInfo, tempAlloc));
-            }
+            SortPrepareHelper(list, values, cvInfo, scriptContext);
+            JS_REENTRANT(jsReentLock, JavascriptArray::TimSort<T>(list, values, cvInfo, tempAlloc));
 
             // Write the sorted data back to the original array
             // Undefined values and holes are placed at the end
@@ -7125,6 +7768,8 @@ using namespace Js;
         // CompareVarsInfo struct holds data that will be used by sorting algorithm
         JavascriptArray::CompareVarsInfo cvInfo;
         cvInfo.scriptContext = scriptContext;
+        cvInfo.threadContext = scriptContext->GetThreadContext();
+        cvInfo.undefinedValue = scriptContext->GetLibrary()->GetUndefined();
         if (compFn != NULL)
         {
             cvInfo.compFn = compFn;
@@ -7147,14 +7792,7 @@ using namespace Js;
         ScriptContext* scriptContext = cvInfo->scriptContext;
         JS_REENTRANCY_LOCK(jsReentLock, scriptContext->GetThreadContext());
 
-        if (length < 512)
-        {
-            JS_REENTRANT(jsReentLock, JavascriptArray::InsertionSort<T>(list, length, cvInfo));
-        }
-        else
-        {
-            JS_REENTRANT(jsReentLock, JavascriptArray::MergeSort<T>(list, length, cvInfo, allocator));
-        }
+        JS_REENTRANT(jsReentLock, JavascriptArray::TimSort<T>(list, length, cvInfo, allocator));
     }
 
     Var JavascriptArray::EntrySplice(RecyclableObject* function, CallInfo callInfo, ...)
@@ -711,9 +711,9 @@ using namespace Js;
 #endif
 
 #ifdef DISABLE_SEH
-        // xplat: JavascriptArrayBuffer::AllocWrapper is disabled on cross-platform
-        // (IsValidVirtualBufferLength always returns false).
-        // SEH and ResumeForOutOfBoundsArrayRefs are not needed.
+        // xplat: there is no SEH. Where virtual array buffers are enabled (Linux x64),
+        // out of bounds accesses are resumed from the PAL's signal handlers through
+        // HardwareExceptionFilter instead.
         ret = JavascriptFunction::CallRootFunctionInternal(obj, args, scriptContext, inScript);
 #else
         if (scriptContext->GetThreadContext()->GetAbnormalExceptionCode() != 0)
@@ -2318,6 +2318,89 @@ void __cdecl _alloca_probe_16()
     }
 
 #if ENABLE_FAST_ARRAYBUFFER
+    // Returns the size of the virtual array buffer reservation that holds the address, or 0 if there is none
+    static size_t GetVirtualArrayBufferReservationSize(uintptr_t address)
+    {
+        MEMORY_BASIC_INFORMATION info = { 0 };
+        size_t size = VirtualQuery((LPCVOID)address, &info, sizeof(info));
+        if (size == 0)
+        {
+            return 0;
+        }
+        size_t allocationSize = info.RegionSize + ((uintptr_t)info.BaseAddress - (uintptr_t)info.AllocationBase);
+        if (allocationSize != MAX_WASM__ARRAYBUFFER_LENGTH && allocationSize != MAX_ASMJS_ARRAYBUFFER_LENGTH)
+        {
+            return 0;
+        }
+        if (info.State != MEM_RESERVE)
+        {
+            return 0;
+        }
+        if (info.Type != MEM_PRIVATE)
+        {
+            return 0;
+        }
+        return allocationSize;
+    }
+
+    // Decodes the faulting load or store and resumes after it, with 0 or NaN as the loaded value
+    static bool ResumeAfterOutOfBoundsArrayRef(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        BYTE* pc = (BYTE*)exceptionInfo->ExceptionRecord->ExceptionAddress;
+        ArrayAccessDecoder::InstructionData instrData = ArrayAccessDecoder::CheckValidInstr(pc, exceptionInfo);
+        // Check If the instruction is valid
+        if (instrData.isInvalidInstr)
+        {
+            return false;
+        }
+
+        // If we didn't find the array buffer, ignore
+        if (!instrData.bufferValue)
+        {
+            return false;
+        }
+
+        // SIMD loads/stores do bounds checks.
+        if (instrData.isSimd)
+        {
+            return false;
+        }
+
+        // Set the dst reg if the instr type is load
+        if (instrData.isLoad)
+        {
+            Var exceptionInfoReg = exceptionInfo->ContextRecord;
+            Var* exceptionInfoIntReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Rax)); // offset in the contextRecord for RAX , the assert below checks for any change in the exceptionInfo struct
+            Var* exceptionInfoFloatReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Xmm0));// offset in the contextRecord for XMM0 , the assert below checks for any change in the exceptionInfo struct
+            Assert((DWORD64)*exceptionInfoIntReg == exceptionInfo->ContextRecord->Rax);
+            Assert((uint64)*exceptionInfoFloatReg == exceptionInfo->ContextRecord->Xmm0.Low);
+
+            if (instrData.isLoad)
+            {
+                double nanVal = JavascriptNumber::NaN;
+                if (instrData.isFloat64)
+                {
+                    double* destRegLocation = (double*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
+                    *destRegLocation = nanVal;
+                }
+                else if (instrData.isFloat32)
+                {
+                    float* destRegLocation = (float*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
+                    *destRegLocation = (float)nanVal;
+                }
+                else
+                {
+                    uint64* destRegLocation = (uint64*)((uint64)exceptionInfoIntReg + 8 * (instrData.dstReg));
+                    *destRegLocation = 0;
+                }
+            }
+        }
+        // Add the bytes read to Rip and set it as new Rip
+        exceptionInfo->ContextRecord->Rip = exceptionInfo->ContextRecord->Rip + instrData.instrSizeInByte;
+
+        return true;
+    }
+
     bool ResumeForOutOfBoundsArrayRefs(int exceptionCode, ExceptionFilterHelper& helper)
     {
         if (exceptionCode != STATUS_ACCESS_VIOLATION)
@@ -2388,87 +2471,84 @@ void __cdecl _alloca_probe_16()
                 JavascriptError::ThrowWebAssemblyRuntimeError(func->GetScriptContext(), WASMERR_ArrayIndexOutOfRange);
             }
         }
-        else
+        else if (GetVirtualArrayBufferReservationSize(faultingAddr) == 0)
         {
-            MEMORY_BASIC_INFORMATION info = { 0 };
-            size_t size = VirtualQuery((LPCVOID)faultingAddr, &info, sizeof(info));
-            if (size == 0)
-            {
-                return false;
-            }
-            size_t allocationSize = info.RegionSize + ((uintptr_t)info.BaseAddress - (uintptr_t)info.AllocationBase);
-            if (allocationSize != MAX_WASM__ARRAYBUFFER_LENGTH && allocationSize != MAX_ASMJS_ARRAYBUFFER_LENGTH)
-            {
-                return false;
-            }
-            if (info.State != MEM_RESERVE)
-            {
-                return false;
-            }
-            if (info.Type != MEM_PRIVATE)
-            {
-                return false;
-            }
+            return false;
         }
 
-        PEXCEPTION_POINTERS exceptionInfo = helper.GetExceptionInfo();
-        BYTE* pc = (BYTE*)exceptionInfo->ExceptionRecord->ExceptionAddress;
-        ArrayAccessDecoder::InstructionData instrData = ArrayAccessDecoder::CheckValidInstr(pc, exceptionInfo);
-        // Check If the instruction is valid
-        if (instrData.isInvalidInstr)
+        return ResumeAfterOutOfBoundsArrayRef(helper.GetExceptionInfo());
+    }
+
+#ifndef _WIN32
+    static void ThrowWasmOutOfBoundsAccess()
+    {
+        // Runs after the signal handler has returned, as though the faulting instruction had called it
+        ScriptEntryExitRecord* entryExitRecord = ThreadContext::GetContextForCurrentThread()->GetScriptEntryExit();
+        JavascriptError::ThrowWebAssemblyRuntimeError(entryExitRecord->scriptContext, WASMERR_ArrayIndexOutOfRange);
+    }
+
+    // The signal handler counterpart of ResumeForOutOfBoundsArrayRefs. It takes no locks of its own, and doesn't
+    // look up the function object on the faulting frame, which isn't safe to do in a signal handler.
+    static bool ResumeForOutOfBoundsArrayRefsInSignalHandler(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        if (exceptionInfo->ExceptionRecord->ExceptionCode != STATUS_ACCESS_VIOLATION)
         {
             return false;
         }
 
-        // If we didn't find the array buffer, ignore
-        if (!instrData.bufferValue)
+        // AV should come from JITed code, since we don't eliminate bound checks in interpreter. Without CFG there is
+        // no pre-reserved code region here, so all jitted code is in the function range caches.
+        if (!JITPageAddrToFuncRangeCache::IsInFuncRangeBounds(exceptionInfo->ExceptionRecord->ExceptionAddress))
         {
             return false;
         }
 
-        // SIMD loads/stores do bounds checks.
-        if (instrData.isSimd)
+        // The faulting address has to be in the reservation of a virtual array buffer. The thread is running jitted
+        // code, so it can't be holding the PAL's virtual memory lock that VirtualQuery takes. The reservation size
+        // tells wasm memories, whose out of bounds accesses throw, from asm.js heaps and typed arrays.
+        Assert(exceptionInfo->ExceptionRecord->NumberParameters >= 2);
+        size_t reservationSize = GetVirtualArrayBufferReservationSize(exceptionInfo->ExceptionRecord->ExceptionInformation[1]);
+        if (reservationSize == 0)
         {
             return false;
         }
 
-        // Set the dst reg if the instr type is load
-        if (instrData.isLoad)
+        if (reservationSize == MAX_WASM__ARRAYBUFFER_LENGTH)
         {
-            Var exceptionInfoReg = exceptionInfo->ContextRecord;
-            Var* exceptionInfoIntReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Rax)); // offset in the contextRecord for RAX , the assert below checks for any change in the exceptionInfo struct
-            Var* exceptionInfoFloatReg = (Var*)((uint64)exceptionInfoReg + offsetof(CONTEXT, Xmm0));// offset in the contextRecord for XMM0 , the assert below checks for any change in the exceptionInfo struct
-            Assert((DWORD64)*exceptionInfoIntReg == exceptionInfo->ContextRecord->Rax);
-            Assert((uint64)*exceptionInfoFloatReg == exceptionInfo->ContextRecord->Xmm0.Low);
-
-            if (instrData.isLoad)
+            // C++ exceptions can't be thrown out of a signal handler. Instead resume in a helper that throws, as
+            // though the jitted code had called it from the faulting instruction. Jitted code keeps the stack 16 byte
+            // aligned past the prolog; if it isn't, the fault didn't come from where we think, so leave it alone.
+            CONTEXT* context = exceptionInfo->ContextRecord;
+            if ((context->Rsp & 0xF) != 0)
             {
-                double nanVal = JavascriptNumber::NaN;
-                if (instrData.isFloat64)
-                {
-                    double* destRegLocation = (double*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
-                    *destRegLocation = nanVal;
-                }
-                else if (instrData.isFloat32)
-                {
-                    float* destRegLocation = (float*)((uint64)exceptionInfoFloatReg + 16 * (instrData.dstReg));
-                    *destRegLocation = (float)nanVal;
-                }
-                else
-                {
-                    uint64* destRegLocation = (uint64*)((uint64)exceptionInfoIntReg + 8 * (instrData.dstReg));
-                    *destRegLocation = 0;
-                }
+                return false;
             }
+            context->Rsp -= sizeof(DWORD64);
+            *(DWORD64*)context->Rsp = context->Rip;
+            context->Rip = (DWORD64)&ThrowWasmOutOfBoundsAccess;
+            return true;
         }
-        // Add the bytes read to Rip and set it as new Rip
-        exceptionInfo->ContextRecord->Rip = exceptionInfo->ContextRecord->Rip + instrData.instrSizeInByte;
 
-        return true;
+        return ResumeAfterOutOfBoundsArrayRef(exceptionInfo);
     }
 #endif
 #endif
 #endif
+#endif
+#endif
+
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+    BOOL JavascriptFunction::HardwareExceptionFilter(PEXCEPTION_POINTERS exceptionInfo)
+    {
+        // The PAL calls this for the SIGSEGV and SIGBUS faults of every thread in the process, not just
+        // the ones under CallRootFunction, so skip threads that aren't running script.
+        if (ThreadContext::GetContextForCurrentThread() == nullptr)
+        {
+            return FALSE;
+        }
+
+        return ResumeForOutOfBoundsArrayRefsInSignalHandler(exceptionInfo);
+    }
 #endif
 
     int JavascriptFunction::CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo)
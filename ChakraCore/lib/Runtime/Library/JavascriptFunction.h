@@ -228,6 +228,10 @@ namespace Js
         void VerifyEntryPoint();
 
         static bool IsBuiltinProperty(Var objectWithProperty, PropertyIds propertyId);
+#endif
+#if ENABLE_FAST_ARRAYBUFFER && !defined(_WIN32)
+        // Registered with the PAL by ThreadContext::GlobalInitialize
+        static BOOL HardwareExceptionFilter(PEXCEPTION_POINTERS exceptionInfo);
 #endif
         private:
             static int CallRootEventFilter(int exceptionCode, PEXCEPTION_POINTERS exceptionInfo);
@@ -4526,14 +4526,15 @@ namespace Js
         // so that the update is in sync with profiler
         ScriptContext* scriptContext = mapPrototype->GetScriptContext();
         JavascriptLibrary* library = mapPrototype->GetLibrary();
+        Field(JavascriptFunction*)* builtinFuncs = library->GetBuiltinFunctions();
         library->AddMember(mapPrototype, PropertyIds::constructor, library->mapConstructor);
 
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::clear, &JavascriptMap::EntryInfo::Clear, 0);
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::delete_, &JavascriptMap::EntryInfo::Delete, 1);
         library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::forEach, &JavascriptMap::EntryInfo::ForEach, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::get, &JavascriptMap::EntryInfo::Get, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::has, &JavascriptMap::EntryInfo::Has, 1);
-        library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::set, &JavascriptMap::EntryInfo::Set, 2);
+        builtinFuncs[BuiltinFunction::JavascriptMap_Get] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::get, &JavascriptMap::EntryInfo::Get, 1);
+        builtinFuncs[BuiltinFunction::JavascriptMap_Has] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::has, &JavascriptMap::EntryInfo::Has, 1);
+        builtinFuncs[BuiltinFunction::JavascriptMap_Set] = library->AddFunctionToLibraryObject(mapPrototype, PropertyIds::set, &JavascriptMap::EntryInfo::Set, 2);
 
         library->AddAccessorsToLibraryObject(mapPrototype, PropertyIds::size, &JavascriptMap::EntryInfo::SizeGetter, nullptr);
 
@@ -4578,13 +4579,14 @@ namespace Js
         // so that the update is in sync with profiler
         ScriptContext* scriptContext = setPrototype->GetScriptContext();
         JavascriptLibrary* library = setPrototype->GetLibrary();
+        Field(JavascriptFunction*)* builtinFuncs = library->GetBuiltinFunctions();
         library->AddMember(setPrototype, PropertyIds::constructor, library->setConstructor);
 
-        library->AddFunctionToLibraryObject(setPrototype, PropertyIds::add, &JavascriptSet::EntryInfo::Add, 1);
+        builtinFuncs[BuiltinFunction::JavascriptSet_Add] = library->AddFunctionToLibraryObject(setPrototype, PropertyIds::add, &JavascriptSet::EntryInfo::Add, 1);
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::clear, &JavascriptSet::EntryInfo::Clear, 0);
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::delete_, &JavascriptSet::EntryInfo::Delete, 1);
         library->AddFunctionToLibraryObject(setPrototype, PropertyIds::forEach, &JavascriptSet::EntryInfo::ForEach, 1);
-        library->AddFunctionToLibraryObject(setPrototype, PropertyIds::has, &JavascriptSet::EntryInfo::Has, 1);
+        builtinFuncs[BuiltinFunction::JavascriptSet_Has] = library->AddFunctionToLibraryObject(setPrototype, PropertyIds::has, &JavascriptSet::EntryInfo::Has, 1);
 
         library->AddAccessorsToLibraryObject(setPrototype, PropertyIds::size, &JavascriptSet::EntryInfo::SizeGetter, nullptr);
 
@@ -6167,7 +6169,7 @@ namespace Js
     JavascriptWeakMap* JavascriptLibrary::CreateWeakMap()
     {
         AssertMsg(weakMapType, "Where's weakMapType?");
-        return RecyclerNewFinalized(this->GetRecycler(), JavascriptWeakMap, weakMapType);
+        return RecyclerNew(this->GetRecycler(), JavascriptWeakMap, weakMapType);
     }
 
     JavascriptWeakSet* JavascriptLibrary::CreateWeakSet()
@@ -4,8 +4,8 @@
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLibraryPch.h"
 
-namespace Js
-{
+using namespace Js;
+
 JavascriptMap::JavascriptMap(DynamicType* type)
     : DynamicObject(type)
 {
@@ -18,9 +18,9 @@ JavascriptMap* JavascriptMap::New(ScriptContext* scriptContext)
     return map;
 }
 
-JavascriptMap::MapDataList::Iterator JavascriptMap::GetIterator()
+JavascriptMap::MapDataTable::Iterator JavascriptMap::GetIterator()
 {
-    return list.GetIterator();
+    return this->table.GetIterator();
 }
 
 Var JavascriptMap::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -51,7 +51,7 @@ Var JavascriptMap::NewInstance(RecyclableObject* function, CallInfo callInfo, ..
     Var iterable = (args.Info.Count > 1) ? args[1] : library->GetUndefined();
 
     // REVIEW: This condition seems impossible?
-    if (mapObject->kind != MapKind::EmptyMap)
+    if (mapObject->table.Count() != 0)
     {
         Assert(UNREACHED);
         JavascriptError::ThrowTypeErrorVar(scriptContext, JSERR_ObjectIsAlreadyInitialized, _u("Map"), _u("Map"));
@@ -188,6 +188,7 @@ Var JavascriptMap::EntryForEach(RecyclableObject* function, CallInfo callInfo, .
 
 Var JavascriptMap::EntryGet(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Map_Get);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -208,10 +209,12 @@ Var JavascriptMap::EntryGet(RecyclableObject* function, CallInfo callInfo, ...)
     }
 
     return scriptContext->GetLibrary()->GetUndefined();
+    JIT_HELPER_END(Map_Get);
 }
 
 Var JavascriptMap::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Map_Has);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -228,10 +231,12 @@ Var JavascriptMap::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
     bool hasValue = map->Has(key);
 
     return scriptContext->GetLibrary()->CreateBoolean(hasValue);
+    JIT_HELPER_END(Map_Has);
 }
 
 Var JavascriptMap::EntrySet(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Map_Set);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -246,15 +251,47 @@ Var JavascriptMap::EntrySet(RecyclableObject* function, CallInfo callInfo, ...)
     Var key = (args.Info.Count > 1) ? args[1] : scriptContext->GetLibrary()->GetUndefined();
     Var value = (args.Info.Count > 2) ? args[2] : scriptContext->GetLibrary()->GetUndefined();
 
-    if (JavascriptNumber::Is(key) && JavascriptNumber::IsNegZero(JavascriptNumber::GetValue(key)))
+    map->Set(key, value);
+
+    return map;
+    JIT_HELPER_END(Map_Set);
+}
+
+Var JavascriptMap::DirectGet(JavascriptMap* map, Var key, ScriptContext* scriptContext)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Map_DirectGet);
+    Var value = nullptr;
+
+    if (map->Get(key, &value))
     {
-        // Normalize -0 to +0
-        key = JavascriptNumber::New(0.0, scriptContext);
+        return CrossSite::MarshalVar(scriptContext, value);
     }
 
-    map->Set(key, value);
+    return scriptContext->GetLibrary()->GetUndefined();
+    JIT_HELPER_END(Map_DirectGet);
+}
+
+Var JavascriptMap::DirectHas(JavascriptMap* map, Var key, ScriptContext* scriptContext)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Map_DirectHas);
+    return scriptContext->GetLibrary()->CreateBoolean(map->Has(key));
+    JIT_HELPER_END(Map_DirectHas);
+}
 
+Var JavascriptMap::DirectSet(JavascriptMap* map, Var key, Var value)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Map_DirectSet);
+    map->Set(key, value);
     return map;
+    JIT_HELPER_END(Map_DirectSet);
+}
+
+hash_t JavascriptMap::GetStringKeyHash(JavascriptString* key)
+{
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(MapOrSet_GetStringKeyHash);
+    // Set tables hash their values the same way
+    return MapDataTable::GetKeyHash(key);
+    JIT_HELPER_END(MapOrSet_GetStringKeyHash);
 }
 
 Var JavascriptMap::EntrySizeGetter(RecyclableObject* function, CallInfo callInfo, ...)
@@ -327,53 +364,7 @@ JavascriptMap::Clear()
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    list.Clear();
-
-    switch (this->kind)
-    {
-    case MapKind::EmptyMap:
-        return;
-    case MapKind::SimpleVarMap:
-        this->u.simpleVarMap->Clear();
-        return;
-    case MapKind::ComplexVarMap:
-        this->u.complexVarMap->Clear();
-        return;
-    default:
-        Assume(UNREACHED);
-    }
-}
-
-template <bool isComplex>
-bool
-JavascriptMap::DeleteFromVarMap(Var value)
-{
-    Assert(this->kind == (isComplex ? MapKind::ComplexVarMap : MapKind::SimpleVarMap));
-
-    MapDataNode * node = nullptr;
-    if (isComplex
-        ? !this->u.complexVarMap->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarMap->TryGetValueAndRemove(value, &node))
-    {
-        return false;
-    }
-
-    this->list.Remove(node);
-    return true;
-}
-
-bool
-JavascriptMap::DeleteFromSimpleVarMap(Var value)
-{
-    Assert(this->kind == MapKind::SimpleVarMap);
-
-    Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<true /* allowLossyConversion */>(value);
-    if (!simpleVar)
-    {
-        return false;
-    }
-
-    return this->DeleteFromVarMap<false /* isComplex */>(simpleVar);
+    this->table.Clear();
 }
 
 bool
@@ -381,19 +372,7 @@ JavascriptMap::Delete(Var key)
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    switch (this->kind)
-    {
-    case MapKind::EmptyMap:
-        return false;
-
-    case MapKind::SimpleVarMap:
-        return this->DeleteFromSimpleVarMap(key);
-    case MapKind::ComplexVarMap:
-        return this->DeleteFromVarMap<true>(key);
-    default:
-        Assume(UNREACHED);
-        return false;
-    }
+    return this->table.Remove(key, this->GetRecycler());
 }
 
 bool
@@ -401,225 +380,57 @@ JavascriptMap::Get(Var key, Var* value)
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    switch (this->kind)
-    {
-    case MapKind::EmptyMap:
-        return false;
-
-    case MapKind::SimpleVarMap:
-    {
-        // First check if the key is in the map
-        MapDataNode* node = nullptr;
-        if (this->u.simpleVarMap->TryGetValue(key, &node))
-        {
-            *value = node->data.Value();
-            return true;
-        }
-        // If the key isn't in the map, check if the canonical value is
-        Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<true /* allowLossyConversion */>(key);
-        // If the simple var is the same as the original key, we know it isn't in the map
-        if (!simpleVar || simpleVar == key)
-        {
-            return false;
-        }
-
-        if (!this->u.simpleVarMap->TryGetValue(simpleVar, &node))
-        {
-            return false;
-        }
-        *value = node->data.Value();
-        return true;
-    }
-    case MapKind::ComplexVarMap:
+    Field(MapDataKeyValuePair)* entry = this->table.Find(key);
+    if (entry == nullptr)
     {
-        MapDataNode * node = nullptr;
-        if (!this->u.complexVarMap->TryGetValue(key, &node))
-        {
-            return false;
-        }
-        *value = node->data.Value();
-        return true;
-    }
-    default:
-        Assume(UNREACHED);
         return false;
     }
-}
 
+    *value = entry->Value();
+    return true;
+}
 
 bool
 JavascriptMap::Has(Var key)
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    switch (this->kind)
-    {
-    case MapKind::EmptyMap:
-        return false;
-
-    case MapKind::SimpleVarMap:
-    {
-        // First check if the key is in the map
-        if (this->u.simpleVarMap->ContainsKey(key))
-        {
-            return true;
-        }
-        // If the key isn't in the map, check if the canonical value is
-        Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<true /* allowLossyConversion */>(key);
-        // If the simple var is the same as the original key, we know it isn't in the map
-        if (!simpleVar || simpleVar == key)
-        {
-            return false;
-        }
-
-        return this->u.simpleVarMap->ContainsKey(simpleVar);
-    }
-    case MapKind::ComplexVarMap:
-        return this->u.complexVarMap->ContainsKey(key);
-
-    default:
-        Assume(UNREACHED);
-        return false;
-    }
+    return this->table.Find(key) != nullptr;
 }
 
 void
-JavascriptMap::PromoteToComplexVarMap()
+JavascriptMap::Set(Var key, Var value)
 {
-    AssertOrFailFast(this->kind == MapKind::SimpleVarMap);
-
-    uint newMapSize = this->u.simpleVarMap->Count() + 1;
-    ComplexVarDataMap* newMap = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler(), newMapSize);
+    JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    JavascriptMap::MapDataList::Iterator iter = this->list.GetIterator();
-    // TODO: we can use a more efficient Iterator, since we know there will be no side effects
-    while (iter.Next())
+    if (JavascriptNumber::Is(key) && JavascriptNumber::IsNegZero(JavascriptNumber::GetValue(key)))
     {
-        newMap->Add(iter.Current().Key(), iter.CurrentNode());
+        // Normalize -0 to +0
+        key = JavascriptNumber::New(0.0, this->GetScriptContext());
     }
 
-    this->kind = MapKind::ComplexVarMap;
-    this->u.complexVarMap = newMap;
-}
-
-void
-JavascriptMap::SetOnEmptyMap(Var key, Var value)
-{
-    Assert(this->kind == MapKind::EmptyMap);
+    // Store numbers in their canonical form so that iteration hands back the same Var for equal keys
     Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<false /* allowLossyConversion */>(key);
     if (simpleVar)
     {
-        SimpleVarDataMap* newSimpleMap = RecyclerNew(this->GetRecycler(), SimpleVarDataMap, this->GetRecycler());
-        MapDataKeyValuePair simplePair(simpleVar, value);
-
-        MapDataNode* node = this->list.Append(simplePair, this->GetRecycler());
-
-        newSimpleMap->Add(simpleVar, node);
-
-        this->u.simpleVarMap = newSimpleMap;
-        this->kind = MapKind::SimpleVarMap;
-        return;
+        key = simpleVar;
     }
 
-    ComplexVarDataMap* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataMap, this->GetRecycler());
-    MapDataKeyValuePair complexPair(key, value);
-
-    MapDataNode* node = this->list.Append(complexPair, this->GetRecycler());
-
-    newComplexSet->Add(key, node);
-
-    this->u.complexVarMap = newComplexSet;
-    this->kind = MapKind::ComplexVarMap;
-}
-
-bool
-JavascriptMap::TrySetOnSimpleVarMap(Var key, Var value)
-{
-    Assert(this->kind == MapKind::SimpleVarMap);
-
-    Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<false /* allowLossyConversion */>(key);
-    if (!simpleVar)
+    Field(MapDataKeyValuePair)* entry = this->table.Find(key);
+    if (entry != nullptr)
     {
-        return false;
-    }
-
-    MapDataNode* node = nullptr;
-    if (this->u.simpleVarMap->TryGetValue(simpleVar, &node))
-    {
-        node->data = MapDataKeyValuePair(simpleVar, value);
-        return true;
-    }
-
-    MapDataKeyValuePair pair(simpleVar, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.simpleVarMap->Add(simpleVar, newNode);
-    return true;
-}
-
-void
-JavascriptMap::SetOnComplexVarMap(Var key, Var value)
-{
-    Assert(this->kind == MapKind::ComplexVarMap);
-
-    MapDataNode* node = nullptr;
-    if (this->u.complexVarMap->TryGetValue(key, &node))
-    {
-        node->data = MapDataKeyValuePair(key, value);
+        *entry = MapDataKeyValuePair(entry->Key(), value);
         return;
     }
 
-    MapDataKeyValuePair pair(key, value);
-    MapDataNode* newNode = this->list.Append(pair, this->GetRecycler());
-    this->u.complexVarMap->Add(key, newNode);
-}
-
-void
-JavascriptMap::Set(Var key, Var value)
-{
-    JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-
-    switch (this->kind)
-    {
-    case MapKind::EmptyMap:
-        this->SetOnEmptyMap(key, value);
-        return;
-
-    case MapKind::SimpleVarMap:
-        if (this->TrySetOnSimpleVarMap(key, value))
-        {
-            return;
-        }
-        this->PromoteToComplexVarMap();
-        return this->Set(key, value);
-
-    case MapKind::ComplexVarMap:
-        this->SetOnComplexVarMap(key, value);
-        return;
-
-    default:
-        Assume(UNREACHED);
-    }
+    this->table.Add(MapDataKeyValuePair(key, value), this->GetRecycler());
 }
 
 int JavascriptMap::Size()
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-    switch (this->kind)
-    {
-    case MapKind::EmptyMap:
-        return 0;
-
-    case MapKind::SimpleVarMap:
-        return this->u.simpleVarMap->Count();
-
-    case MapKind::ComplexVarMap:
-        return this->u.complexVarMap->Count();
-
-    default:
-        Assume(UNREACHED);
-        return 0;
-    }
+    return this->table.Count();
 }
 
 BOOL JavascriptMap::GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext)
@@ -685,4 +496,3 @@ JavascriptMap* JavascriptMap::CreateForSnapshotRestore(ScriptContext* ctx)
     return res;
 }
 #endif
-}
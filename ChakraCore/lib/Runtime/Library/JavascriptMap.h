@@ -10,51 +10,14 @@ namespace Js
     {
     public:
         typedef JsUtil::KeyValuePair<Field(Var), Field(Var)> MapDataKeyValuePair;
-        typedef MapOrSetDataNode<MapDataKeyValuePair> MapDataNode;
-        typedef MapOrSetDataList<MapDataKeyValuePair> MapDataList;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler> SimpleVarDataMap;
-        typedef JsUtil::BaseDictionary<Var, MapDataNode*, Recycler, PowerOf2SizePolicy, SameValueZeroComparer> ComplexVarDataMap;
+        typedef MapOrSetDataTable<MapDataKeyValuePair> MapDataTable;
 
     private:
-        enum class MapKind : uint8
-        {
-            // An EmptyMap is a map containing no elements
-            EmptyMap,
-            // A SimpleVarMap is a map containing only Vars which are comparable by pointer, and don't require
-            // value comparison
-            //
-            // Addition of a Var that is not comparable by pointer value causes the set to be promoted to a ComplexVarSet
-            SimpleVarMap,
-            // A ComplexVarMap is a map containing Vars for which we must inspect the values to do a comparison
-            // This includes Strings and (sometimes) JavascriptNumbers
-            ComplexVarMap
-        };
-
-        Field(MapDataList) list;
-
-        union MapUnion
-        {
-            Field(SimpleVarDataMap*) simpleVarMap;
-            Field(ComplexVarDataMap*) complexVarMap;
-            MapUnion() {}
-        };
-
-        Field(MapUnion) u;
+        Field(MapDataTable) table;
 
-        Field(MapKind) kind = MapKind::EmptyMap;
-
-        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptMap, DynamicObject, list);
+        DEFINE_VTABLE_CTOR_MEMBER_INIT(JavascriptMap, DynamicObject, table);
         DEFINE_MARSHAL_OBJECT_TO_SCRIPT_CONTEXT(JavascriptMap);
 
-        template <bool isComplex>
-        bool DeleteFromVarMap(Var value);
-        bool DeleteFromSimpleVarMap(Var value);
-
-        void SetOnEmptyMap(Var key, Var value);
-        bool TrySetOnSimpleVarMap(Var key, Var value);
-        void SetOnComplexVarMap(Var key, Var value);
-
-        void PromoteToComplexVarMap();
     public:
         JavascriptMap(DynamicType* type);
 
@@ -71,7 +34,7 @@ namespace Js
 
         int Size();
 
-        MapDataList::Iterator GetIterator();
+        MapDataTable::Iterator GetIterator();
 
         virtual BOOL GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext) override;
 
@@ -104,6 +67,16 @@ namespace Js
         static Var EntryValues(RecyclableObject* function, CallInfo callInfo, ...);
         static Var EntryGetterSymbolSpecies(RecyclableObject* function, CallInfo callInfo, ...);
 
+        // Called from jitted code once the receiver is known to be a Map
+        static Var DirectGet(JavascriptMap* map, Var key, ScriptContext* scriptContext);
+        static Var DirectHas(JavascriptMap* map, Var key, ScriptContext* scriptContext);
+        static Var DirectSet(JavascriptMap* map, Var key, Var value);
+
+        // Hash of a string key, for jitted code that probes a Map or Set table inline
+        static hash_t GetStringKeyHash(JavascriptString* key);
+
+        static uint32 GetOffsetOfTable() { return offsetof(JavascriptMap, table); }
+
 #if ENABLE_TTD
     public:
         virtual void MarkVisitKindSpecificPtrs(TTD::SnapshotExtractor* extractor) override;
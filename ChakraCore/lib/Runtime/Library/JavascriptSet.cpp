@@ -4,8 +4,8 @@
 //-------------------------------------------------------------------------------------------------------
 #include "RuntimeLibraryPch.h"
 
-namespace Js
-{
+using namespace Js;
+
 JavascriptSet::JavascriptSet(DynamicType* type)
     : DynamicObject(type)
 {
@@ -18,9 +18,9 @@ JavascriptSet* JavascriptSet::New(ScriptContext* scriptContext)
     return set;
 }
 
-JavascriptSet::SetDataList::Iterator JavascriptSet::GetIterator()
+JavascriptSet::SetDataTable::Iterator JavascriptSet::GetIterator()
 {
-    return this->list.GetIterator();
+    return this->table.GetIterator();
 }
 
 Var JavascriptSet::NewInstance(RecyclableObject* function, CallInfo callInfo, ...)
@@ -51,7 +51,7 @@ Var JavascriptSet::NewInstance(RecyclableObject* function, CallInfo callInfo, ..
     Var iterable = (args.Info.Count > 1) ? args[1] : library->GetUndefined();
 
     // REVIEW: This condition seems impossible?
-    if (setObject->kind != SetKind::EmptySet)
+    if (setObject->table.Count() != 0)
     {
         Assert(UNREACHED);
         JavascriptError::ThrowTypeErrorVar(scriptContext, JSERR_ObjectIsAlreadyInitialized, _u("Set"), _u("Set"));
@@ -89,6 +89,7 @@ Var JavascriptSet::NewInstance(RecyclableObject* function, CallInfo callInfo, ..
 
 Var JavascriptSet::EntryAdd(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Set_Add);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -102,15 +103,10 @@ Var JavascriptSet::EntryAdd(RecyclableObject* function, CallInfo callInfo, ...)
 
     Var value = (args.Info.Count > 1) ? args[1] : scriptContext->GetLibrary()->GetUndefined();
 
-    if (JavascriptNumber::Is(value) && JavascriptNumber::IsNegZero(JavascriptNumber::GetValue(value)))
-    {
-        // Normalize -0 to +0
-        value = JavascriptNumber::New(0.0, scriptContext);
-    }
-
     set->Add(value);
 
     return set;
+    JIT_HELPER_END(Set_Add);
 }
 
 Var JavascriptSet::EntryClear(RecyclableObject* function, CallInfo callInfo, ...)
@@ -191,6 +187,7 @@ Var JavascriptSet::EntryForEach(RecyclableObject* function, CallInfo callInfo, .
 
 Var JavascriptSet::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
 {
+    JIT_HELPER_REENTRANT_HEADER(Set_Has);
     PROBE_STACK(function->GetScriptContext(), Js::Constants::MinStackDefault);
 
     ARGUMENTS(args, callInfo);
@@ -207,6 +204,7 @@ Var JavascriptSet::EntryHas(RecyclableObject* function, CallInfo callInfo, ...)
     bool hasValue = set->Has(value);
 
     return scriptContext->GetLibrary()->CreateBoolean(hasValue);
+    JIT_HELPER_END(Set_Has);
 }
 
 Var JavascriptSet::EntrySizeGetter(RecyclableObject* function, CallInfo callInfo, ...)
@@ -268,351 +266,67 @@ Var JavascriptSet::EntryGetterSymbolSpecies(RecyclableObject* function, CallInfo
     return args[0];
 }
 
-template <typename T>
-T*
-JavascriptSet::CreateVarSetFromList(uint initialCapacity)
+Var JavascriptSet::DirectAdd(JavascriptSet* set, Var value)
 {
-    T* varSet = RecyclerNew(this->GetRecycler(), T, this->GetRecycler(), initialCapacity);
-
-    JavascriptSet::SetDataList::Iterator iter = this->list.GetIterator();
-    // TODO: we can use a more efficient Iterator, since we know there will be no side effects
-    while (iter.Next())
-    {
-        varSet->Add(iter.Current(), iter.CurrentNode());
-    }
-    return varSet;
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Set_DirectAdd);
+    set->Add(value);
+    return set;
+    JIT_HELPER_END(Set_DirectAdd);
 }
 
-void
-JavascriptSet::PromoteToSimpleVarSet()
+Var JavascriptSet::DirectHas(JavascriptSet* set, Var value, ScriptContext* scriptContext)
 {
-    AssertOrFailFast(this->kind == SetKind::IntSet);
-    SimpleVarDataSet* newSet = this->CreateVarSetFromList<SimpleVarDataSet>(this->u.intSet->Count() + 1);
-
-    this->kind = SetKind::SimpleVarSet;
-    this->u.simpleVarSet = newSet;
+    JIT_HELPER_NOT_REENTRANT_NOLOCK_HEADER(Set_DirectHas);
+    return scriptContext->GetLibrary()->CreateBoolean(set->Has(value));
+    JIT_HELPER_END(Set_DirectHas);
 }
 
 void
-JavascriptSet::PromoteToComplexVarSet()
+JavascriptSet::Add(Var value)
 {
-    uint setSize = 0;
-    if (this->kind == SetKind::IntSet)
-    {
-        setSize = this->u.intSet->Count();
-    }
-    else
-    {
-        AssertOrFailFast(this->kind == SetKind::SimpleVarSet);
-        setSize = this->u.simpleVarSet->Count();
-    }
-    ComplexVarDataSet* newSet = this->CreateVarSetFromList<ComplexVarDataSet>(setSize + 1);
-
-    this->kind = SetKind::ComplexVarSet;
-    this->u.complexVarSet = newSet;
-}
+    JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
 
-void
-JavascriptSet::AddToEmptySet(Var value)
-{
-    Assert(this->kind == SetKind::EmptySet);
-    // We cannot store an int with value -1 inside of a bit vector
-    Var taggedInt = JavascriptConversion::TryCanonicalizeAsTaggedInt<false /* allowNegOne */, false /* allowLossyConversion */>(value);
-    if (taggedInt)
+    if (JavascriptNumber::Is(value) && JavascriptNumber::IsNegZero(JavascriptNumber::GetValue(value)))
     {
-        int32 intVal = TaggedInt::ToInt32(taggedInt);
-
-        BVSparse<Recycler>* newIntSet = RecyclerNew(this->GetRecycler(), BVSparse<Recycler>, this->GetRecycler());
-        newIntSet->Set(intVal);
-
-        this->list.Append(taggedInt, this->GetRecycler());
-
-        this->u.intSet = newIntSet;
-        this->kind = SetKind::IntSet;
-        return;
+        // Normalize -0 to +0
+        value = JavascriptNumber::New(0.0, this->GetScriptContext());
     }
 
+    // Store numbers in their canonical form so that iteration hands back the same Var for equal values
     Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<false /* allowLossyConversion */>(value);
     if (simpleVar)
     {
-        SimpleVarDataSet* newSimpleSet = RecyclerNew(this->GetRecycler(), SimpleVarDataSet, this->GetRecycler());
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
-
-        newSimpleSet->Add(simpleVar, node);
-
-        this->u.simpleVarSet = newSimpleSet;
-        this->kind = SetKind::SimpleVarSet;
-        return;
+        value = simpleVar;
     }
 
-    ComplexVarDataSet* newComplexSet = RecyclerNew(this->GetRecycler(), ComplexVarDataSet, this->GetRecycler());
-    SetDataNode* node = this->list.Append(value, this->GetRecycler());
-
-    newComplexSet->Add(value, node);
-
-    this->u.complexVarSet = newComplexSet;
-    this->kind = SetKind::ComplexVarSet;
-}
-
-bool
-JavascriptSet::TryAddToIntSet(Var value)
-{
-    Assert(this->kind == SetKind::IntSet);
-    Var taggedInt = JavascriptConversion::TryCanonicalizeAsTaggedInt<false /* allowNegOne */, false /* allowLossyConversion */>(value);
-    if (!taggedInt)
-    {
-        return false;
-    }
-
-    int32 intVal = TaggedInt::ToInt32(taggedInt);
-    if (!this->u.intSet->TestAndSet(intVal))
+    if (this->table.Find(value) == nullptr)
     {
-        this->list.Append(taggedInt, this->GetRecycler());
-    }
-    return true;
-}
-
-bool
-JavascriptSet::TryAddToSimpleVarSet(Var value)
-{
-    Assert(this->kind == SetKind::SimpleVarSet);
-    Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<false /* allowLossyConversion */>(value);
-    if (!simpleVar)
-    {
-        return false;
-    }
-
-    if (!this->u.simpleVarSet->ContainsKey(simpleVar))
-    {
-        SetDataNode* node = this->list.Append(simpleVar, this->GetRecycler());
-        this->u.simpleVarSet->Add(simpleVar, node);
-    }
-
-    return true;
-}
-
-void
-JavascriptSet::AddToComplexVarSet(Var value)
-{
-    Assert(this->kind == SetKind::ComplexVarSet);
-    if (!this->u.complexVarSet->ContainsKey(value))
-    {
-        SetDataNode* node = this->list.Append(value, this->GetRecycler());
-        this->u.complexVarSet->Add(value, node);
-    }
-}
-
-void
-JavascriptSet::Add(Var value)
-{
-    JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-    switch (this->kind)
-    {
-    case SetKind::EmptySet:
-    {
-        this->AddToEmptySet(value);
-        return;
-    }
-
-    case SetKind::IntSet:
-    {
-        if (this->TryAddToIntSet(value))
-        {
-            return;
-        }
-
-        Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<false /* allowLossyConversion */>(value);
-        if (simpleVar)
-        {
-            this->PromoteToSimpleVarSet();
-            this->Add(simpleVar);
-            return;
-        }
-
-        this->PromoteToComplexVarSet();
-        this->Add(value);
-        return;
-    }
-
-    case SetKind::SimpleVarSet:
-        if (this->TryAddToSimpleVarSet(value))
-        {
-            return;
-        }
-
-        this->PromoteToComplexVarSet();
-        this->Add(value);
-        return;
-
-    case SetKind::ComplexVarSet:
-        this->AddToComplexVarSet(value);
-        return;
-
-    default:
-        Assume(UNREACHED);
+        this->table.Add(value, this->GetRecycler());
     }
 }
 
 void JavascriptSet::Clear()
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-    this->list.Clear();
-    switch (this->kind)
-    {
-    case SetKind::EmptySet:
-        return;
-    case SetKind::IntSet:
-        this->u.intSet->ClearAll();
-        return;
-    case SetKind::SimpleVarSet:
-        this->u.simpleVarSet->Clear();
-        return;
-    case SetKind::ComplexVarSet:
-        this->u.complexVarSet->Clear();
-        return;
-    default:
-        Assume(UNREACHED);
-    }
-}
-
-bool
-JavascriptSet::IsInIntSet(Var value)
-{
-    Assert(this->kind == SetKind::IntSet);
-    Var taggedInt = JavascriptConversion::TryCanonicalizeAsTaggedInt<false /* allowNegOne */, true /* allowLossyConversion */>(value);
-    if (!taggedInt)
-    {
-        return false;
-    }
-    int32 intVal = TaggedInt::ToInt32(taggedInt);
-    return this->u.intSet->Test(intVal);
-}
-
-template <bool isComplex>
-bool
-JavascriptSet::DeleteFromVarSet(Var value)
-{
-    Assert(this->kind == (isComplex ? SetKind::ComplexVarSet : SetKind::SimpleVarSet));
-    SetDataNode * node = nullptr;
-    if (isComplex
-        ? !this->u.complexVarSet->TryGetValueAndRemove(value, &node)
-        : !this->u.simpleVarSet->TryGetValueAndRemove(value, &node))
-    {
-        return false;
-    }
-
-    this->list.Remove(node);
-    return true;
-}
-
-bool
-JavascriptSet::DeleteFromSimpleVarSet(Var value)
-{
-    Assert(this->kind == SetKind::SimpleVarSet);
-    Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<true /* allowLossyConversion */>(value);
-    if (!simpleVar)
-    {
-        return false;
-    }
-
-    return this->DeleteFromVarSet<false>(simpleVar);
+    this->table.Clear();
 }
 
 bool JavascriptSet::Delete(Var value)
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-    switch (this->kind)
-    {
-    case SetKind::EmptySet:
-        return false;
-
-    case SetKind::IntSet:
-        if (!IsInIntSet(value))
-        {
-            return false;
-        }
-        // We don't have the list node pointer readily available, so deletion from int sets would require walking the list
-        // Because of this, let's just promote to a var set
-        //
-        // If this promotion becomes an issue, we can consider options to improve this, e.g. deferring until an iterator is requested
-        this->PromoteToSimpleVarSet();
-        return this->Delete(value);
-
-    case SetKind::SimpleVarSet:
-        return this->DeleteFromSimpleVarSet(value);
-
-    case SetKind::ComplexVarSet:
-        return this->DeleteFromVarSet<true /* isComplex */>(value);
-
-    default:
-        Assume(UNREACHED);
-        return false;
-    }
+    return this->table.Remove(value, this->GetRecycler());
 }
 
 bool JavascriptSet::Has(Var value)
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-    switch (this->kind)
-    {
-    case SetKind::EmptySet:
-        return false;
-
-    case SetKind::IntSet:
-    {
-        Var taggedInt = JavascriptConversion::TryCanonicalizeAsTaggedInt<false /* allowNegOne */, true /* allowLossyConversion */ >(value);
-        if (!taggedInt)
-        {
-            return false;
-        }
-        int32 intVal = TaggedInt::ToInt32(taggedInt);
-        return this->u.intSet->Test(intVal);
-    }
-
-    case SetKind::SimpleVarSet:
-    {
-        // First check if the value is in the set
-        if (this->u.simpleVarSet->ContainsKey(value))
-        {
-            return true;
-        }
-        // If the value isn't in the set, check if the canonical value is
-        Var simpleVar = JavascriptConversion::TryCanonicalizeAsSimpleVar<true /* allowLossyConversion */>(value);
-        // If the simple value is the same as the original value, we know it isn't in the set
-        if (!simpleVar || simpleVar == value)
-        {
-            return false;
-        }
-
-        return this->u.simpleVarSet->ContainsKey(simpleVar);
-    }
-
-    case SetKind::ComplexVarSet:
-        return this->u.complexVarSet->ContainsKey(value);
-
-    default:
-        Assume(UNREACHED);
-        return false;
-    }
+    return this->table.Find(value) != nullptr;
 }
 
 int JavascriptSet::Size()
 {
     JS_REENTRANCY_LOCK(jsReentLock, this->GetScriptContext()->GetThreadContext());
-    switch (this->kind)
-    {
-    case SetKind::EmptySet:
-        return 0;
-    case SetKind::IntSet:
-        return this->u.intSet->Count();
-    case SetKind::SimpleVarSet:
-        return this->u.simpleVarSet->Count();
-    case SetKind::ComplexVarSet:
-        return this->u.complexVarSet->Count();
-    default:
-        Assume(UNREACHED);
-        return 0;
-    }
+    return this->table.Count();
 }
 
 BOOL JavascriptSet::GetDiagTypeString(StringBuilder<ArenaAllocator>* stringBuilder, ScriptContext* requestContext)
@@ -667,4 +381,3 @@ JavascriptSet* JavascriptSet::CreateForSnapshotRestore(ScriptContext* ctx)
     return res;
 }
 #endif
-}
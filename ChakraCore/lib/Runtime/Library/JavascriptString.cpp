@@ -8,6 +8,7 @@
 #include "DataStructures/BigUInt.h"
 #include "Library/EngineInterfaceObject.h"
 #include "Library/IntlEngineInterfaceExtensionObject.h"
+#include "Language/StringSearchAccel.h"
 
 #if ENABLE_NATIVE_CODEGEN
 #include "../Backend/JITRecyclableObject.h"
@@ -340,6 +341,16 @@ namespace Js
     {
         AssertMsg( IsValidIndexValue(index), "Must specify valid character");
 
+        if (!this->IsFinalized())
+        {
+            // Don't widen a one-byte string just to read a character out of it
+            OneByteString* oneByteString = JavascriptOperators::TryFromVar<OneByteString>(this);
+            if (oneByteString)
+            {
+                return oneByteString->GetOneByteItem(index);
+            }
+        }
+
         const char16 *str = this->GetString();
         return str[index];
     }
@@ -569,6 +580,18 @@ namespace Js
             return Concat_OneEmpty(pstLeft, pstRight);
         }
 
+        if(pstLeft->GetLength() + pstRight->GetLength() <= OneByteString::MaxFlatCopyLength)
+        {
+            // Keep short concatenations of one-byte strings flat and one-byte instead of building a tree
+            // that would widen both sides when it is flattened.
+            OneByteString* oneByteLeft = JavascriptOperators::TryFromVar<OneByteString>(pstLeft);
+            OneByteString* oneByteRight = oneByteLeft ? JavascriptOperators::TryFromVar<OneByteString>(pstRight) : nullptr;
+            if(oneByteRight)
+            {
+                return OneByteString::Concat(oneByteLeft, oneByteRight);
+            }
+        }
+
         if(pstLeft->GetLength() != 1 || pstRight->GetLength() != 1)
         {
 #ifdef PROFILE_STRINGS
@@ -1145,6 +1168,22 @@ namespace Js
         {
             const char16* searchStr = searchString->GetString();
             const char16* inputStr = pThis->GetString();
+#if STRING_SEARCH_ACCEL_AVAILABLE
+            // Short needles, and needles the ASCII jump table can't describe, use the anchored SIMD search
+            JmpTable jmpTable;
+            if (searchLen < (int)StringSearchAccel::MaxAnchoredNeedleLength || !BuildLastCharForwardBoyerMooreTable(jmpTable, searchStr, searchLen))
+            {
+                result = StringSearchAccel::IndexOf(inputStr + position, len - position, searchStr, searchLen);
+                if (result != -1)
+                {
+                    result += position;
+                }
+            }
+            else
+            {
+                result = IndexOfUsingJmpTable(jmpTable, inputStr, len, searchStr, searchLen, position);
+            }
+#else
             if (searchLen == 1)
             {
                 int i = position;
@@ -1167,6 +1206,7 @@ namespace Js
                     result = IndexOfUsingJmpTable(jmpTable, inputStr, len, searchStr, searchLen, position);
                 }
             }
+#endif
         }
         return result;
     }
@@ -1218,7 +1258,6 @@ namespace Js
         const charcount_t inputLen = pThis->GetLength();
         const charcount_t searchLen = searchArg->GetLength();
         charcount_t position = inputLen;
-        const char16* const searchLowerBound = inputStr;
 
         // Determine if the main string can't contain the search string by length
         if (searchLen > inputLen)
@@ -1246,7 +1285,6 @@ namespace Js
             // No point searching beyond the possible end point.
             position = inputLen - searchLen;
         }
-        const char16* const searchUpperBound = searchLowerBound + min(position, inputLen - 1);
 
         // 8. Let searchLen be the number of elements in searchStr.
         // 9. Return the largest possible nonnegative integer k not larger than start such that k + searchLen is
@@ -1261,7 +1299,22 @@ namespace Js
         {
             return JavascriptNumber::ToVar(position, scriptContext);
         }
-        else if (searchLen == 1)
+
+#if STRING_SEARCH_ACCEL_AVAILABLE
+        JmpTable jmpTable;
+        if (searchLen < StringSearchAccel::MaxAnchoredNeedleLength || !BuildFirstCharBackwardBoyerMooreTable(jmpTable, searchStr, searchLen))
+        {
+            int result = StringSearchAccel::LastIndexOf(inputStr, position, searchStr, searchLen);
+            return JavascriptNumber::ToVar(result, scriptContext);
+        }
+
+        int result = LastIndexOfUsingJmpTable(jmpTable, inputStr, inputLen, searchStr, searchLen, position);
+        return JavascriptNumber::ToVar(result, scriptContext);
+#else
+        const char16* const searchLowerBound = inputStr;
+        const char16* const searchUpperBound = searchLowerBound + min(position, inputLen - 1);
+
+        if (searchLen == 1)
         {
             char16 const * current = searchUpperBound;
             while (*current != *searchStr)
@@ -1299,6 +1352,7 @@ namespace Js
             --currentPos;
         }
         return JavascriptNumber::ToVar(-1, scriptContext);
+#endif
     }
 
     // Performs common ES spec steps for getting this argument in string form:
@@ -2101,6 +2155,25 @@ namespace Js
 
     Var JavascriptString::SubstringCore(JavascriptString* pThis, int idxStart, int span, ScriptContext* scriptContext)
     {
+        if (!pThis->IsFinalized() && span > 0 && (charcount_t)span < pThis->GetLength())
+        {
+            // Only flatten the part of a concat tree that the substring falls in. That part keeps its flattened buffer,
+            // so later substrings from the same region don't copy it again; a range inside a single leaf copies nothing.
+            charcount_t start = (charcount_t)idxStart;
+            pThis = ConcatStringBase::GetSubtreeContaining(pThis, &start, (charcount_t)span);
+            idxStart = (int)start;
+        }
+
+        if (!pThis->IsFinalized() && (charcount_t)span <= OneByteString::MaxFlatCopyLength)
+        {
+            // A SubString needs the UTF-16 buffer of its parent; copying a short one-byte slice is cheaper than widening
+            OneByteString* oneByteString = JavascriptOperators::TryFromVar<OneByteString>(pThis);
+            if (oneByteString)
+            {
+                return OneByteString::Substring(oneByteString, idxStart, span);
+            }
+        }
+
         return SubString::New(pThis, idxStart, span);
     }
 
@@ -3165,6 +3238,16 @@ namespace Js
 
     bool JavascriptString::Equals(JavascriptString* aLeft, JavascriptString* aRight)
     {
+        if (!aLeft->IsFinalized() && !aRight->IsFinalized())
+        {
+            OneByteString* oneByteLeft = JavascriptOperators::TryFromVar<OneByteString>(aLeft);
+            OneByteString* oneByteRight = oneByteLeft ? JavascriptOperators::TryFromVar<OneByteString>(aRight) : nullptr;
+            if (oneByteRight)
+            {
+                return oneByteLeft->OneByteEquals(oneByteRight);
+            }
+        }
+
         return JavascriptStringHelpers<JavascriptString>::Equals(aLeft, aRight);
     }
 
@@ -3599,8 +3682,6 @@ namespace Js
 
     uint JavascriptString::strstr(JavascriptString *string, JavascriptString *substring, bool useBoyerMoore, uint start)
     {
-        uint i;
-
         const char16 *stringOrig = string->GetString();
         uint stringLenOrig = string->GetLength();
         const char16 *stringSz = stringOrig + start;
@@ -3608,7 +3689,12 @@ namespace Js
         uint stringLen = stringLenOrig - start;
         uint substringLen = substring->GetLength();
 
+#if STRING_SEARCH_ACCEL_AVAILABLE
+        // The anchored SIMD search beats building a jump table for anything but long needles
+        if (useBoyerMoore && substringLen >= StringSearchAccel::MaxAnchoredNeedleLength)
+#else
         if (useBoyerMoore && substringLen > 2)
+#endif
         {
             JmpTable jmpTable;
             bool fAsciiJumpTable = BuildLastCharForwardBoyerMooreTable(jmpTable, substringSz, substringLen);
@@ -3633,7 +3719,11 @@ namespace Js
             {
                 return 0;
             }
-            for (i = 0; i <= stringLen - substringLen; i++)
+#if STRING_SEARCH_ACCEL_AVAILABLE
+            int result = StringSearchAccel::IndexOf(stringSz, stringLen, substringSz, substringLen);
+            return result == -1 ? (uint)-1 : (uint)result + start;
+#else
+            for (uint i = 0; i <= stringLen - substringLen; i++)
             {
                 // Quick check for first character.
                 if (stringSz[i] == substringSz[0])
@@ -3644,6 +3734,7 @@ namespace Js
                     }
                 }
             }
+#endif
         }
 
         return (uint)-1;
@@ -35,6 +35,7 @@ namespace Js
         friend Lowerer;
         friend LowererMD;
         friend bool IsValidCharCount(size_t);
+        friend class StringDeduplicator;
 
         JavascriptString() = delete;
         JavascriptString(JavascriptString&) = delete;
@@ -0,0 +1,414 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// This is an insertion ordered hash table for the entries of ES6 Map and Set
+// objects, following the deterministic hash table design. Entries are kept in
+// a dense array (the store) in the order they were added. Removing an entry
+// only clears its key, leaving a hole that is squeezed out the next time the
+// store is rebuilt, which happens when the store fills up or becomes mostly
+// empty.
+//
+// Small stores are searched by scanning their entries. Larger stores also get
+// an open addressing (linear probing) index from hash code to entry position
+// and an array of entry hash codes; both are leaf allocations so that the only
+// memory the GC has to scan is the entry array itself.
+//
+// Iterators stay valid no matter what modifications are made during iteration.
+// A store is never changed once it has been replaced: a rebuild links the old
+// store to its replacement through 'next', and a clear marks the old store as
+// cleared. An iterator that finds its store has been replaced follows these
+// links and translates its position, so it neither skips nor revisits entries.
+// Keys and hash codes follow SameValueZero, so callers need not canonicalize
+// keys before looking them up. Numbers with an int32 value get a plain integer
+// hash so that jitted code can probe the index for a tagged int key inline.
+
+namespace Js
+{
+    template <typename TData>
+    class MapOrSetDataTable
+    {
+    private:
+        static const uint32 InitialCapacity = 4;
+        static const uint32 MaxLinearCapacity = 8;
+
+        class Store
+        {
+        public:
+            Field(Store*) next;
+            Field(uint32*) buckets;
+            Field(hash_t*) hashes;
+            Field(uint32) capacity;
+            Field(uint32) bucketCount;
+            Field(uint32) used;
+            Field(uint32) liveCount;
+            Field(bool) isCleared;
+            Field(TData) entries[];
+
+            Store(uint32 capacity, uint32 bucketCount) :
+                next(nullptr), buckets(nullptr), hashes(nullptr), capacity(capacity), bucketCount(bucketCount),
+                used(0), liveCount(0), isCleared(false)
+            {
+            }
+
+            static Store* New(Recycler* recycler, uint32 capacity)
+            {
+                Assert(::Math::IsPow2(capacity));
+                uint32 bucketCount = capacity > MaxLinearCapacity ? UInt32Math::Mul<2>(capacity) : 0;
+
+                Store* store = RecyclerNewPlusZ(recycler, AllocSizeMath::Mul(sizeof(Field(TData)), capacity), Store, capacity, bucketCount);
+                if (bucketCount != 0)
+                {
+                    store->buckets = RecyclerNewArrayLeafZ(recycler, uint32, bucketCount);
+                    store->hashes = RecyclerNewArrayLeaf(recycler, hash_t, capacity);
+                }
+                return store;
+            }
+
+            uint32 CountLiveBefore(uint32 index) const
+            {
+                if (liveCount == used)
+                {
+                    return index;
+                }
+
+                uint32 count = 0;
+                for (uint32 i = 0; i < index; i++)
+                {
+                    if (KeyOf(entries[i]) != nullptr)
+                    {
+                        count++;
+                    }
+                }
+                return count;
+            }
+        };
+
+        Field(Store*) store;
+
+        static Var KeyOf(Var data)
+        {
+            return data;
+        }
+
+        template <typename TKey, typename TValue>
+        static Var KeyOf(const JsUtil::KeyValuePair<TKey, TValue>& data)
+        {
+            return data.Key();
+        }
+
+        static void ClearEntry(Field(Var)& entry)
+        {
+            entry = nullptr;
+        }
+
+        template <typename TKey, typename TValue>
+        static void ClearEntry(JsUtil::KeyValuePair<TKey, TValue>& entry)
+        {
+            entry = JsUtil::KeyValuePair<TKey, TValue>(nullptr, nullptr);
+        }
+
+        static bool TryGetInt32Key(Var key, int32* value)
+        {
+            switch (JavascriptOperators::GetTypeId(key))
+            {
+            case TypeIds_Integer:
+                *value = TaggedInt::ToInt32(key);
+                return true;
+
+            case TypeIds_Number:
+                // -0 is SameValueZero equal to +0, so it has to hash like it
+                return JavascriptNumber::TryGetInt32Value<true /* acceptNegZero */>(JavascriptNumber::GetValue(key), value);
+
+            case TypeIds_Int64Number:
+                {
+                    __int64 v = VarTo<JavascriptInt64Number>(key)->GetValue();
+                    *value = (int32)v;
+                    return v == *value;
+                }
+
+            case TypeIds_UInt64Number:
+                {
+                    unsigned __int64 v = VarTo<JavascriptUInt64Number>(key)->GetValue();
+                    *value = (int32)v;
+                    return v <= INT32_MAX;
+                }
+
+            default:
+                return false;
+            }
+        }
+
+        static hash_t HashKey(Var key)
+        {
+            int32 intValue;
+            if (TryGetInt32Key(key, &intValue))
+            {
+                return HashInt32Key(intValue);
+            }
+
+            // Other number keys hash from their double representation, which leaves the
+            // low bits of small integers zero, so mix the high bits down before the
+            // hash code is masked to a bucket.
+            hash_t hash = SameValueZeroComparer<Var>::GetHashCode(key);
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6B;
+            hash ^= hash >> 13;
+            return hash;
+        }
+
+        static bool KeysEqual(Var x, Var y)
+        {
+            return x == y || SameValueZeroComparer<Var>::Equals(x, y);
+        }
+
+        static void InsertBucket(Store* store, hash_t hash, uint32 index)
+        {
+            uint32 mask = store->bucketCount - 1;
+            uint32 bucket = hash & mask;
+            while (store->buckets[bucket] != EmptyBucket)
+            {
+                bucket = (bucket + 1) & mask;
+            }
+            store->buckets[bucket] = index + 1;
+        }
+
+        static bool TryFindIndex(Store* store, Var key, uint32* index, uint32* bucket)
+        {
+            if (store->buckets == nullptr)
+            {
+                for (uint32 i = 0; i < store->used; i++)
+                {
+                    Var entryKey = KeyOf(store->entries[i]);
+                    if (entryKey != nullptr && KeysEqual(entryKey, key))
+                    {
+                        *index = i;
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // The index is at most half full, so probing always reaches an empty bucket.
+            hash_t hash = HashKey(key);
+            uint32 mask = store->bucketCount - 1;
+            for (uint32 b = hash & mask; store->buckets[b] != EmptyBucket; b = (b + 1) & mask)
+            {
+                uint32 value = store->buckets[b];
+                if (value != RemovedBucket && store->hashes[value - 1] == hash && KeysEqual(KeyOf(store->entries[value - 1]), key))
+                {
+                    *index = value - 1;
+                    if (bucket != nullptr)
+                    {
+                        *bucket = b;
+                    }
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void Rebuild(uint32 newCapacity, Recycler* recycler)
+        {
+            Store* oldStore = this->store;
+            Store* newStore = Store::New(recycler, newCapacity);
+            Assert(oldStore->liveCount <= newCapacity);
+
+            for (uint32 i = 0; i < oldStore->used; i++)
+            {
+                Var key = KeyOf(oldStore->entries[i]);
+                if (key == nullptr)
+                {
+                    continue;
+                }
+
+                uint32 index = newStore->used++;
+                newStore->entries[index] = oldStore->entries[i];
+                if (newStore->buckets != nullptr)
+                {
+                    hash_t hash = oldStore->hashes != nullptr ? oldStore->hashes[i] : HashKey(key);
+                    newStore->hashes[index] = hash;
+                    InsertBucket(newStore, hash, index);
+                }
+            }
+            newStore->liveCount = newStore->used;
+
+            oldStore->next = newStore;
+            this->store = newStore;
+        }
+
+    public:
+        // Index buckets hold an entry position plus one.
+        static const uint32 EmptyBucket = 0;
+        static const uint32 RemovedBucket = UINT32_MAX;
+
+        MapOrSetDataTable(VirtualTableInfoCtorEnum) {};
+        MapOrSetDataTable() : store(nullptr) { }
+
+        class Iterator
+        {
+            Field(MapOrSetDataTable<TData>*) table;
+            Field(Store*) store;
+            // Position of the next entry to look at in store
+            Field(uint32) index;
+        public:
+            Iterator() : table(nullptr), store(nullptr), index(0) { }
+            Iterator(MapOrSetDataTable<TData>* table) : table(table), store(nullptr), index(0) { }
+
+            bool Next()
+            {
+                if (table == nullptr)
+                {
+                    return false;
+                }
+
+                if (store == nullptr)
+                {
+                    store = table->store;
+                }
+
+                // Catch up with any rebuilds or clears since the last call
+                while (store != nullptr)
+                {
+                    if (store->next != nullptr)
+                    {
+                        index = store->CountLiveBefore(index);
+                        store = store->next;
+                    }
+                    else if (store->isCleared)
+                    {
+                        index = 0;
+                        store = table->store;
+                    }
+                    else
+                    {
+                        break;
+                    }
+                }
+
+                if (store != nullptr)
+                {
+                    while (index < store->used)
+                    {
+                        if (KeyOf(store->entries[index++]) != nullptr)
+                        {
+                            return true;
+                        }
+                    }
+                }
+
+                // Table is empty or iteration has finished
+                table = nullptr;
+                store = nullptr;
+                index = 0;
+                return false;
+            }
+
+            TData Current() const
+            {
+                Assert(store != nullptr && index > 0 && KeyOf(store->entries[index - 1]) != nullptr);
+                return store->entries[index - 1];
+            }
+        };
+
+        uint32 Count() const
+        {
+            return this->store == nullptr ? 0 : this->store->liveCount;
+        }
+
+        Field(TData)* Find(Var key)
+        {
+            uint32 index;
+            if (this->store == nullptr || !TryFindIndex(this->store, key, &index, nullptr))
+            {
+                return nullptr;
+            }
+            return &this->store->entries[index];
+        }
+
+        // Appends an entry whose key is not already in the table
+        void Add(const TData& data, Recycler* recycler)
+        {
+            Assert(Find(KeyOf(data)) == nullptr);
+
+            if (this->store == nullptr)
+            {
+                this->store = Store::New(recycler, InitialCapacity);
+            }
+            else if (this->store->used == this->store->capacity)
+            {
+                // Grow when at least half of the entries are live, otherwise just squeeze out the holes
+                uint32 capacity = this->store->capacity;
+                Rebuild(this->store->liveCount * 2 >= capacity ? UInt32Math::Mul<2>(capacity) : capacity, recycler);
+            }
+
+            Store* current = this->store;
+            uint32 index = current->used++;
+            current->entries[index] = data;
+            current->liveCount++;
+
+            if (current->buckets != nullptr)
+            {
+                hash_t hash = HashKey(KeyOf(data));
+                current->hashes[index] = hash;
+                InsertBucket(current, hash, index);
+            }
+        }
+
+        bool Remove(Var key, Recycler* recycler)
+        {
+            uint32 index;
+            uint32 bucket;
+            if (this->store == nullptr || !TryFindIndex(this->store, key, &index, &bucket))
+            {
+                return false;
+            }
+
+            Store* current = this->store;
+            ClearEntry(current->entries[index]);
+            if (current->buckets != nullptr)
+            {
+                current->buckets[bucket] = RemovedBucket;
+            }
+            current->liveCount--;
+
+            if (current->capacity > InitialCapacity && current->liveCount < current->capacity / 4)
+            {
+                Rebuild(current->capacity / 2, recycler);
+            }
+            return true;
+        }
+
+        void Clear()
+        {
+            if (this->store != nullptr)
+            {
+                this->store->isCleared = true;
+                this->store = nullptr;
+            }
+        }
+
+        Iterator GetIterator()
+        {
+            return Iterator(this);
+        }
+
+        // Must match the inline hash in Lowerer::GenerateFastInlineMapOrSetAccess
+        static hash_t HashInt32Key(int32 value)
+        {
+            hash_t hash = (hash_t)value;
+            return hash ^ (hash >> 16);
+        }
+
+        static hash_t GetKeyHash(Var key) { return HashKey(key); }
+
+        static uint32 GetOffsetOfStore() { return offsetof(MapOrSetDataTable, store); }
+        static uint32 GetOffsetOfStoreBuckets() { return offsetof(Store, buckets); }
+        static uint32 GetOffsetOfStoreHashes() { return offsetof(Store, hashes); }
+        static uint32 GetOffsetOfStoreBucketCount() { return offsetof(Store, bucketCount); }
+        static uint32 GetOffsetOfStoreUsed() { return offsetof(Store, used); }
+        static uint32 GetOffsetOfStoreEntries() { return offsetof(Store, entries); }
+    };
+}
@@ -0,0 +1,205 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    OneByteString::OneByteString(StaticType* type, const char* buffer, charcount_t charLength) :
+        JavascriptString(type),
+        m_buff(buffer)
+    {
+        // Use SetLength to ensure length is valid
+        SetLength(charLength);
+    }
+
+    OneByteString* OneByteString::Allocate(charcount_t charLength, ScriptContext* scriptContext, _Outptr_result_buffer_(charLength) char** buffer)
+    {
+        Assert(IsValidCharCount(charLength));
+
+        // The characters go in a leaf allocation of their own, so the recycler doesn't scan them for pointers
+        Recycler* recycler = scriptContext->GetRecycler();
+        char* target = RecyclerNewArrayLeaf(recycler, char, (size_t)charLength + 1);
+        target[charLength] = '\0';
+
+        *buffer = target;
+        return RecyclerNew(recycler, OneByteString, scriptContext->GetLibrary()->GetStringTypeStatic(), target, charLength);
+    }
+
+    JavascriptString* OneByteString::NewCopyBuffer(__in_ecount(charLength) const char* content, charcount_t charLength, ScriptContext* scriptContext)
+    {
+        AssertMsg(content != nullptr, "NULL value passed to OneByteString::NewCopyBuffer");
+
+        switch (charLength)
+        {
+        case 0:
+            return scriptContext->GetLibrary()->GetEmptyString();
+
+        case 1:
+            return scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(static_cast<char16>(static_cast<unsigned char>(*content)));
+
+        default:
+            break;
+        }
+
+        char* buffer;
+        OneByteString* str = Allocate(charLength, scriptContext, &buffer);
+        js_memcpy_s(buffer, charLength, content, charLength);
+        return str;
+    }
+
+    JavascriptString* OneByteString::NewCopyBuffer(__in_ecount(charLength) const char16* content, charcount_t charLength, ScriptContext* scriptContext)
+    {
+        AssertMsg(content != nullptr, "NULL value passed to OneByteString::NewCopyBuffer");
+        Assert(IsOneByte(content, charLength));
+
+        switch (charLength)
+        {
+        case 0:
+            return scriptContext->GetLibrary()->GetEmptyString();
+
+        case 1:
+            return scriptContext->GetLibrary()->GetCharStringCache().GetStringForChar(*content);
+
+        default:
+            break;
+        }
+
+        char* buffer;
+        OneByteString* str = Allocate(charLength, scriptContext, &buffer);
+        Narrow(buffer, content, charLength);
+        return str;
+    }
+
+    JavascriptString* OneByteString::NewCopyBufferPreferOneByte(__in_ecount(charLength) const char16* content, charcount_t charLength, ScriptContext* scriptContext)
+    {
+        if (charLength > 1 && IsOneByte(content, charLength))
+        {
+            return NewCopyBuffer(content, charLength, scriptContext);
+        }
+        return JavascriptString::NewCopyBuffer(content, charLength, scriptContext);
+    }
+
+    JavascriptString* OneByteString::Concat(OneByteString* left, OneByteString* right)
+    {
+        const charcount_t leftLength = left->GetLength();
+        const charcount_t rightLength = right->GetLength();
+        const charcount_t length = leftLength + rightLength;
+        Assert(length <= MaxFlatCopyLength);
+
+        char* buffer;
+        OneByteString* str = Allocate(length, left->GetScriptContext(), &buffer);
+        js_memcpy_s(buffer, length, left->m_buff, leftLength);
+        js_memcpy_s(buffer + leftLength, rightLength, right->m_buff, rightLength);
+        return str;
+    }
+
+    JavascriptString* OneByteString::Substring(OneByteString* str, charcount_t start, charcount_t length)
+    {
+        AssertOrFailFast(str->GetLength() >= start + length);
+        return NewCopyBuffer(str->m_buff + start, length, str->GetScriptContext());
+    }
+
+    bool OneByteString::IsOneByte(__in_ecount(charLength) const char16* content, charcount_t charLength)
+    {
+        // OR everything together so the loop has no early exit and the compiler can vectorize it;
+        // callers hand us freshly scanned input that is almost always narrow.
+        char16 bits = 0;
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            bits |= content[i];
+        }
+        return bits <= 0xFF;
+    }
+
+    bool OneByteString::IsAscii(__in_ecount(charLength) const char* content, charcount_t charLength)
+    {
+        unsigned char bits = 0;
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            bits |= static_cast<unsigned char>(content[i]);
+        }
+        return bits < 0x80;
+    }
+
+    void OneByteString::Widen(__out_ecount(charLength) char16* dst, __in_ecount(charLength) const char* src, charcount_t charLength)
+    {
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            dst[i] = static_cast<char16>(static_cast<unsigned char>(src[i]));
+        }
+    }
+
+    void OneByteString::Narrow(__out_ecount(charLength) char* dst, __in_ecount(charLength) const char16* src, charcount_t charLength)
+    {
+        for (charcount_t i = 0; i < charLength; i++)
+        {
+            Assert(src[i] <= 0xFF);
+            dst[i] = static_cast<char>(src[i]);
+        }
+    }
+
+    bool OneByteString::OneByteEquals(const OneByteString* other) const
+    {
+        return this->GetLength() == other->GetLength() &&
+            memcmp(this->m_buff, other->m_buff, this->GetLength()) == 0;
+    }
+
+    const char16* OneByteString::GetSz()
+    {
+        if (this->IsFinalized())
+        {
+            return this->UnsafeGetBuffer();
+        }
+
+        const charcount_t allocSize = this->SafeSzSize();
+
+        Recycler* recycler = GetScriptContext()->GetRecycler();
+        char16* target = RecyclerNewArrayLeaf(recycler, char16, allocSize);
+        Widen(target, this->m_buff, this->GetLength());
+        target[this->GetLength()] = _u('\0');
+
+        this->SetBuffer(target);
+        return target;
+    }
+
+    void OneByteString::CopyVirtual(
+        _Out_writes_(m_charLength) char16 *const buffer,
+        StringCopyInfoStack &nestedStringTreeCopyInfos,
+        const byte recursionDepth)
+    {
+        Assert(buffer);
+        Assert(!this->IsFinalized());
+
+        // Widen straight into the destination (e.g. a flattening concat tree) without materializing our own UTF-16 copy
+        Widen(buffer, this->m_buff, this->GetLength());
+    }
+
+    void OneByteString::GetPropertyRecord(_Out_ PropertyRecord const** propertyRecord, bool dontLookupFromDictionary)
+    {
+        const charcount_t length = this->GetLength();
+        if (this->IsFinalized() || dontLookupFromDictionary || length > MaxStackWidenLength)
+        {
+            __super::GetPropertyRecord(propertyRecord, dontLookupFromDictionary);
+            return;
+        }
+
+        // The property record keeps its own UTF-16 copy of the name, so a temporary is enough for the lookup
+        char16 buffer[MaxStackWidenLength];
+        Widen(buffer, this->m_buff, length);
+        GetScriptContext()->GetOrAddPropertyRecord(buffer, static_cast<int>(length), propertyRecord);
+    }
+
+    size_t OneByteString::GetAllocatedByteCount() const
+    {
+        return this->GetLength() + 1 + __super::GetAllocatedByteCount();
+    }
+
+    template <> bool VarIsImpl<OneByteString>(RecyclableObject* obj)
+    {
+        return VirtualTableInfo<OneByteString>::HasVirtualTable(obj);
+    }
+
+} // namespace Js
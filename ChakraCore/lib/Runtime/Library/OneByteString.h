@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // A flat string whose characters all fit in one byte (Latin-1, U+0000 - U+00FF).
+    // The characters are stored in a leaf buffer, one byte per character, so until somebody asks for
+    // the UTF-16 buffer the string costs roughly half the memory of the equivalent LiteralString.
+    //
+    // GetSz/GetString widen on demand into a separate leaf buffer. Consumers that can work on the
+    // one-byte content directly (concat flattening, GetItem, Equals, property lookup, substring,
+    // JsCopyString) use GetOneByteBuffer() instead, so the UTF-16 copy is never created for them.
+    // The one-byte buffer stays valid after widening since the object keeps pointing at it.
+    class OneByteString sealed : public JavascriptString
+    {
+        friend class StringDeduplicator;
+
+    private:
+        OneByteString(StaticType* type, const char* buffer, charcount_t charLength);
+
+    protected:
+        DEFINE_VTABLE_CTOR(OneByteString, JavascriptString);
+
+    public:
+        // Strings built out of one-byte pieces (concat, substring) stay one-byte up to this length.
+        // Past that, a tree or SubString referencing the source is cheaper than copying.
+        static const charcount_t MaxFlatCopyLength = 256;
+
+        // Property names are widened into a stack buffer for the property map lookup up to this length.
+        static const charcount_t MaxStackWidenLength = 128;
+
+        // content must be Latin-1; callers converting from UTF-8 must ensure it is plain ASCII.
+        static JavascriptString* NewCopyBuffer(__in_ecount(charLength) const char* content, charcount_t charLength, ScriptContext* scriptContext);
+
+        // Narrows content, which the caller must have checked with IsOneByte.
+        static JavascriptString* NewCopyBuffer(__in_ecount(charLength) const char16* content, charcount_t charLength, ScriptContext* scriptContext);
+
+        // Creates a one-byte string if content fits, otherwise falls back to JavascriptString::NewCopyBuffer.
+        static JavascriptString* NewCopyBufferPreferOneByte(__in_ecount(charLength) const char16* content, charcount_t charLength, ScriptContext* scriptContext);
+
+        static JavascriptString* Concat(OneByteString* left, OneByteString* right);
+        static JavascriptString* Substring(OneByteString* str, charcount_t start, charcount_t length);
+
+        static bool IsOneByte(__in_ecount(charLength) const char16* content, charcount_t charLength);
+        static bool IsAscii(__in_ecount(charLength) const char* content, charcount_t charLength);
+        static void Widen(__out_ecount(charLength) char16* dst, __in_ecount(charLength) const char* src, charcount_t charLength);
+        static void Narrow(__out_ecount(charLength) char* dst, __in_ecount(charLength) const char16* src, charcount_t charLength);
+
+        const char* GetOneByteBuffer() const { return m_buff; }
+        char16 GetOneByteItem(charcount_t index) const { return static_cast<char16>(static_cast<unsigned char>(m_buff[index])); }
+        bool OneByteEquals(const OneByteString* other) const;
+
+        virtual const char16* GetSz() override sealed;
+        virtual void GetPropertyRecord(_Out_ PropertyRecord const** propertyRecord, bool dontLookupFromDictionary = false) override;
+        virtual size_t GetAllocatedByteCount() const override;
+
+    protected:
+        virtual void CopyVirtual(_Out_writes_(m_charLength) char16 *const buffer, StringCopyInfoStack &nestedStringTreeCopyInfos, const byte recursionDepth) override sealed;
+
+    private:
+        static OneByteString* Allocate(charcount_t charLength, ScriptContext* scriptContext, _Outptr_result_buffer_(charLength) char** buffer);
+
+        Field(const char*) m_buff; // charLength one-byte characters followed by a '\0'
+    };
+
+    template <> bool VarIsImpl<OneByteString>(RecyclableObject* obj);
+
+} // namespace Js
@@ -24,6 +24,8 @@
 #include "Library/LazyJSONString.h"
 #include "Library/JSONStringBuilder.h"
 #include "Library/JSONStringifier.h"
+#include "Library/JSONUtf8Builder.h"
+#include "Library/JSONIncrementalParser.h"
 #include "Library/ProfileString.h"
 #include "Library/SingleCharString.h"
 #include "Library/SubString.h"
@@ -51,7 +53,7 @@
 #include "Library/JavascriptAsyncGenerator.h"
 
 #include "Library/SameValueComparer.h"
-#include "Library/MapOrSetDataList.h"
+#include "Library/MapOrSetDataTable.h"
 #include "Library/JavascriptMap.h"
 #include "Library/JavascriptSet.h"
 #include "Library/JavascriptWeakMap.h"
@@ -97,6 +99,7 @@
 #include "Language/JavascriptStackWalker.h"
 #include "Language/CacheOperators.h"
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 // .inl files
 #include "Library/JavascriptString.inl"
 #include "Library/ConcatString.inl"
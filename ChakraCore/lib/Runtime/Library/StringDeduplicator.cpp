@@ -0,0 +1,203 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeLibraryPch.h"
+
+namespace Js
+{
+    StringDeduplicator::StringDeduplicator(Recycler* recycler) :
+        recycler(recycler),
+        newCandidates(&HeapAllocator::Instance),
+        survivorCandidates(&HeapAllocator::Instance),
+        canonicalStrings(&HeapAllocator::Instance),
+        canonicalOneByteStrings(&HeapAllocator::Instance),
+        candidatesHashed(0),
+        duplicateCount(0),
+        bytesReclaimed(0)
+    {
+        Assert(recycler);
+    }
+
+    void StringDeduplicator::RegisterCandidate(JavascriptString* str)
+    {
+        if (!CONFIG_FLAG_RELEASE(DedupStrings) || str->GetLength() < MinLength)
+        {
+            return;
+        }
+
+        // OneByteStrings register before they have a UTF-16 buffer; whether there is anything to share is decided
+        // when the candidate is processed. Other types (empty and single char strings, LiteralString subclasses
+        // that can switch buffers) are skipped.
+        if (!VirtualTableInfo<LiteralString>::HasVirtualTable(str) && !VarIs<OneByteString>(str))
+        {
+            return;
+        }
+
+        StringDeduplicator* deduplicator = str->GetScriptContext()->GetThreadContext()->GetStringDeduplicator();
+        if (deduplicator)
+        {
+            deduplicator->AddCandidate(str);
+        }
+    }
+
+    void StringDeduplicator::AddCandidate(JavascriptString* str)
+    {
+        // Registration is best effort, losing a candidate on OOM only loses the saving
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+            newCandidates.Add(str);
+        }
+        catch (Js::OutOfMemoryException)
+        {
+        }
+    }
+
+    bool StringDeduplicator::IsLive(JavascriptString* str) const
+    {
+        // Unmarked objects are freed by the sweep that follows. A live object that isn't marked (e.g. allocated
+        // during a concurrent mark) is dropped as well, which only loses the saving.
+        return recycler->IsObjectMarked(str);
+    }
+
+    const char16* StringDeduplicator::GetDedupableBuffer(JavascriptString* str)
+    {
+        // Only types whose buffer is a recycler leaf allocation that nothing else redirects. LiteralString subclasses
+        // (property strings, flattened concat trees) are excluded by the exact vtable check. OneByteStrings have a UTF-16
+        // buffer only once they have been widened; their one-byte buffer is handled by DeduplicateOneByte.
+        if (!str->IsFinalized() ||
+            !(VirtualTableInfo<LiteralString>::HasVirtualTable(str) || VarIs<OneByteString>(str)))
+        {
+            return nullptr;
+        }
+        return str->UnsafeGetBuffer();
+    }
+
+    void StringDeduplicator::ProcessAfterMark()
+    {
+        // Canonical strings that are about to be swept can't be shared any more
+        canonicalStrings.MapAndRemoveIf([this](CanonicalStringMap::EntryType& entry)
+        {
+            return !this->IsLive(entry.Value());
+        });
+        canonicalOneByteStrings.MapAndRemoveIf([this](CanonicalOneByteStringMap::EntryType& entry)
+        {
+            return !this->IsLive(entry.Value());
+        });
+
+        const int processedCount = survivorCandidates.Count();
+        try
+        {
+            AUTO_NESTED_HANDLED_EXCEPTION_TYPE(ExceptionType_OutOfMemory);
+
+            for (int i = 0; i < survivorCandidates.Count(); i++)
+            {
+                JavascriptString* str = survivorCandidates.Item(i);
+                if (IsLive(str))
+                {
+                    Deduplicate(str);
+                }
+            }
+            survivorCandidates.Clear();
+
+            // Candidates from this cycle that survived get hashed at the next collection, so short-lived strings never are
+            for (int i = 0; i < newCandidates.Count(); i++)
+            {
+                JavascriptString* str = newCandidates.Item(i);
+                if (IsLive(str))
+                {
+                    survivorCandidates.Add(str);
+                }
+            }
+            newCandidates.Clear();
+        }
+        catch (Js::OutOfMemoryException)
+        {
+            // The lists must not keep pointers to anything the sweep frees; drop what wasn't processed
+            survivorCandidates.Clear();
+            newCandidates.Clear();
+        }
+
+        if (PHASE_STATS1(StringDedupPhase))
+        {
+            Output::Print(_u("StringDedup: processed %d, hashed %llu, duplicates %llu, canonical %d, bytes reclaimed %llu\n"),
+                processedCount, candidatesHashed, duplicateCount, canonicalStrings.Count() + canonicalOneByteStrings.Count(), bytesReclaimed);
+            Output::Flush();
+        }
+    }
+
+    void StringDeduplicator::Deduplicate(JavascriptString* str)
+    {
+        OneByteString *const oneByteString = JavascriptOperators::TryFromVar<OneByteString>(str);
+        if (oneByteString)
+        {
+            DeduplicateOneByte(oneByteString);
+        }
+
+        const char16* buffer = GetDedupableBuffer(str);
+        if (!buffer)
+        {
+            return;
+        }
+
+        candidatesHashed++;
+        const JsUtil::CharacterBuffer<WCHAR> content(buffer, str->GetLength());
+        JavascriptString* canonical;
+        if (!canonicalStrings.TryGetValue(content, &canonical))
+        {
+            canonicalStrings.Add(content, str);
+            return;
+        }
+
+        const char16* canonicalBuffer = canonical->UnsafeGetBuffer();
+        if (canonical == str || canonicalBuffer == buffer)
+        {
+            return;
+        }
+
+        // The canonical buffer is marked through the canonical string, so it survives this sweep. The old buffer
+        // stays alive through anything else still pointing at it (SubStrings, the stack) and is otherwise reclaimed
+        // by the next collection.
+        str->SetBuffer(canonicalBuffer);
+        duplicateCount++;
+        bytesReclaimed += (uint64)(str->GetLength() + 1) * sizeof(char16);
+
+        if (PHASE_TRACE1(StringDedupPhase))
+        {
+            Output::Print(_u("StringDedup: shared a UTF-16 buffer of %u chars\n"), str->GetLength());
+            Output::Flush();
+        }
+    }
+
+    void StringDeduplicator::DeduplicateOneByte(OneByteString* str)
+    {
+        const unsigned char* buffer = reinterpret_cast<const unsigned char*>(str->GetOneByteBuffer());
+
+        candidatesHashed++;
+        const JsUtil::CharacterBuffer<unsigned char> content(buffer, str->GetLength());
+        OneByteString* canonical;
+        if (!canonicalOneByteStrings.TryGetValue(content, &canonical))
+        {
+            canonicalOneByteStrings.Add(content, str);
+            return;
+        }
+
+        const char* canonicalBuffer = canonical->GetOneByteBuffer();
+        if (canonical == str || canonicalBuffer == str->GetOneByteBuffer())
+        {
+            return;
+        }
+
+        // Same as for UTF-16 buffers: the one-byte buffer is a leaf allocation of its own (see OneByteString::Allocate)
+        str->m_buff = canonicalBuffer;
+        duplicateCount++;
+        bytesReclaimed += (uint64)str->GetLength() + 1;
+
+        if (PHASE_TRACE1(StringDedupPhase))
+        {
+            Output::Print(_u("StringDedup: shared a one-byte buffer of %u chars\n"), str->GetLength());
+            Output::Flush();
+        }
+    }
+}
@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Js
+{
+    // Opt-in (-DedupStrings) deduplication of long-lived flat string buffers, in the spirit of G1's string dedup.
+    //
+    // Strings created from external data (JSON.parse values) are registered as candidates. The table
+    // only holds raw pointers in heap memory, so it doesn't keep anything alive; instead it runs from the recycler's
+    // PreSweepCallback, after mark and before sweep, and uses the mark bits to drop entries that are about to be freed.
+    //
+    // A candidate is hashed once it has survived two collections. If an equal canonical string is already known, the
+    // candidate's buffer pointer is redirected to the canonical leaf buffer and its own buffer becomes garbage for the
+    // next collection; otherwise the candidate becomes canonical itself. Only the buffer pointer changes, the string
+    // objects themselves keep their identity. OneByteStrings share their one-byte buffers, which are usually the only
+    // buffers they have, and also their UTF-16 buffers if they have been widened.
+    class StringDeduplicator
+    {
+    public:
+        // Shorter buffers don't pay for their table entry
+        static const charcount_t MinLength = 8;
+
+        StringDeduplicator(Recycler* recycler);
+
+        static void RegisterCandidate(JavascriptString* str);
+
+        // Called from ThreadContext::PreSweepCallback
+        void ProcessAfterMark();
+
+        uint64 GetBytesReclaimed() const { return bytesReclaimed; }
+        uint64 GetDuplicateCount() const { return duplicateCount; }
+
+    private:
+        typedef JsUtil::List<JavascriptString*, HeapAllocator> CandidateList;
+        typedef JsUtil::BaseDictionary<JsUtil::CharacterBuffer<WCHAR>, JavascriptString*, HeapAllocator, PowerOf2SizePolicy> CanonicalStringMap;
+        typedef JsUtil::BaseDictionary<JsUtil::CharacterBuffer<unsigned char>, OneByteString*, HeapAllocator, PowerOf2SizePolicy> CanonicalOneByteStringMap;
+
+        void AddCandidate(JavascriptString* str);
+        bool IsLive(JavascriptString* str) const;
+        static const char16* GetDedupableBuffer(JavascriptString* str);
+        void Deduplicate(JavascriptString* str);
+        void DeduplicateOneByte(OneByteString* str);
+
+        Recycler* recycler;
+        CandidateList newCandidates;        // Registered since the last collection
+        CandidateList survivorCandidates;   // Survived one collection, hashed at the next
+        CanonicalStringMap canonicalStrings;
+        CanonicalOneByteStringMap canonicalOneByteStrings;
+
+        // Stats
+        uint64 candidatesHashed;
+        uint64 duplicateCount;
+        uint64 bytesReclaimed;
+    };
+}
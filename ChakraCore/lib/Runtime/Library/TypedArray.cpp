@@ -2170,9 +2170,9 @@ namespace Js
             ScriptContext* scriptContext = compFn->GetScriptContext();
             Var undefined = scriptContext->GetLibrary()->GetUndefined();
             Var retVal = nullptr;
-            BEGIN_SAFE_REENTRANT_CALL(scriptContext->GetThreadContext())
+            BEGIN_SAFE_REENTRANT_CALL(cvInfo->threadContext)
             {
-                retVal = CALL_FUNCTION(scriptContext->GetThreadContext(),
+                retVal = CALL_FUNCTION(cvInfo->threadContext,
                             compFn, CallInfo(CallFlags_Value, 3),
                             undefined,
                             JavascriptNumber::ToVarNoCheck((double)x, scriptContext),
@@ -2198,6 +2198,39 @@ namespace Js
         }
     }
 
+    // Comparison method used in TypedArray.prototype.sort when no comparison function was provided
+    template<typename T> bool TypedArrayCompareValuesHelper(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2)
+    {
+        return *static_cast<const T*>(elem1) < *static_cast<const T*>(elem2);
+    }
+
+    // Floating point elements also need NaN values sorted to the end and -0 sorted before +0
+    template<typename T> bool TypedArrayCompareFloatValuesHelper(const void* elem1, const void* elem2)
+    {
+        const T x = *static_cast<const T*>(elem1);
+        const T y = *static_cast<const T*>(elem2);
+
+        if (x < y)
+        {
+            return true;
+        }
+        if (x == y)
+        {
+            return x == 0 && JavascriptNumber::IsNegZero((double)x) && !JavascriptNumber::IsNegZero((double)y);
+        }
+        return !NumberUtilities::IsNan((double)x) && NumberUtilities::IsNan((double)y);
+    }
+
+    template<> bool TypedArrayCompareValuesHelper<float>(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2)
+    {
+        return TypedArrayCompareFloatValuesHelper<float>(elem1, elem2);
+    }
+
+    template<> bool TypedArrayCompareValuesHelper<double>(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2)
+    {
+        return TypedArrayCompareFloatValuesHelper<double>(elem1, elem2);
+    }
+
     // TypedArray.prototype.sort entry point
     // Implements #sec-%typedarray%.prototype.sort from ECMA 2023 spec
     // 
@@ -14,6 +14,9 @@ namespace Js
     typedef Var (*PFNCreateTypedArray)(Js::ArrayBufferBase* arrayBuffer, uint32 offSet, uint32 mappedLength, Js::JavascriptLibrary* javascriptLibrary);
 
     template<typename T> bool TypedArrayCompareElementsHelper(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2);
+    template<typename T> bool TypedArrayCompareValuesHelper(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2);
+    template<> bool TypedArrayCompareValuesHelper<float>(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2);
+    template<> bool TypedArrayCompareValuesHelper<double>(JavascriptArray::CompareVarsInfo* cvInfo, const void* elem1, const void* elem2);
 
     class TypedArrayBase : public ArrayBufferParent
     {
@@ -551,8 +554,10 @@ namespace Js
             TypeName* list = reinterpret_cast<TypeName*>(listBuffer);
             JavascriptArray::CompareVarsInfo cvInfo;
             cvInfo.scriptContext = scriptContext;
+            cvInfo.threadContext = scriptContext->GetThreadContext();
+            cvInfo.undefinedValue = scriptContext->GetLibrary()->GetUndefined();
             cvInfo.compFn = compareFn;
-            cvInfo.compareType = &TypedArrayCompareElementsHelper<TypeName>;
+            cvInfo.compareType = compareFn != nullptr ? &TypedArrayCompareElementsHelper<TypeName> : &TypedArrayCompareValuesHelper<TypeName>;
             JavascriptArray::TypedArraySort<TypeName>(list, length, &cvInfo, allocator);
         }
 
@@ -615,8 +620,10 @@ namespace Js
             char16* list = reinterpret_cast<char16*>(listBuffer);
             JavascriptArray::CompareVarsInfo cvInfo;
             cvInfo.scriptContext = scriptContext;
+            cvInfo.threadContext = scriptContext->GetThreadContext();
+            cvInfo.undefinedValue = scriptContext->GetLibrary()->GetUndefined();
             cvInfo.compFn = compareFn;
-            cvInfo.compareType = &TypedArrayCompareElementsHelper<char16>;
+            cvInfo.compareType = compareFn != nullptr ? &TypedArrayCompareElementsHelper<char16> : &TypedArrayCompareValuesHelper<char16>;
             JavascriptArray::TypedArraySort<char16>(list, length, &cvInfo, allocator);
         }
 
@@ -0,0 +1,305 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeTypePch.h"
+
+namespace Js
+{
+    void MegamorphicPropertyCache::Element::Clear()
+    {
+        type = nullptr;
+        prototypeObjectWithProperty = nullptr;
+        id = Constants::NoProperty;
+    }
+
+    MegamorphicPropertyCache::MegamorphicPropertyCache() : protoPropertyIdFilter(0)
+    #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        , hasTestTracedHit(false)
+    #endif
+    {
+        for(Element &element : elements)
+        {
+            element.Clear();
+            element.index = 0;
+            element.isInlineSlot = false;
+            element.isSetPropertyAllowed = false;
+            element.isMissing = false;
+        }
+    }
+
+    size_t MegamorphicPropertyCache::ElementIndex(const Type *const type, const PropertyId id)
+    {
+        Assert(type);
+        Assert(id != Constants::NoProperty);
+        CompileAssert((MegamorphicPropertyCache_NumElements & MegamorphicPropertyCache_NumElements - 1) == 0);
+
+        // Recycler objects are 16-byte aligned, so the low bits of a type's address don't tell types apart
+        const size_t typeBits = reinterpret_cast<size_t>(type) >> 4;
+        return (typeBits ^ typeBits >> 10 ^ static_cast<size_t>(id)) & MegamorphicPropertyCache_NumElements - 1;
+    }
+
+    uint64 MegamorphicPropertyCache::ProtoPropertyIdFilterBit(const PropertyId id)
+    {
+        return 1ull << (id & 63);
+    }
+
+    void MegamorphicPropertyCache::TestTraceHit()
+    {
+    #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        if(!hasTestTracedHit && PHASE_TESTTRACE1(MegamorphicPropertyCachePhase))
+        {
+            hasTestTracedHit = true;
+            Output::Print(_u("MegamorphicPropertyCache: found a property that the type property cache missed\n"));
+            Output::Flush();
+        }
+    #endif
+    }
+
+    template <bool OutputExistence /*When set, propertyValue represents whether the property exists on the instance, not its actual value*/>
+    bool MegamorphicPropertyCache::TryGetProperty(
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(propertyValueInfo);
+        Assert(propertyValueInfo->GetInlineCache() || propertyValueInfo->GetPolymorphicInlineCache());
+
+        const Element &element = elements[ElementIndex(propertyObject->GetType(), propertyId)];
+        if(element.type != propertyObject->GetType() || element.id != propertyId || (!checkMissing && element.isMissing))
+        {
+        #if DBG_DUMP
+            if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+            {
+                CacheOperators::TraceCache(
+                    static_cast<InlineCache *>(nullptr),
+                    _u("MegamorphicPropertyCache get miss"),
+                    propertyId,
+                    requestContext,
+                    propertyObject);
+            }
+        #endif
+            return false;
+        }
+
+    #if DBG_DUMP
+        if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+        {
+            CacheOperators::TraceCache(
+                static_cast<InlineCache *>(nullptr),
+                element.prototypeObjectWithProperty ? _u("MegamorphicPropertyCache get hit prototype") : _u("MegamorphicPropertyCache get hit"),
+                propertyId,
+                requestContext,
+                propertyObject);
+        }
+    #endif
+        TestTraceHit();
+
+        TypePropertyCache::GetCachedProperty<OutputExistence>(
+            propertyObject,
+            propertyId,
+            element.index,
+            element.isInlineSlot,
+            checkMissing ? element.isMissing : false,
+            element.prototypeObjectWithProperty,
+            propertyValue,
+            requestContext,
+            operationInfo,
+            propertyValueInfo);
+        return true;
+    }
+    template bool MegamorphicPropertyCache::TryGetProperty<false>(
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo);
+    template bool MegamorphicPropertyCache::TryGetProperty<true>(
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo);
+
+    bool MegamorphicPropertyCache::TrySetProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(propertyValueInfo);
+        Assert(propertyValueInfo->GetInlineCache() || propertyValueInfo->GetPolymorphicInlineCache());
+
+        const Element &element = elements[ElementIndex(object->GetType(), propertyId)];
+        if(element.type != object->GetType() ||
+            element.id != propertyId ||
+            !element.isSetPropertyAllowed ||
+            element.prototypeObjectWithProperty)
+        {
+        #if DBG_DUMP
+            if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+            {
+                CacheOperators::TraceCache(
+                    static_cast<InlineCache *>(nullptr),
+                    _u("MegamorphicPropertyCache set miss"),
+                    propertyId,
+                    requestContext,
+                    object);
+            }
+        #endif
+            return false;
+        }
+
+        Assert(!element.isMissing);
+    #if DBG_DUMP
+        if(PHASE_TRACE1(MegamorphicPropertyCachePhase))
+        {
+            CacheOperators::TraceCache(
+                static_cast<InlineCache *>(nullptr),
+                _u("MegamorphicPropertyCache set hit"),
+                propertyId,
+                requestContext,
+                object);
+        }
+    #endif
+        TestTraceHit();
+
+        TypePropertyCache::SetCachedProperty(
+            object,
+            propertyId,
+            element.index,
+            element.isInlineSlot,
+            propertyValue,
+            requestContext,
+            operationInfo,
+            propertyValueInfo);
+        return true;
+    }
+
+    void MegamorphicPropertyCache::Cache(
+        Type *const type,
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isSetPropertyAllowed)
+    {
+        Assert(index != Constants::NoSlot);
+
+        Element &element = elements[ElementIndex(type, id)];
+        element.type = type;
+        element.prototypeObjectWithProperty = nullptr;
+        element.id = id;
+        element.index = index;
+        element.isInlineSlot = isInlineSlot;
+        element.isSetPropertyAllowed = isSetPropertyAllowed;
+        element.isMissing = false;
+    }
+
+    void MegamorphicPropertyCache::Cache(
+        Type *const type,
+        const PropertyId id,
+        const PropertyIndex index,
+        const bool isInlineSlot,
+        const bool isMissing,
+        DynamicObject *const prototypeObjectWithProperty)
+    {
+        Assert(index != Constants::NoSlot);
+        Assert(prototypeObjectWithProperty);
+        Assert(isMissing == (prototypeObjectWithProperty == prototypeObjectWithProperty->GetLibrary()->GetMissingPropertyHolder()));
+
+        Element &element = elements[ElementIndex(type, id)];
+        element.type = type;
+        element.prototypeObjectWithProperty = prototypeObjectWithProperty;
+        element.id = id;
+        element.index = index;
+        element.isInlineSlot = isInlineSlot;
+        element.isSetPropertyAllowed = false;
+        element.isMissing = isMissing;
+
+        protoPropertyIdFilter |= ProtoPropertyIdFilterBit(id);
+    }
+
+    void MegamorphicPropertyCache::ClearIfPropertyIsOnAPrototype(const PropertyId id)
+    {
+        const uint64 idBit = ProtoPropertyIdFilterBit(id);
+        if(!(protoPropertyIdFilter & idBit))
+        {
+            return;
+        }
+
+        // The entries for this property ID can be anywhere in the table
+        bool hasOtherPropertyIdsWithSameBit = false;
+        for(Element &element : elements)
+        {
+            if(!element.prototypeObjectWithProperty || ProtoPropertyIdFilterBit(element.id) != idBit)
+            {
+                continue;
+            }
+
+            if(element.id == id)
+            {
+                element.Clear();
+            }
+            else
+            {
+                hasOtherPropertyIdsWithSameBit = true;
+            }
+        }
+
+        if(!hasOtherPropertyIdsWithSameBit)
+        {
+            protoPropertyIdFilter &= ~idBit;
+        }
+    }
+
+    void MegamorphicPropertyCache::ClearAllOnAPrototype()
+    {
+        if(!protoPropertyIdFilter)
+        {
+            return;
+        }
+
+        for(Element &element : elements)
+        {
+            if(element.prototypeObjectWithProperty)
+            {
+                element.Clear();
+            }
+        }
+        protoPropertyIdFilter = 0;
+    }
+
+    void MegamorphicPropertyCache::ClearUnusedTypes(Recycler *const recycler)
+    {
+        Assert(recycler);
+
+        protoPropertyIdFilter = 0;
+        for(Element &element : elements)
+        {
+            if(!element.type)
+            {
+                continue;
+            }
+
+            if(!recycler->IsObjectMarked(element.type) ||
+                (element.prototypeObjectWithProperty && !recycler->IsObjectMarked(element.prototypeObjectWithProperty)))
+            {
+                element.Clear();
+            }
+            else if(element.prototypeObjectWithProperty)
+            {
+                protoPropertyIdFilter |= ProtoPropertyIdFilterBit(element.id);
+            }
+        }
+    }
+}
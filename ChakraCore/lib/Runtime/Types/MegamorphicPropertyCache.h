@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Must be a power of 2
+#define MegamorphicPropertyCache_NumElements 1024
+
+namespace Js
+{
+    struct PropertyCacheOperationInfo;
+
+    // Property slots keyed by (type, property ID), shared by all the property access sites of a thread context.
+    //
+    // Once a site sees more types than its inline caches hold, its accesses go through the type property cache of each
+    // type. Those only have one entry per property ID modulo TypePropertyCache_NumElements, so objects with many hot
+    // properties keep evicting their own entries. This cache gets the same entries and is looked up when the type property
+    // cache misses, before the slow path. Like the type property caches, its entries are only valid for a type and its
+    // prototype chain as they are, and entries for properties on a prototype are cleared with them
+    // (ThreadContext::InvalidateProtoTypePropertyCaches).
+    //
+    // The table lives in heap memory and doesn't keep its types alive. Entries whose type or prototype object was not
+    // marked are cleared from ThreadContext::PreSweepCallback, before the sweep can reuse their memory.
+    class MegamorphicPropertyCache
+    {
+    private:
+        struct Element
+        {
+            Type *type;
+            DynamicObject *prototypeObjectWithProperty;
+            PropertyId id;
+            PropertyIndex index;
+            bool isInlineSlot : 1;
+            bool isSetPropertyAllowed : 1;
+            bool isMissing : 1;
+
+            void Clear();
+        };
+
+        Element elements[MegamorphicPropertyCache_NumElements];
+
+        // Bit (id % 64) is set when there may be an entry for property ID id on a prototype, so that invalidating the
+        // prototype caches of other property IDs doesn't need to look at the elements
+        uint64 protoPropertyIdFilter;
+
+    #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
+        // -testtrace:MegamorphicPropertyCache only reports the first hit, since which accesses hit depends on how the types
+        // hash
+        bool hasTestTracedHit;
+    #endif
+
+    private:
+        static size_t ElementIndex(const Type *const type, const PropertyId id);
+        static uint64 ProtoPropertyIdFilterBit(const PropertyId id);
+        void TestTraceHit();
+
+    public:
+        MegamorphicPropertyCache();
+
+        template <bool OutputExistence /*When set, propertyValue represents whether the property exists on the instance, not its actual value*/>
+        bool TryGetProperty(const bool checkMissing, RecyclableObject *const propertyObject, const PropertyId propertyId, Var *const propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+        bool TrySetProperty(RecyclableObject *const object, const PropertyId propertyId, Var propertyValue, ScriptContext *const requestContext, PropertyCacheOperationInfo *const operationInfo, PropertyValueInfo *const propertyValueInfo);
+
+    public:
+        void Cache(Type *const type, const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isSetPropertyAllowed);
+        void Cache(Type *const type, const PropertyId id, const PropertyIndex index, const bool isInlineSlot, const bool isMissing, DynamicObject *const prototypeObjectWithProperty);
+        void ClearIfPropertyIsOnAPrototype(const PropertyId id);
+        void ClearAllOnAPrototype();
+
+        // Called from ThreadContext::PreSweepCallback
+        void ClearUnusedTypes(Recycler *const recycler);
+    };
+}
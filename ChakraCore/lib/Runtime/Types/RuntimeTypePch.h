@@ -9,6 +9,7 @@
 #include "Language/InlineCachePointerArray.h"
 #include "Types/UnscopablesWrapperObject.h"
 #include "Types/TypePropertyCache.h"
+#include "Types/MegamorphicPropertyCache.h"
 #include "Types/MissingPropertyTypeHandler.h"
 #include "Types/PathTypeHandler.h"
 #include "Types/PropertyIndexRanges.h"
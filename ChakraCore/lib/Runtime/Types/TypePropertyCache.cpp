@@ -189,20 +189,63 @@ namespace Js
             return false;
         }
 
-        if(!prototypeObjectWithProperty)
+    #if DBG_DUMP
+        if(PHASE_TRACE1(TypePropertyCachePhase))
         {
-        #if DBG_DUMP
-            if(PHASE_TRACE1(TypePropertyCachePhase))
-            {
-                CacheOperators::TraceCache(
-                    static_cast<InlineCache *>(nullptr),
-                    _u("TypePropertyCache get hit"),
-                    propertyId,
-                    requestContext,
-                    propertyObject);
-            }
-        #endif
+            CacheOperators::TraceCache(
+                static_cast<InlineCache *>(nullptr),
+                prototypeObjectWithProperty ? _u("TypePropertyCache get hit prototype") : _u("TypePropertyCache get hit"),
+                propertyId,
+                requestContext,
+                propertyObject);
+        }
+    #endif
 
+        GetCachedProperty<OutputExistence>(
+            propertyObject,
+            propertyId,
+            propertyIndex,
+            isInlineSlot,
+            isMissing,
+            prototypeObjectWithProperty,
+            propertyValue,
+            requestContext,
+            operationInfo,
+            propertyValueInfo);
+        return true;
+    }
+    template bool TypePropertyCache::TryGetProperty<false>(
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo);
+    template bool TypePropertyCache::TryGetProperty<true>(
+        const bool checkMissing,
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo);
+
+    template <bool OutputExistence /*When set, propertyValue represents whether the property exists on the instance, not its actual value*/>
+    void TypePropertyCache::GetCachedProperty(
+        RecyclableObject *const propertyObject,
+        const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        const bool isMissing,
+        DynamicObject *const prototypeObjectWithProperty,
+        Var *const propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        if(!prototypeObjectWithProperty)
+        {
         #if DBG
             const PropertyIndex typeHandlerPropertyIndex =
                 VarTo<DynamicObject>(propertyObject)
@@ -246,7 +289,7 @@ namespace Js
                     0,
                     propertyValueInfo,
                     requestContext);
-                return true;
+                return;
             }
             else if (!OutputExistence)
             {
@@ -259,20 +302,8 @@ namespace Js
                 operationInfo->cacheType = CacheType_TypeProperty;
                 operationInfo->slotType = isInlineSlot ? SlotType_Inline : SlotType_Aux;
             }
-            return true;
-        }
-
-    #if DBG_DUMP
-        if(PHASE_TRACE1(TypePropertyCachePhase))
-        {
-            CacheOperators::TraceCache(
-                static_cast<InlineCache *>(nullptr),
-                _u("TypePropertyCache get hit prototype"),
-                propertyId,
-                requestContext,
-                propertyObject);
+            return;
         }
-    #endif
 
     #if DBG
         const PropertyIndex typeHandlerPropertyIndex =
@@ -307,7 +338,7 @@ namespace Js
 
             if(propertyObject->GetScriptContext() != requestContext)
             {
-                return true;
+                return;
             }
 
             CacheOperators::Cache<false, true, false>(
@@ -323,7 +354,7 @@ namespace Js
                 0,
                 propertyValueInfo,
                 requestContext);
-            return true;
+            return;
         }
         else if (!OutputExistence)
         {
@@ -336,20 +367,26 @@ namespace Js
             operationInfo->cacheType = CacheType_TypeProperty;
             operationInfo->slotType = isInlineSlot ? SlotType_Inline : SlotType_Aux;
         }
-        return true;
     }
-    template bool TypePropertyCache::TryGetProperty<false>(
-        const bool checkMissing,
+
+    template void TypePropertyCache::GetCachedProperty<false>(
         RecyclableObject *const propertyObject,
         const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        const bool isMissing,
+        DynamicObject *const prototypeObjectWithProperty,
         Var *const propertyValue,
         ScriptContext *const requestContext,
         PropertyCacheOperationInfo *const operationInfo,
         PropertyValueInfo *const propertyValueInfo);
-    template bool TypePropertyCache::TryGetProperty<true>(
-        const bool checkMissing,
+    template void TypePropertyCache::GetCachedProperty<true>(
         RecyclableObject *const propertyObject,
         const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        const bool isMissing,
+        DynamicObject *const prototypeObjectWithProperty,
         Var *const propertyValue,
         ScriptContext *const requestContext,
         PropertyCacheOperationInfo *const operationInfo,
@@ -396,6 +433,31 @@ namespace Js
         }
     #endif
 
+        SetCachedProperty(
+            object,
+            propertyId,
+            propertyIndex,
+            isInlineSlot,
+            propertyValue,
+            requestContext,
+            operationInfo,
+            propertyValueInfo);
+        return true;
+    }
+
+    void TypePropertyCache::SetCachedProperty(
+        RecyclableObject *const object,
+        const PropertyId propertyId,
+        const PropertyIndex propertyIndex,
+        const bool isInlineSlot,
+        Var propertyValue,
+        ScriptContext *const requestContext,
+        PropertyCacheOperationInfo *const operationInfo,
+        PropertyValueInfo *const propertyValueInfo)
+    {
+        Assert(propertyValueInfo);
+        Assert(propertyValueInfo->GetInlineCache() || propertyValueInfo->GetPolymorphicInlineCache());
+
 #if ENABLE_FIXED_FIELDS
         Assert(!object->IsFixedProperty(propertyId));
 #endif
@@ -438,7 +500,7 @@ namespace Js
                 0,
                 propertyValueInfo,
                 requestContext);
-            return true;
+            return;
         }
 
         if(operationInfo)
@@ -446,7 +508,6 @@ namespace Js
             operationInfo->cacheType = CacheType_TypeProperty;
             operationInfo->slotType = isInlineSlot ? SlotType_Inline : SlotType_Aux;
         }
-        return true;
     }
 
     void TypePropertyCache::Cache(
@@ -30,6 +30,269 @@ namespace Js
         }
 
 
+        TransferredContents* TransferredContents::Detach(Var* vars, size_t count)
+        {
+            DetachedStateBase** states = HeapNewArrayZ(DetachedStateBase*, count);
+            for (size_t i = 0; i < count; i++)
+            {
+                // Not queued for delayed free: the contents are going to another owner, possibly on another thread
+                states[i] = JavascriptOperators::DetachVarAndGetState(vars[i], false /*queueForDelayFree*/);
+            }
+            return HeapNew(TransferredContents, states, count);
+        }
+
+        Var TransferredContents::Claim(size_t index, JavascriptLibrary* library)
+        {
+            Assert(index < m_count);
+            DetachedStateBase* state = m_states[index];
+            if (state == nullptr || state->HasBeenClaimed())
+            {
+                return nullptr;
+            }
+
+            Var var = JavascriptOperators::NewVarFromDetachedState(state, library);
+
+            // The new ArrayBuffer took its own reference on the contents; drop the one the state held
+            state->ReleaseRefBufferContent();
+            state->MarkAsClaimed();
+            return var;
+        }
+
+        void TransferredContents::Release()
+        {
+            for (size_t i = 0; i < m_count; i++)
+            {
+                if (m_states[i] != nullptr)
+                {
+                    m_states[i]->CleanUp();
+                }
+            }
+            HeapDeleteArray(m_count, m_states);
+            HeapDelete(this);
+        }
+
+        static const uint32 SnapshotMagic = 0x50414E53;    // "SNAP"
+        static const uint32 SnapshotVersion = 2;
+
+        struct SnapshotHeader
+        {
+            uint32 magic;
+            uint32 version;
+            uint32 payloadLength;
+        };
+
+        // Written after the SCA host object type id of a captured function, followed by its source text
+        struct SnapshotFunction
+        {
+            uint32 isStrictMode;
+            uint32 sourceLength;
+        };
+
+        // A function can be recreated from its source text if it doesn't close over anything but the global scope.
+        // Methods, accessors and class members can't be evaluated on their own, and generators and async functions
+        // are wrapped in objects that keep more state than their source.
+        static bool CanCaptureFunction(Var value)
+        {
+            ScriptFunction* function = JavascriptOperators::TryFromVar<ScriptFunction>(value);
+            if (function == nullptr || VarIs<AsmJsScriptFunction>(function))
+            {
+                return false;
+            }
+
+            FunctionInfo* info = function->GetFunctionInfo();
+            if (info->IsClassConstructor() || info->IsClassMethod() || info->IsMethod() || info->HasHomeObj() ||
+                info->IsModule() || info->IsCoroutine() || info->HasSuperReference())
+            {
+                return false;
+            }
+
+            Utf8SourceInfo* sourceInfo = function->GetFunctionProxy()->GetUtf8SourceInfo();
+            return function->GetEnvironment()->GetLength() == 0 && sourceInfo != nullptr && !sourceInfo->GetIsLibraryCode();
+        }
+
+        // Collects the stream of a snapshot for its Serializer. Functions that can be recreated from their source text
+        // are written as a host object holding that text. Other values the host would have to write (functions that
+        // close over local scopes and host objects) are only noted: they make the snapshot fail once the graph has
+        // been walked.
+        class SnapshotWriteStream : public HostStream
+        {
+        public:
+            SnapshotWriteStream() : m_serializer(nullptr), m_buffer(nullptr), m_capacity(0), m_hasHostObject(false)
+            {
+            }
+
+            ~SnapshotWriteStream()
+            {
+                if (m_buffer != nullptr)
+                {
+                    HeapDeleteArray(m_capacity, m_buffer);
+                }
+            }
+
+            void SetSerializer(Serializer* serializer) { m_serializer = serializer; }
+            bool HasHostObject() const { return m_hasHostObject; }
+
+            virtual byte * ExtendBuffer(byte *oldBuffer, size_t newSize, size_t *allocatedSize) override
+            {
+                Assert(oldBuffer == m_buffer);
+                byte* newBuffer = HeapNewNoThrowArray(byte, newSize);
+                if (newBuffer == nullptr)
+                {
+                    OutOfMemory_unrecoverable_error();
+                }
+                if (oldBuffer != nullptr)
+                {
+                    js_memcpy_s(newBuffer, newSize, oldBuffer, m_capacity);
+                    HeapDeleteArray(m_capacity, oldBuffer);
+                }
+                m_buffer = newBuffer;
+                m_capacity = newSize;
+                *allocatedSize = newSize;
+                return newBuffer;
+            }
+
+            virtual bool WriteHostObject(void* data) override
+            {
+                if (!CanCaptureFunction(data))
+                {
+                    m_hasHostObject = true;
+                    return false;
+                }
+
+                ScriptFunction* function = VarTo<ScriptFunction>(data);
+                JavascriptString* source = function->EnsureSourceString();
+                SnapshotFunction record = { function->GetFunctionProxy()->EnsureDeserialized()->GetIsStrictMode(), source->GetLength() };
+                m_serializer->WriteRawBytes(&record, sizeof(record));
+                m_serializer->WriteRawBytes(source->GetString(), source->GetLength() * sizeof(char16));
+                return true;
+            }
+
+        private:
+            Serializer* m_serializer;
+            byte* m_buffer;
+            size_t m_capacity;
+            bool m_hasHostObject;
+        };
+
+        // Recreates the functions of a snapshot by evaluating their source text in the global scope
+        class SnapshotReadStream : public HostReadStream
+        {
+        public:
+            SnapshotReadStream(ScriptContext* scriptContext) : m_scriptContext(scriptContext), m_deserializer(nullptr), m_isCorrupt(false)
+            {
+            }
+
+            void SetDeserializer(Deserializer* deserializer) { m_deserializer = deserializer; }
+            bool IsCorrupt() const { return m_isCorrupt; }
+
+            virtual Var ReadHostObject() override
+            {
+                JavascriptLibrary* library = m_scriptContext->GetLibrary();
+                SnapshotFunction record;
+                void* recordBuffer = &record;
+                if (m_deserializer->GetRemainingLength() < sizeof(record))
+                {
+                    m_isCorrupt = true;
+                    return library->GetUndefined();
+                }
+                m_deserializer->ReadBytes(sizeof(record), &recordBuffer);
+                if (record.sourceLength == 0 || record.sourceLength > m_deserializer->GetRemainingLength() / sizeof(char16))
+                {
+                    m_isCorrupt = true;
+                    return library->GetUndefined();
+                }
+
+                // Parenthesized, so that a function declaration is evaluated as an expression
+                const charcount_t length = UInt32Math::Add(record.sourceLength, 2);
+                char16* source = RecyclerNewArrayLeaf(m_scriptContext->GetRecycler(), char16, length + 1);
+                void* sourceBuffer = source + 1;
+                m_deserializer->ReadBytes(record.sourceLength * sizeof(char16), &sourceBuffer);
+                source[0] = _u('(');
+                source[length - 1] = _u(')');
+                source[length] = _u('\0');
+
+                Var function = nullptr;
+                try
+                {
+                    BEGIN_JS_RUNTIME_CALL(m_scriptContext)
+                    {
+                        Var args[] = { library->GetUndefined(), JavascriptString::NewWithBuffer(source, length, m_scriptContext) };
+                        Arguments arguments(CallInfo(CallFlags_Value, _countof(args)), args);
+                        function = GlobalObject::VEval(library, (FrameDisplay*)&NullFrameDisplay, kmodGlobal, record.isStrictMode != 0,
+                            /* isIndirect */ true, arguments, /* isLibraryCode */ false, /* registerDocument */ true, /* additionalGrfscr */ 0);
+                    }
+                    END_JS_RUNTIME_CALL(m_scriptContext)
+                }
+                catch (const JavascriptException& err)
+                {
+                    err.GetAndClear();
+                    function = nullptr;
+                }
+
+                if (function == nullptr || !VarIs<ScriptFunction>(function))
+                {
+                    m_isCorrupt = true;
+                    return library->GetUndefined();
+                }
+                return function;
+            }
+
+        private:
+            ScriptContext* m_scriptContext;
+            Deserializer* m_deserializer;
+            bool m_isCorrupt;
+        };
+
+        ArrayBuffer* ContextSnapshot::Create(Var root, ScriptContext* scriptContext)
+        {
+            SnapshotWriteStream stream;
+            Serializer serializer(scriptContext, &stream);
+            stream.SetSerializer(&serializer);
+
+            // The graph has no transferable vars: its ArrayBuffers are copied into the image
+            SnapshotHeader header = { SnapshotMagic, SnapshotVersion, 0 };
+            serializer.WriteRawBytes(&header, sizeof(header));
+            if (!serializer.WriteValue(root) || stream.HasHostObject())
+            {
+                return nullptr;
+            }
+
+            byte* image = nullptr;
+            size_t imageLength = 0;
+            serializer.Release(&image, &imageLength);
+            uint32 length = (uint32)imageLength;
+            ((SnapshotHeader*)image)->payloadLength = length - sizeof(SnapshotHeader);
+
+            ArrayBuffer* snapshot = scriptContext->GetLibrary()->CreateArrayBuffer(length);
+            js_memcpy_s(snapshot->GetBuffer(), length, image, length);
+            return snapshot;
+        }
+
+        Var ContextSnapshot::Inflate(ArrayBuffer* snapshot, ScriptContext* scriptContext)
+        {
+            byte* image = snapshot->GetBuffer();
+            uint32 length = snapshot->GetByteLength();
+            if (length <= sizeof(SnapshotHeader))
+            {
+                return nullptr;
+            }
+
+            SnapshotHeader header;
+            js_memcpy_s(&header, sizeof(header), image, sizeof(header));
+            if (header.magic != SnapshotMagic || header.version != SnapshotVersion ||
+                header.payloadLength != length - sizeof(SnapshotHeader))
+            {
+                return nullptr;
+            }
+
+            // The stream is read straight from the image, which may be mapped from a file
+            SnapshotReadStream stream(scriptContext);
+            Deserializer deserializer(image + sizeof(SnapshotHeader), header.payloadLength, scriptContext, &stream);
+            stream.SetDeserializer(&deserializer);
+            Var root = deserializer.ReadValue();
+            return stream.IsCorrupt() ? nullptr : root;
+        }
+
         HRESULT Serializer::SetTransferableVars(Var *vars, size_t count)
         {
             if (m_transferableVars != nullptr)
@@ -53,20 +316,59 @@ namespace Js
         bool Serializer::WriteValue(Var rootObject)
         {
             ScriptContext *scriptContext = m_streamWriter.GetScriptContext();
+
+            // The stream has no way to share memory with its reader. The contents of SharedArrayBuffers are only
+            // collected to fail the write.
+            JsUtil::List<SharedContents*, HeapAllocator> sharedContentsList(&HeapAllocator::Instance);
             BEGIN_JS_RUNTIME_CALL(scriptContext)
             {
-                Js::SCASerializationEngine::Serialize(rootObject, &m_streamWriter, m_transferableVars, m_cTransferableVars, nullptr /*TBD*/);
+                Js::SCASerializationEngine::Serialize(rootObject, &m_streamWriter, m_transferableVars, m_cTransferableVars, &sharedContentsList);
             }
             END_JS_RUNTIME_CALL(scriptContext)
-                return true;
+
+            if (sharedContentsList.Count() > 0)
+            {
+                sharedContentsList.Map([](int, SharedContents* sharedContents)
+                {
+                    sharedContents->Release();
+                });
+                return false;
+            }
+            return true;
+        }
+
+        Serializer::~Serializer()
+        {
+            if (m_transferredContents != nullptr)
+            {
+                m_transferredContents->Release();
+            }
         }
 
         bool Serializer::DetachArrayBuffer()
         {
-            Assert(false);
+            if (m_isDetached)
+            {
+                return false;
+            }
+
+            ScriptContext *scriptContext = m_streamWriter.GetScriptContext();
+            BEGIN_JS_RUNTIME_CALL(scriptContext)
+            {
+                m_transferredContents = TransferredContents::Detach(m_transferableVars, m_cTransferableVars);
+            }
+            END_JS_RUNTIME_CALL(scriptContext)
+            m_isDetached = true;
             return true;
         }
 
+        TransferredContents* Serializer::ReleaseTransferredContents()
+        {
+            TransferredContents* contents = m_transferredContents;
+            m_transferredContents = nullptr;
+            return contents;
+        }
+
         void Serializer::WriteRawBytes(const void* source, size_t length)
         {
             ScriptContext *scriptContext = m_streamWriter.GetScriptContext();
@@ -96,21 +398,53 @@ namespace Js
             return true;
         }
 
+        size_t Deserializer::GetRemainingLength() const
+        {
+            return m_streamReader.GetRemainingLength();
+        }
+
         Var Deserializer::ReadValue()
         {
             Var returnedValue = nullptr;
             ScriptContext *scriptContext = m_streamReader.GetScriptContext();
             BEGIN_JS_RUNTIME_CALL(scriptContext)
             {
-                returnedValue = Js::SCADeserializationEngine::Deserialize(&m_streamReader, m_transferableVars, m_cTransferableVars);
+                Var* transferableVars = m_transferableVars;
+                size_t cTransferableVars = m_cTransferableVars;
+                if (m_transferredContents != nullptr)
+                {
+                    // The ArrayBuffers are only reachable from this frame until the deserialized graph references them
+                    cTransferableVars = m_transferredContents->GetCount();
+                    transferableVars = RecyclerNewArrayZ(scriptContext->GetRecycler(), Var, cTransferableVars);
+                    for (size_t i = 0; i < cTransferableVars; i++)
+                    {
+                        transferableVars[i] = m_transferredContents->Claim(i, scriptContext->GetLibrary());
+                        if (transferableVars[i] == nullptr)
+                        {
+                            JavascriptError::ThrowTypeError(scriptContext, JSERR_DetachedTypedArray);
+                        }
+                    }
+                }
+                returnedValue = Js::SCADeserializationEngine::Deserialize(&m_streamReader, transferableVars, cTransferableVars);
             }
             END_JS_RUNTIME_CALL(scriptContext)
                 return returnedValue;
         }
 
+        HRESULT Deserializer::SetTransferredContents(TransferredContents* contents)
+        {
+            if (m_transferableVars != nullptr || m_transferredContents != nullptr)
+            {
+                Assert(false);
+                return E_FAIL;
+            }
+            m_transferredContents = contents;
+            return S_OK;
+        }
+
         HRESULT Deserializer::SetTransferableVars(Var *vars, size_t count)
         {
-            if (m_transferableVars != nullptr)
+            if (m_transferableVars != nullptr || m_transferredContents != nullptr)
             {
                 Assert(false);
                 return E_FAIL;
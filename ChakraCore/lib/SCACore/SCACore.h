@@ -9,6 +9,51 @@ namespace Js
 {
     namespace SCACore
     {
+        //
+        // The contents of the transferred ArrayBuffers of a message. The sending side detaches its ArrayBuffers into
+        // this, and the receiving side creates ArrayBuffers that take over the same memory, so the bytes are never
+        // copied. Contents that are never claimed are freed by Release.
+        //
+        class TransferredContents
+        {
+        public:
+            static TransferredContents* Detach(Var* vars, size_t count);
+
+            size_t GetCount() const { return m_count; }
+
+            // Create the ArrayBuffer for a transferred content; returns nullptr if it has already been claimed
+            Var Claim(size_t index, JavascriptLibrary* library);
+            void Release();
+
+        private:
+            TransferredContents(DetachedStateBase** states, size_t count)
+                : m_states(states), m_count(count)
+            {
+            }
+
+            DetachedStateBase** m_states;
+            size_t m_count;
+        };
+
+        //
+        // A snapshot image of an object graph, to warm up new contexts without re-running the code that built the
+        // graph. The image is a small header followed by the stream a Serializer writes for the graph. Functions that
+        // only close over the global scope are written as host objects holding their source text, and Inflate
+        // evaluates that text again in the global scope of the new context. The image doesn't reference any memory
+        // outside itself, so it can be written to a file and mapped back in; Inflate reads it in place with a
+        // Deserializer, in one pass.
+        //
+        class ContextSnapshot
+        {
+        public:
+            // Returns nullptr if the graph holds a value that can't be in a snapshot (functions that close over local
+            // scopes, methods, generators, host objects and shared memory)
+            static ArrayBuffer* Create(Var root, ScriptContext* scriptContext);
+
+            // Returns nullptr if the buffer isn't a snapshot image or a function in it can't be evaluated
+            static Var Inflate(ArrayBuffer* snapshot, ScriptContext* scriptContext);
+        };
+
         class Serializer
         {
         public:
@@ -17,11 +62,15 @@ namespace Js
             {
             }
 
+            ~Serializer();
+
             HRESULT SetTransferableVars(Var *vars, size_t count);
 
             void WriteRawBytes(const void* source, size_t length);
+            // Returns false if the graph holds a SharedArrayBuffer, whose memory the stream can't share
             bool WriteValue(Var rootObject);
             bool DetachArrayBuffer();
+            TransferredContents* ReleaseTransferredContents();
 
             bool Release(byte** data, size_t *dataLength);
 
@@ -29,6 +78,8 @@ namespace Js
             StreamWriter m_streamWriter;
             Var* m_transferableVars = nullptr;
             size_t m_cTransferableVars = 0;
+            TransferredContents* m_transferredContents = nullptr;
+            bool m_isDetached = false;
         };
 
         class Deserializer
@@ -40,15 +91,18 @@ namespace Js
             }
 
             HRESULT SetTransferableVars(Var *vars, size_t count);
+            HRESULT SetTransferredContents(TransferredContents* contents);
 
             bool ReadRawBytes(size_t length, void **data);
             bool ReadBytes(size_t length, void **data);
+            size_t GetRemainingLength() const;
             Var ReadValue();
 
         private:
             StreamReader m_streamReader;
             Var* m_transferableVars = nullptr;
             size_t m_cTransferableVars = 0;
+            TransferredContents* m_transferredContents = nullptr;
         };
     }
 
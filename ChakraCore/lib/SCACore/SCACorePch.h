@@ -12,7 +12,7 @@
 #include "Library/JavascriptRegularExpression.h"
 #include "Library/JavascriptProxy.h"
 #include "Library/SameValueComparer.h"
-#include "Library/MapOrSetDataList.h"
+#include "Library/MapOrSetDataTable.h"
 #include "Library/JavascriptMap.h"
 #include "Library/JavascriptSet.h"
 #include "Library/JavascriptWeakMap.h"
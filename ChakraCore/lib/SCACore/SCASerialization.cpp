@@ -17,6 +17,7 @@
 #include "Types/DictionaryPropertyDescriptor.h"
 #include "Types/DictionaryTypeHandler.h"
 #include "Types/ES5ArrayTypeHandler.h"
+#include "Types/PathTypeHandler.h"
 #include "Library/JavascriptArrayIndexStaticEnumerator.h"
 #include "Library/ES5ArrayIndexStaticEnumerator.h"
 
@@ -308,6 +309,10 @@ namespace Js
             // Now we only need to write remaining non-index properties
             arr->GetNonIndexEnumerator(&enumerator, scriptContext);
         }
+        else if (srcTypeId == TypeIds_Object && TryWritePlainObjectProperties(obj))
+        {
+            return;
+        }
         else if (!obj->GetEnumerator(&enumerator, EnumeratorFlags::SnapShotSemantics, scriptContext))
         {
             // Mark property end if we don't have enumerator
@@ -326,7 +331,7 @@ namespace Js
 
         Write((int32)(map->Size()));
 
-        JavascriptMap::MapDataList::Iterator iter = map->GetIterator();
+        JavascriptMap::MapDataTable::Iterator iter = map->GetIterator();
         while (iter.Next())
         {
             const JavascriptMap::MapDataKeyValuePair& entry = iter.Current();
@@ -342,7 +347,7 @@ namespace Js
 
         Write((int32)(set->Size()));
 
-        JavascriptSet::SetDataList::Iterator iter = set->GetIterator();
+        JavascriptSet::SetDataTable::Iterator iter = set->GetIterator();
         while (iter.Next())
         {
             this->GetEngine()->Clone(iter.Current());
@@ -515,6 +520,53 @@ namespace Js
         }
     }
 
+    //
+    // Write the properties of a plain object (an object literal, or an Object that only had properties added)
+    // straight from its slots. The path type handler lists the properties in the order the enumerator gives
+    // them, so the output is what WriteObjectProperties writes, without a property string and a property
+    // lookup for each property.
+    //
+    template <class Writer>
+    bool SerializationCloner<Writer>::TryWritePlainObjectProperties(RecyclableObject* obj)
+    {
+        if (!VirtualTableInfo<DynamicObject>::HasVirtualTable(obj))
+        {
+            return false;
+        }
+
+        DynamicObject* object = UnsafeVarTo<DynamicObject>(obj);
+        DynamicTypeHandler* typeHandler = object->GetTypeHandler();
+        if (object->HasObjectArray() || !typeHandler->IsPathTypeHandler() ||
+            PathTypeHandlerBase::FromTypeHandler(typeHandler)->IsPathTypeHandlerWithAttr())
+        {
+            // Index properties, or properties that may be non-enumerable or accessors
+            return false;
+        }
+
+        ScriptContext* scriptContext = this->GetScriptContext();
+        DynamicType* type = object->GetDynamicType();
+        const int propertyCount = typeHandler->GetPropertyCount();
+        for (PropertyIndex index = 0; index < propertyCount; index++)
+        {
+            const PropertyRecord* propertyRecord = scriptContext->GetPropertyName(typeHandler->GetPropertyId(scriptContext, index));
+            if (propertyRecord->IsSymbol())
+            {
+                continue;
+            }
+
+            Write(propertyRecord->GetBuffer(), propertyRecord->GetLength());
+
+            // Host objects cloned so far may have changed this object; if so, look up the remaining values
+            Var value = object->GetDynamicType() == type ?
+                object->GetSlot(index) :
+                JavascriptOperators::GetProperty(object, propertyRecord->GetPropertyId(), scriptContext);
+            this->GetEngine()->Clone(value);
+        }
+
+        m_writer->Write(static_cast<uint32>(SCA_PROPERTY_TERMINATOR));
+        return true;
+    }
+
     //
     // Do an arbitrary test to determine serializing a JavascriptArray as sparse array or not.
     //
@@ -59,6 +59,8 @@ namespace Js
         static bool IsTypedArray(SrcTypeId typeId);
         void WriteTypedArray(SrcTypeId typeId, Src src) const;
 
+        bool TryWritePlainObjectProperties(RecyclableObject* obj);
+
         static bool IsSparseArray(JavascriptArray* arr);
         void WriteDenseArrayIndexProperties(JavascriptArray* arr);
         void WriteSparseArrayIndexProperties(JavascriptArray* arr);
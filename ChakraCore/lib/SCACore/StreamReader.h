@@ -38,6 +38,7 @@ namespace Js
         }
 
         Var ReadHostObject();
+        size_t GetRemainingLength() const { return GetBytesInBuffer(); }
         void Read(void* pv, size_t cb);
 
         void ReadRawBytes(void** pv, size_t cb)
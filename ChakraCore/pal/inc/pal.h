@@ -3633,7 +3633,11 @@ GlobalMemoryStatusEx(
 
 typedef struct _MEMORY_BASIC_INFORMATION {
     PVOID BaseAddress;
+#ifdef LINUX_FAST_ARRAYBUFFER
+    PVOID AllocationBase;           // Only defined for memory from VirtualAlloc
+#else
     PVOID AllocationBase_PAL_Undefined;
+#endif
     DWORD AllocationProtect;
     SIZE_T RegionSize;
     DWORD State;
@@ -5860,6 +5864,16 @@ PAL_SetActivationFunction(
     IN PAL_ActivationFunction pActivationFunction,
     IN PAL_SafeActivationCheckFunction pSafeActivationCheckFunction);
 
+#ifdef LINUX_FAST_ARRAYBUFFER
+typedef BOOL (*PAL_HardwareExceptionFilter)(EXCEPTION_POINTERS *pointers);
+
+PALIMPORT
+VOID
+PALAPI
+PAL_SetHardwareExceptionFilter(
+    IN PAL_HardwareExceptionFilter pHardwareExceptionFilter);
+#endif
+
 #define VER_PLATFORM_WIN32_WINDOWS        1
 #define VER_PLATFORM_WIN32_NT        2
 #define VER_PLATFORM_UNIX            10
@@ -76,6 +76,10 @@ static void sigbus_handler(int code, siginfo_t *siginfo, void *context);
 
 static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
                                   native_context_t *ucontext);
+#ifdef LINUX_FAST_ARRAYBUFFER
+static BOOL hardware_exception_filter(PEXCEPTION_POINTERS pointers,
+                                      native_context_t *ucontext);
+#endif
 
 static void inject_activation_handler(int code, siginfo_t *siginfo, void *context);
 
@@ -299,6 +303,13 @@ static void sigsegv_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
+#ifdef LINUX_FAST_ARRAYBUFFER
+        if (hardware_exception_filter(&pointers, ucontext))
+        {
+            return;
+        }
+#endif
+
         common_signal_handler(&pointers, code, ucontext);
     }
 
@@ -398,6 +409,13 @@ static void sigbus_handler(int code, siginfo_t *siginfo, void *context)
 
         pointers.ExceptionRecord = &record;
 
+#ifdef LINUX_FAST_ARRAYBUFFER
+        if (hardware_exception_filter(&pointers, ucontext))
+        {
+            return;
+        }
+#endif
+
         common_signal_handler(&pointers, code, ucontext);
     }
 
@@ -544,6 +562,53 @@ static void common_signal_handler(PEXCEPTION_POINTERS pointers, int code,
     // SEHProcessException(pointers);
 }
 
+#ifdef LINUX_FAST_ARRAYBUFFER
+/*++
+Function :
+    hardware_exception_filter
+
+    passes a memory access fault to the filter registered with
+    PAL_SetHardwareExceptionFilter
+
+Parameters :
+    PEXCEPTION_POINTERS pointers : exception information
+    native_context_t *ucontext : context structure given to signal handler
+
+Return value :
+    TRUE if the filter handled the exception, in which case the signal handler
+    returns and execution resumes with the updated context
+Note:
+    the "pointers" parameter should contain a valid exception record pointer,
+    but the contextrecord pointer will be overwritten.
+--*/
+static BOOL hardware_exception_filter(PEXCEPTION_POINTERS pointers,
+                                      native_context_t *ucontext)
+{
+    CONTEXT context;
+
+    if (g_hardwareExceptionFilter == NULL)
+    {
+        return FALSE;
+    }
+
+    RtlCaptureContext(&context);
+
+    // The floating point registers are included so the filter can update them.
+    CONTEXTFromNativeContext(ucontext, &context, CONTEXT_CONTROL | CONTEXT_INTEGER | CONTEXT_FLOATING_POINT);
+
+    pointers->ContextRecord = &context;
+
+    // The filter decodes the faulting load or store
+    if (!g_hardwareExceptionFilter(pointers))
+    {
+        return FALSE;
+    }
+
+    CONTEXTToNativeContext(&context, ucontext);
+    return TRUE;
+}
+#endif // LINUX_FAST_ARRAYBUFFER
+
 /*++
 Function :
     handle_signal
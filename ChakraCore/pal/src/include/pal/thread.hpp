@@ -779,6 +779,9 @@ WaitForEndingThreads(
 
 extern PAL_ActivationFunction g_activationFunction;
 extern PAL_SafeActivationCheckFunction g_safeActivationCheckFunction;
+#ifdef LINUX_FAST_ARRAYBUFFER
+extern PAL_HardwareExceptionFilter g_hardwareExceptionFilter;
+#endif
 
 /*++
 Macro:
@@ -2610,6 +2610,9 @@ VirtualQuery(
 
         /* Fill the structure.*/
         lpBuffer->AllocationProtect = pEntry->accessProtection;
+#ifdef LINUX_FAST_ARRAYBUFFER
+        lpBuffer->AllocationBase = (LPVOID)pEntry->startBoundary;
+#endif
         lpBuffer->BaseAddress = (LPVOID)StartBoundary;
 
         lpBuffer->Protect = AllocationType == MEM_COMMIT ?
@@ -2618,7 +2621,12 @@ VirtualQuery(
         lpBuffer->RegionSize = RegionSize;
         lpBuffer->State =
             ( AllocationType == MEM_COMMIT ? MEM_COMMIT : MEM_RESERVE );
+#ifdef LINUX_FAST_ARRAYBUFFER
+        // Everything VirtualAlloc tracks is an anonymous private mapping
+        lpBuffer->Type = MEM_PRIVATE;
+#else
         WARN( "Ignoring lpBuffer->Type. \n" );
+#endif
     }
 
 ExitVirtualQuery:
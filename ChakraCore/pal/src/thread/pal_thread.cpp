@@ -125,6 +125,10 @@ static int iEndingThreads = 0;
 
 // Activation function that gets called when an activation is injected into a thread.
 PAL_ActivationFunction g_activationFunction = NULL;
+#ifdef LINUX_FAST_ARRAYBUFFER
+// Filter that gets called for memory access faults, see PAL_SetHardwareExceptionFilter
+PAL_HardwareExceptionFilter g_hardwareExceptionFilter = NULL;
+#endif
 // Function to check if an activation can be safely injected at a specified context
 PAL_SafeActivationCheckFunction g_safeActivationCheckFunction = NULL;
 
@@ -2391,6 +2395,34 @@ PAL_SetActivationFunction(
     g_safeActivationCheckFunction = pSafeActivationCheckFunction;
 }
 
+#ifdef LINUX_FAST_ARRAYBUFFER
+/*++
+Function:
+    PAL_SetHardwareExceptionFilter
+
+    Register a filter that gets called when a memory access fault (SIGSEGV or
+    SIGBUS) is raised in the process. It runs in the signal handler of the
+    faulting thread, so it must not take locks that thread may already hold.
+
+Parameters:
+    pHardwareExceptionFilter - filter function. It returns TRUE when it has
+                               handled the exception, possibly updating the
+                               context, and execution should resume with the
+                               context; otherwise the signal is passed on as
+                               before.
+Return value:
+    None
+--*/
+PALIMPORT
+VOID
+PALAPI
+PAL_SetHardwareExceptionFilter(
+    IN PAL_HardwareExceptionFilter pHardwareExceptionFilter)
+{
+    g_hardwareExceptionFilter = pHardwareExceptionFilter;
+}
+#endif // LINUX_FAST_ARRAYBUFFER
+
 #if HAVE_MACH_EXCEPTIONS
 
 extern mach_port_t s_ExceptionPort;
@@ -0,0 +1,182 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array.prototype.sort finds runs that are already in order and merges them with galloping,
+// so these tests cover inputs made of runs, long enough for the merges to gallop.
+
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+// Small deterministic generator so failures reproduce
+function makeRandom(seed) {
+    return function (limit) {
+        seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+        return seed % limit;
+    };
+}
+
+function makeRecords(keys) {
+    return keys.map((key, index) => ({ key, index }));
+}
+
+function checkSortedStable(records, message) {
+    for (let i = 1; i < records.length; ++i) {
+        const previous = records[i - 1];
+        const current = records[i];
+        if (previous.key > current.key || (previous.key === current.key && previous.index > current.index)) {
+            assert.fail(message + ": out of order at " + i);
+        }
+    }
+}
+
+const random = makeRandom(40);
+const length = 20000;
+const patterns = {
+    "random": (i) => random(1000),
+    "ascending": (i) => i,
+    "descending": (i) => length - i,
+    "ascending runs": (i) => i % 1000,
+    "descending runs": (i) => 1000 - i % 1000,
+    "sorted with random tail": (i) => i < length - 100 ? i : random(length),
+    "few keys": (i) => random(3),
+    "all equal": (i) => 7,
+    "organ pipe": (i) => i < length / 2 ? i : length - i,
+};
+
+const tests = [
+    {
+        name: "Records sort stably for inputs made of runs",
+        body () {
+            for (const name in patterns) {
+                const keys = [];
+                for (let i = 0; i < length; ++i) {
+                    keys.push(patterns[name](i));
+                }
+                const records = makeRecords(keys);
+                records.sort((a, b) => a.key - b.key);
+                checkSortedStable(records, name);
+            }
+        }
+    },
+    {
+        name: "Comparison functions returning non-integers and non-numbers",
+        body () {
+            const keys = [];
+            for (let i = 0; i < 3000; ++i) {
+                keys.push(random(100) / 7);
+            }
+            const records = makeRecords(keys);
+            records.sort((a, b) => a.key < b.key ? -0.5 : (a.key > b.key ? "1" : false));
+            checkSortedStable(records, "mixed results");
+        }
+    },
+    {
+        name: "Default ordering of integer arrays compares their strings",
+        body () {
+            const values = [0, -0, 1, -1, 9, 10, 11, -10, -9, 100, 99, 1000000000, -1000000000, 2147483647, -2147483648];
+            for (let i = 0; i < 2000; ++i) {
+                values.push(random(200000) - 100000);
+            }
+            const expected = values.map(String).sort().map(Number);
+            const actual = values.slice().sort();
+            assert.areEqual(expected.length, actual.length, "same length");
+            for (let i = 0; i < expected.length; ++i) {
+                assert.areEqual(String(expected[i]), String(actual[i]), "element " + i);
+            }
+        }
+    },
+    {
+        name: "Default ordering with integers mixed with other values",
+        body () {
+            assert.areEqual([-1, 1, 10, 1e+21, 2, "a", undefined, undefined], [10, "a", 2, undefined, 1, -1, 1e21, undefined].sort());
+            assert.areEqual([0.5, 1, 1.5, 10, 2.25, 3], [3, 1.5, 10, 2.25, 1, 0.5].sort(), "native float array");
+
+            const withObject = [3, { toString() { return "20"; } }, 100, 4];
+            withObject.sort();
+            assert.areEqual("100,20,3,4", withObject.join(), "objects convert with toString");
+        }
+    },
+    {
+        name: "Undefined values and holes go to the end",
+        body () {
+            const arr = [5, undefined, 3, , 1, undefined, , 4];
+            arr.sort((a, b) => a - b);
+            assert.areEqual([1, 3, 4, 5, undefined, undefined], arr.slice(0, 6));
+            assert.areEqual(8, arr.length, "length is unchanged");
+            assert.isFalse(6 in arr, "hole at 6");
+            assert.isFalse(7 in arr, "hole at 7");
+
+            const proto = ["b", , "a"];
+            const inherits = [, "d", , "c"];
+            Object.setPrototypeOf(inherits, proto);
+            inherits.sort();
+            assert.areEqual(["a", "b", "c", "d"], inherits, "holes are filled from the prototype");
+        }
+    },
+    {
+        name: "Inconsistent comparison functions keep every element",
+        body () {
+            const values = [];
+            for (let i = 0; i < 5000; ++i) {
+                values.push(i);
+            }
+            const arr = values.slice();
+            arr.sort(() => random(3) - 1);
+            arr.sort((a, b) => a - b);
+            assert.areEqual(values, arr);
+        }
+    },
+    {
+        name: "Comparison functions that change or throw during the sort",
+        body () {
+            const arr = [];
+            for (let i = 0; i < 1000; ++i) {
+                arr.push(1000 - i);
+            }
+            let calls = 0;
+            arr.sort((a, b) => {
+                if (++calls === 100) {
+                    arr.length = 0;
+                    arr.push("changed");
+                }
+                return a - b;
+            });
+            assert.areEqual(1000, arr.length, "the sorted copy is written back");
+            assert.areEqual(1, arr[0]);
+            assert.areEqual(1000, arr[999]);
+
+            const original = [];
+            for (let i = 0; i < 1000; ++i) {
+                original.push(random(1000));
+            }
+            const copy = original.slice();
+            calls = 0;
+            assert.throws(() => copy.sort((a, b) => { if (++calls === 5000) { throw new Error("stop"); } return a - b; }), Error);
+            assert.areEqual(original, copy, "the array is unchanged when the comparison function throws");
+        }
+    },
+    {
+        name: "TypedArray default ordering",
+        body () {
+            const floats = new Float64Array([3, NaN, 0, -0, -Infinity, 1.5, -0, 0, NaN, Infinity]);
+            floats.sort();
+            assert.areEqual("-Infinity,0,0,0,0,1.5,3,Infinity,NaN,NaN", Array.prototype.join.call(floats));
+            assert.isTrue(Object.is(floats[1], -0) && Object.is(floats[2], -0), "-0 sorts before +0");
+            assert.isTrue(Object.is(floats[3], 0) && Object.is(floats[4], 0), "+0 sorts after -0");
+
+            const ints = new Int32Array(length);
+            for (let i = 0; i < length; ++i) {
+                ints[i] = patterns["organ pipe"](i) - length / 4;
+            }
+            ints.sort();
+            for (let i = 1; i < length; ++i) {
+                if (ints[i - 1] > ints[i]) {
+                    assert.fail("Int32Array out of order at " + i);
+                }
+            }
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
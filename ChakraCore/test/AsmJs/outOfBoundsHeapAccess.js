@@ -0,0 +1,113 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Heap loads and stores at indices past the end of the heap, and at negative indices that are close to 4GB as
+// unsigned offsets. Out of bounds loads read 0 (NaN for floats) and out of bounds stores are dropped, whether jitted
+// code checks the bounds or relies on the guard pages of the heap's virtual reservation (ENABLE_FAST_ARRAYBUFFER).
+
+var HEAP_SIZE = 0x10000;
+
+function AsmModule(stdlib, foreign, heap) {
+    "use asm";
+
+    var HEAP8 = new stdlib.Int8Array(heap);
+    var HEAPU8 = new stdlib.Uint8Array(heap);
+    var HEAP16 = new stdlib.Int16Array(heap);
+    var HEAPU16 = new stdlib.Uint16Array(heap);
+    var HEAP32 = new stdlib.Int32Array(heap);
+    var HEAPF32 = new stdlib.Float32Array(heap);
+    var HEAPF64 = new stdlib.Float64Array(heap);
+
+    function loadI8(i) { i = i | 0; return HEAP8[i] | 0; }
+    function loadU8(i) { i = i | 0; return HEAPU8[i] | 0; }
+    function loadI16(i) { i = i | 0; return HEAP16[i >> 1] | 0; }
+    function loadU16(i) { i = i | 0; return HEAPU16[i >> 1] | 0; }
+    function loadI32(i) { i = i | 0; return HEAP32[i >> 2] | 0; }
+    function loadF32(i) { i = i | 0; return +HEAPF32[i >> 2]; }
+    function loadF64(i) { i = i | 0; return +HEAPF64[i >> 3]; }
+
+    function storeI8(i, v) { i = i | 0; v = v | 0; HEAP8[i] = v; }
+    function storeI16(i, v) { i = i | 0; v = v | 0; HEAP16[i >> 1] = v; }
+    function storeI32(i, v) { i = i | 0; v = v | 0; HEAP32[i >> 2] = v; }
+    function storeF32(i, v) { i = i | 0; v = +v; HEAPF32[i >> 2] = v; }
+    function storeF64(i, v) { i = i | 0; v = +v; HEAPF64[i >> 3] = v; }
+
+    return {
+        loadI8: loadI8, loadU8: loadU8, loadI16: loadI16, loadU16: loadU16,
+        loadI32: loadI32, loadF32: loadF32, loadF64: loadF64,
+        storeI8: storeI8, storeI16: storeI16, storeI32: storeI32, storeF32: storeF32, storeF64: storeF64
+    };
+}
+
+var buffer = new ArrayBuffer(HEAP_SIZE);
+var asm = AsmModule(this, {}, buffer);
+var bytes = new Uint8Array(buffer);
+
+// 8-byte aligned, so that every view reads the same bytes at an in-bounds offset
+var offsets = [
+    0, 8, HEAP_SIZE - 8,
+    HEAP_SIZE, HEAP_SIZE + 8, HEAP_SIZE * 2, 0x100000, 0x7FFFFFF8,
+    -8, -16, -HEAP_SIZE, 0x80000000 | 0
+];
+
+var loads = [
+    { name: "loadI8", load: asm.loadI8 },
+    { name: "loadU8", load: asm.loadU8 },
+    { name: "loadI16", load: asm.loadI16 },
+    { name: "loadU16", load: asm.loadU16 },
+    { name: "loadI32", load: asm.loadI32 },
+    { name: "loadF32", load: asm.loadF32 },
+    { name: "loadF64", load: asm.loadF64 }
+];
+
+var stores = [
+    { name: "storeI8", store: asm.storeI8, value: -1 },
+    { name: "storeI16", store: asm.storeI16, value: -1 },
+    { name: "storeI32", store: asm.storeI32, value: -1 },
+    { name: "storeF32", store: asm.storeF32, value: 1.5 },
+    { name: "storeF64", store: asm.storeF64, value: 1.5 }
+];
+
+// One line per access: the value each load reads at each offset, or the offsets at which each store changed the heap
+function runAccesses() {
+    var lines = [];
+    bytes.fill(0xFF);
+    for (var i = 0; i < loads.length; i++) {
+        var values = [];
+        for (var j = 0; j < offsets.length; j++) {
+            values.push(loads[i].load(offsets[j]));
+        }
+        lines.push(loads[i].name + ": " + values.join(" "));
+    }
+
+    for (var i = 0; i < stores.length; i++) {
+        var store = stores[i];
+        var changed = [];
+        for (var j = 0; j < offsets.length; j++) {
+            bytes.fill(0);
+            store.store(offsets[j], store.value);
+            for (var k = 0; k < bytes.length; k++) {
+                if (bytes[k] !== 0) {
+                    changed.push(offsets[j]);
+                    break;
+                }
+            }
+        }
+        lines.push(store.name + " changed the heap at: " + changed.join(" "));
+    }
+    return lines.join("\n");
+}
+
+print("offsets: " + offsets.join(" "));
+print("first round:");
+print(runAccesses());
+
+// With -maic:1 the module's functions are jitted after the first round, and must access the heap the same way
+var result;
+for (var round = 1; round < 5; round++) {
+    result = runAccesses();
+}
+print("last round:");
+print(result);
@@ -0,0 +1,56 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Queue many functions and loops for the full JIT in a burst, then keep calling a few of them while the others go
+// cold. With background JIT, the jit queue is reordered by how often its work items run while they wait, and cold
+// work items are removed from it and queued again when they get hot again. Which of those happen depends on how
+// fast the background thread is, so the JitQueuePriority trace is only checked without background JIT, where
+// every work item is queued on the second call of its function and jitted right away. The results must not change.
+
+var COUNT = 16;
+
+// Functions with distinct bodies, so that each of them gets its own work item
+var functions = [];
+for (var i = 0; i < COUNT; i++) {
+    functions.push(eval("(function f" + i + "(x) { return (x * " + (i + 1) + " + " + i + ") | 0; })"));
+}
+
+// Functions whose loops get hot enough to be jitted as loop bodies
+var loops = [];
+for (var i = 0; i < 4; i++) {
+    loops.push(eval("(function loop" + i + "(n) { var s = 0; for (var j = 0; j < n; j++) { s = (s + j * " + (i + 3) + ") | 0; } return s; })"));
+}
+
+// Burst: every function is called a few times in a row, which queues all of them at about the same time
+var sum = 0;
+for (var round = 0; round < 4; round++) {
+    for (var i = 0; i < COUNT; i++) {
+        sum = (sum + functions[i](round)) | 0;
+    }
+    for (var i = 0; i < loops.length; i++) {
+        sum = (sum + loops[i](200)) | 0;
+    }
+}
+print("burst: " + sum);
+
+// Only a few functions stay hot, the others wait in the queue without running
+sum = 0;
+for (var round = 0; round < 2000; round++) {
+    var i = round % 4;
+    sum = (sum + functions[i](round) + loops[i](50)) | 0;
+}
+print("hot: " + sum);
+
+// The cold functions get hot again
+sum = 0;
+for (var round = 0; round < 50; round++) {
+    for (var i = 0; i < COUNT; i++) {
+        sum = (sum + functions[i](round + 7)) | 0;
+    }
+    for (var i = 0; i < loops.length; i++) {
+        sum = (sum + loops[i](100 + round)) | 0;
+    }
+}
+print("after cooling down: " + sum);
@@ -0,0 +1,125 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Property access sites that see many object shapes with many properties each, so that their accesses go through the
+// type property caches and the megamorphic property cache. Then change the objects and their prototypes, and collect
+// garbage, and check that the sites don't keep using stale entries. The output must not change with
+// -off:MegamorphicPropertyCache. -testtrace:MegamorphicPropertyCache reports the first access that the cache finds.
+
+var SHAPES = 48;
+var PROPERTIES = 40;
+
+// Each shape adds its properties in a different order, so every shape has its own type and slot layout
+function makeObject(shape, proto) {
+    var o = Object.create(proto);
+    o["s" + shape] = shape;
+    for (var i = 0; i < PROPERTIES; i++) {
+        var p = (i * 7 + shape) % PROPERTIES;
+        o["p" + p] = shape * 1000 + p;
+    }
+    return o;
+}
+
+var protos = [];
+for (var i = 0; i < 4; i++) {
+    protos.push({ fromProto: "proto" + i });
+}
+var objects = [];
+for (var shape = 0; shape < SHAPES; shape++) {
+    objects.push(makeObject(shape, protos[shape % protos.length]));
+}
+
+// The same sites for every shape
+function readAll(o) {
+    return [o.p0, o.p3, o.p13, o.p16, o.p19, o.p29, o.p32, o.p35, o.p39, o.fromProto, o.notThere];
+}
+function writeSome(o, v) {
+    o.p0 = v;
+    o.p16 = v + 1;
+    o.p32 = v + 2;
+}
+function readSum(o) {
+    return o.p0 + o.p16 + o.p32;
+}
+
+// Reads every shape a few times, and prints the sum of the numbers read and the distinct other values
+function readShapes(title, rounds) {
+    var sum = 0;
+    var others = [];
+    for (var round = 0; round < rounds; round++) {
+        for (var shape = 0; shape < SHAPES; shape++) {
+            readAll(objects[shape]).forEach(function (v) {
+                if (typeof v === "number") {
+                    sum += v;
+                } else if (others.indexOf(String(v)) < 0) {
+                    others.push(String(v));
+                }
+            });
+        }
+    }
+    print(title + ": " + sum + " " + others.join());
+}
+
+function collect() {
+    if (typeof CollectGarbage === "function") {
+        CollectGarbage();
+    }
+}
+
+readShapes("reads", 20);
+
+// Stores through the cache
+var sum = 0;
+for (var round = 0; round < 20; round++) {
+    for (var shape = 0; shape < SHAPES; shape++) {
+        writeSome(objects[shape], round);
+        sum += readSum(objects[shape]);
+    }
+}
+print("writes: " + sum);
+for (var shape = 0; shape < SHAPES; shape++) {
+    objects[shape].p0 = shape * 1000;
+    objects[shape].p16 = shape * 1000 + 16;
+    objects[shape].p32 = shape * 1000 + 32;
+}
+readShapes("after writes", 1);
+
+// A read-only property must not be written through a cached slot
+Object.defineProperty(objects[5], "p16", { writable: false });
+writeSome(objects[5], -10);
+print("read-only p16: " + objects[5].p16 + ", p0 next to it: " + objects[5].p0);
+objects[5].p0 = 5000;
+objects[5].p32 = 5032;
+
+// Change a prototype property and shadow it on another prototype
+protos[1].fromProto = "changed";
+Object.defineProperty(protos[2], "fromProto", { get: function () { return "getter"; }, configurable: true });
+readShapes("prototype changes", 2);
+
+// A property that was missing shows up on the prototype, and then on Object.prototype
+protos[3].notThere = "now on proto 3";
+Object.prototype.notThere = "now on Object.prototype";
+readShapes("missing property added", 2);
+delete Object.prototype.notThere;
+delete protos[3].notThere;
+delete protos[2].fromProto;
+protos[2].fromProto = "proto2";
+protos[1].fromProto = "proto1";
+readShapes("after restoring the prototypes", 2);
+
+// Deleting a property changes the type of the object
+delete objects[7].p13;
+print("deleted p13: " + readAll(objects[7])[2]);
+objects[7].p13 = 7013;
+
+// Collect the old shapes, and make new ones that may get their memory
+for (var round = 0; round < 3; round++) {
+    objects = [];
+    collect();
+    for (var shape = 0; shape < SHAPES; shape++) {
+        objects.push(makeObject(shape, protos[shape % protos.length]));
+    }
+    readShapes("after collection " + round, 5);
+}
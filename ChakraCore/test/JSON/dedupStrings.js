@@ -0,0 +1,96 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with -DedupStrings: JSON.parse values that survive collections have their buffers shared with an
+// equal canonical string. The values must read the same before and after.
+
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+function makePayload(count) {
+    const records = [];
+    for (let i = 0; i < count; i++) {
+        records.push({
+            status: i % 3 === 0 ? "status-active" : "status-disabled",
+            url: "https://example.com/api/v1/items/" + (i % 5),
+            owner: i % 2 === 0 ? "José Müller" : "東京都 渋谷区",
+            unique: "record-number-" + i
+        });
+    }
+    return JSON.stringify(records);
+}
+
+function collect() {
+    // Candidates are processed once they have survived two collections
+    CollectGarbage();
+    CollectGarbage();
+    CollectGarbage();
+}
+
+function check(records, count, message) {
+    assert.areEqual(count, records.length, message);
+    for (let i = 0; i < count; i++) {
+        const r = records[i];
+        assert.areEqual(i % 3 === 0 ? "status-active" : "status-disabled", r.status, message + " status " + i);
+        assert.areEqual("https://example.com/api/v1/items/" + (i % 5), r.url, message + " url " + i);
+        assert.areEqual(i % 2 === 0 ? "José Müller" : "東京都 渋谷区", r.owner, message + " owner " + i);
+        assert.areEqual("record-number-" + i, r.unique, message + " unique " + i);
+    }
+}
+
+const tests = [
+    {
+        name: "Duplicate values read the same after collections",
+        body: function () {
+            const records = JSON.parse(makePayload(500));
+            check(records, 500, "before");
+            collect();
+            check(records, 500, "after");
+        }
+    },
+    {
+        name: "Widened one-byte values and substrings of them survive deduplication",
+        body: function () {
+            const records = JSON.parse(makePayload(200));
+            // Force UTF-16 buffers for the one-byte values and keep slices that point into them
+            const slices = records.map(r => r.url.substring(8, 19) + r.status.slice(7));
+            const joined = records.map(r => r.url + r.status).join("|");
+            collect();
+            records.forEach((r, i) => {
+                assert.areEqual("example.com" + (i % 3 === 0 ? "active" : "disabled"), slices[i], "slice " + i);
+            });
+            assert.areEqual(joined, records.map(r => r.url + r.status).join("|"), "joined");
+        }
+    },
+    {
+        name: "Dropping some holders doesn't affect the others",
+        body: function () {
+            let first = JSON.parse(makePayload(100));
+            const second = JSON.parse(makePayload(100));
+            collect();
+            first = null;
+            collect();
+            check(second, 100, "second after first was dropped");
+            const third = JSON.parse(makePayload(100));
+            collect();
+            check(third, 100, "third");
+            check(second, 100, "second");
+        }
+    },
+    {
+        name: "Deduplicated values work as property keys and in comparisons",
+        body: function () {
+            const records = JSON.parse(makePayload(50));
+            collect();
+            const counts = {};
+            records.forEach(r => { counts[r.status] = (counts[r.status] || 0) + 1; });
+            assert.areEqual(17, counts["status-active"]);
+            assert.areEqual(33, counts["status-disabled"]);
+            assert.isTrue(records[0].url === records[5].url);
+            assert.isTrue(records[0].url !== records[1].url);
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,23 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// -DedupStrings -trace:StringDedup prints a line for every JSON.parse value whose buffer was shared with an equal
+// canonical value. The first of four equal values becomes canonical, the other three give up their buffers.
+
+var records = JSON.parse(
+    '[{"status":"status-active","url":"https://example.com/a","id":"record-number-0"},' +
+    '{"status":"status-active","url":"https://example.com/a","id":"record-number-1"},' +
+    '{"status":"status-active","url":"https://example.com/a","id":"record-number-2"},' +
+    '{"status":"status-active","url":"https://example.com/a","id":"record-number-3"},' +
+    '{"status":"short","url":"https://example.com/b","id":"record-number-4"}]');
+
+// Candidates are processed once they have survived two collections
+CollectGarbage();
+CollectGarbage();
+CollectGarbage();
+
+for (var i = 0; i < records.length; i++) {
+    WScript.Echo(records[i].status + " " + records[i].url + " " + records[i].id);
+}
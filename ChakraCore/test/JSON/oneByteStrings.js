@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// String values produced by JSON.parse are stored one byte per character when they fit in Latin-1.
+// These tests make sure the one-byte representation behaves exactly like a UTF-16 string.
+
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+const tests = [
+    {
+        name: "ASCII and Latin-1 values round trip",
+        body: function () {
+            const o = JSON.parse('{"a":"hello world","b":"café crème","c":"\\u00ff\\u0080x","d":"snow ☃ man"}');
+            assert.areEqual("hello world", o.a);
+            assert.areEqual("café crème", o.b);
+            assert.areEqual("ÿ\u0080x", o.c);
+            assert.areEqual("snow ☃ man", o.d);
+            assert.areEqual(11, o.a.length);
+            assert.areEqual(JSON.stringify(o), '{"a":"hello world","b":"café crème","c":"ÿ\u0080x","d":"snow ☃ man"}');
+        }
+    },
+    {
+        name: "Character access does not sign-extend Latin-1 characters",
+        body: function () {
+            const s = JSON.parse('"aéÿz"');
+            assert.areEqual(0x61, s.charCodeAt(0));
+            assert.areEqual(0xe9, s.charCodeAt(1));
+            assert.areEqual(0xff, s.charCodeAt(2));
+            assert.areEqual("ÿ", s.charAt(2));
+            assert.areEqual("é", s[1]);
+            assert.areEqual(0xff, s.codePointAt(2));
+        }
+    },
+    {
+        name: "Concatenation and substrings of one-byte strings",
+        body: function () {
+            const o = JSON.parse('["abc","déf"]');
+            const joined = o[0] + o[1];
+            assert.areEqual("abcdéf", joined);
+            assert.areEqual(6, joined.length);
+            assert.areEqual(0xe9, joined.charCodeAt(4));
+            assert.areEqual("cdé", joined.substring(2, 5));
+            assert.areEqual("dé", joined.slice(3, 5));
+            assert.areEqual("éf", joined.substr(4));
+            assert.areEqual("x" + joined + "☃", "xabcdéf☃");
+
+            let long = "";
+            for (let i = 0; i < 100; i++) {
+                long += o[1];
+            }
+            assert.areEqual(300, long.length);
+            assert.areEqual(0xe9, long.charCodeAt(298));
+        }
+    },
+    {
+        name: "Equality and property keys",
+        body: function () {
+            const o = JSON.parse('{"k1":"keyé","k2":"keyé","k3":"keyè"}');
+            assert.isTrue(o.k1 === o.k2);
+            assert.isFalse(o.k1 === o.k3);
+            assert.isTrue(o.k1 === "keyé");
+
+            const target = {};
+            target[o.k1] = 1;
+            target["keyé"]++;
+            assert.areEqual(2, target[o.k2]);
+            assert.isTrue(o.k3 in Object.assign(target, { "keyè": 3 }));
+
+            const m = new Map([[o.k1, "v"]]);
+            assert.areEqual("v", m.get("keyé"));
+        }
+    },
+    {
+        name: "Builtins that need the UTF-16 buffer",
+        body: function () {
+            const s = JSON.parse('"  Hello, Wörld  "');
+            assert.areEqual("Hello, Wörld", s.trim());
+            assert.areEqual("  HELLO, WÖRLD  ", s.toUpperCase());
+            assert.areEqual(9, s.indexOf("W"));
+            assert.areEqual(["  Hello", " Wörld  "], s.split(","));
+            assert.areEqual("  Hello, Welt  ", s.replace(/Wörld/, "Welt"));
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
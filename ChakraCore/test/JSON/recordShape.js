@@ -0,0 +1,151 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Arrays of records: after two object elements with the same layout, JSON.parse creates the following
+// elements with that layout directly. Elements that turn out different must still come out exactly as
+// the reviver (token parser) path builds them, with the same keys in the same order.
+
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+function identity(key, value) {
+    return value;
+}
+
+function describe(value) {
+    // JSON.stringify keeps key order, which is what a wrong layout would get wrong
+    return JSON.stringify(value, function (key, v) {
+        if (v !== null && typeof v === "object" && !Array.isArray(v)) {
+            return { keys: Object.keys(v).join(","), proto: Object.getPrototypeOf(v) === Object.prototype, values: Object.keys(v).map(function (k) { return v[k]; }) };
+        }
+        return v;
+    });
+}
+
+function checkSame(text, message) {
+    var indexed = JSON.parse(text);
+    assert.areEqual(describe(JSON.parse(text, identity)), describe(indexed), message);
+    return indexed;
+}
+
+function record(i) {
+    return '{"id":' + i + ',"name":"n' + i + '","active":' + (i % 2 === 0) + ',"tags":["a","b"]}';
+}
+
+function array(elements) {
+    return "[" + elements.join(",") + "]";
+}
+
+var tests = [
+    {
+        name: "Homogeneous records",
+        body: function () {
+            var elements = [];
+            for (var i = 0; i < 1000; i++) {
+                elements.push(record(i));
+            }
+            var parsed = checkSame(array(elements), "records");
+            assert.areEqual(1000, parsed.length);
+            assert.areEqual("n999", parsed[999].name);
+            assert.areEqual("id,name,active,tags", Object.keys(parsed[500]).join(","));
+            parsed[500].extra = 1;
+            delete parsed[501].name;
+            assert.areEqual("id,name,active,tags,extra", Object.keys(parsed[500]).join(","));
+            assert.areEqual("id,active,tags", Object.keys(parsed[501]).join(","));
+            assert.areEqual("n502", parsed[502].name);
+        }
+    },
+    {
+        name: "Elements that don't match the learned layout",
+        body: function () {
+            var odd = [
+                '{}',
+                '{"name":"first member differs","id":1,"active":true,"tags":[]}',
+                '{"id":2,"active":false,"name":"middle member differs","tags":[]}',
+                '{"id":3,"name":"last member differs","active":true,"other":[]}',
+                '{"id":4,"name":"fewer members"}',
+                '{"id":5}',
+                '{"id":6,"name":"more members","active":true,"tags":[],"extra":{"x":1}}',
+                '{"id":7,"name":"duplicate","active":true,"tags":[],"id":8}',
+                '{"id":9,"name":"numeric key","active":true,"tags":[],"0":"zero"}',
+                '{"0":"numeric first","id":10,"name":"x","active":true,"tags":[]}',
+                '{"i\\u0064":11,"name":"escaped name","active":true,"tags":[]}',
+                '{"id":12,"name":"escaped \\"value\\"","active":true,"tags":[]}',
+                '{"id":13,"name":"another object","active":{"id":1,"name":"n","active":true,"tags":[]},"tags":[]}',
+                '[1,2]', '"string"', '12', 'null'
+            ];
+            odd.forEach(function (element, i) {
+                // Learn from two records, miss, then carry on with records
+                var text = array([record(0), record(1), record(2), element, record(3), record(4), record(5), record(6)]);
+                checkSame(text, "element " + i + ": " + element);
+            });
+        }
+    },
+    {
+        name: "Repeated misses stop the prediction but not the parse",
+        body: function () {
+            var elements = [];
+            for (var i = 0; i < 200; i++) {
+                elements.push(i % 3 === 0 ? '{"id":' + i + ',"kind":"other"}' : record(i));
+            }
+            var parsed = checkSame(array(elements), "alternating layouts");
+            assert.areEqual("other", parsed[198].kind);
+            assert.areEqual("n199", parsed[199].name);
+        }
+    },
+    {
+        name: "Nested arrays of records and records of records",
+        body: function () {
+            var rows = [];
+            for (var i = 0; i < 100; i++) {
+                rows.push('{"row":' + i + ',"cells":' + array([record(i), record(i + 1), record(i + 2), i % 10 === 0 ? "{}" : record(i + 3)]) +
+                    ',"owner":' + record(i) + '}');
+            }
+            var parsed = checkSame(array(rows), "nested");
+            assert.areEqual(99 + 3, parsed[99].cells[3].id);
+            assert.areEqual("n42", parsed[42].owner.name);
+            assert.areEqual(0, Object.keys(parsed[40].cells[3]).length);
+        }
+    },
+    {
+        name: "Many members, shared names in different orders",
+        body: function () {
+            function wide(i, reversed) {
+                var members = [];
+                for (var m = 0; m < 40; m++) {
+                    members.push('"field' + m + '":' + (i * 40 + m));
+                }
+                if (reversed) {
+                    members.reverse();
+                }
+                return "{" + members.join(",") + "}";
+            }
+            var elements = [];
+            for (var i = 0; i < 60; i++) {
+                elements.push(wide(i, i % 20 === 19));
+            }
+            var parsed = checkSame(array(elements), "wide records");
+            assert.areEqual(59 * 40 + 39, parsed[59].field39);
+            assert.areEqual("field39", Object.keys(parsed[19])[0]);
+            assert.areEqual("field0", Object.keys(parsed[20])[0]);
+        }
+    },
+    {
+        name: "Syntax errors inside predicted records",
+        body: function () {
+            ['{"id":1,"name":"x","active":true,"tags":[]', '{"id":1,"name":"x","active":true,"tags":[],}', '{"id":1 "name":"x"}',
+             '{"id":1,"name":"x","active":true,"tags":[] "extra":1}', '{"id":1,"name":"x",}', '{"id":}', '{"id"}', '{1}', '{,}']
+                .forEach(function (element) {
+                    var text = array([record(0), record(1), record(2), element, record(3)]);
+                    var indexedError, tokenError;
+                    try { JSON.parse(text); } catch (e) { indexedError = e.message; }
+                    try { JSON.parse(text, identity); } catch (e) { tokenError = e.message; }
+                    assert.isTrue(tokenError !== undefined, "token parser rejects " + element);
+                    assert.areEqual(tokenError, indexedError, element);
+                });
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
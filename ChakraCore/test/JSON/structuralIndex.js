@@ -0,0 +1,143 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Inputs longer than 50 characters without a reviver are parsed from the structural index; with a reviver
+// they go through the token parser. Both must produce the same values and the same errors, in particular
+// around the 64 character blocks the index is built from.
+
+WScript.LoadScriptFile("../UnitTestFramework/UnitTestFramework.js");
+
+function identity(key, value) {
+    return value;
+}
+
+function parseBoth(text) {
+    var indexed, tokens;
+    try {
+        indexed = { value: JSON.stringify(JSON.parse(text)) };
+    } catch (e) {
+        indexed = { error: e.constructor.name + ": " + e.message };
+    }
+    try {
+        tokens = { value: JSON.stringify(JSON.parse(text, identity)) };
+    } catch (e) {
+        tokens = { error: e.constructor.name + ": " + e.message };
+    }
+    return { indexed: indexed, tokens: tokens };
+}
+
+function checkSame(text, message) {
+    var result = parseBoth(text);
+    assert.areEqual(result.tokens.error, result.indexed.error, "error: " + message);
+    assert.areEqual(result.tokens.value, result.indexed.value, "value: " + message);
+    return result.indexed;
+}
+
+function pad(count) {
+    return new Array(count + 1).join(" ");
+}
+
+var tests = [
+    {
+        name: "Records with escapes, numbers and literals at every block offset",
+        body: function () {
+            var record = '{"id":-12.5e1,"name":"a\\"b\\\\c\\u00e9\\n","ok":true,"no":false,"nil":null,"list":[1,[],{}]}';
+            for (var offset = 0; offset < 70; offset++) {
+                var text = pad(offset) + "[" + record + "," + record + "]" + pad(offset % 3);
+                var result = checkSame(text, "offset " + offset);
+                assert.isTrue(result.value !== undefined, "parses at offset " + offset);
+            }
+        }
+    },
+    {
+        name: "Values parse the same as with a reviver",
+        body: function () {
+            var records = [];
+            for (var i = 0; i < 300; i++) {
+                records.push({
+                    index: i,
+                    negative: -i,
+                    fraction: i / 8,
+                    big: i * 1e21,
+                    name: "item \"" + i + "\"\t" + "\u6771\u4eac".repeat(i % 3),
+                    nested: { a: [i, "x", null], "": i % 2 === 0, "0": "numeric key", ["__proto__"]: "data" }
+                });
+            }
+            var text = JSON.stringify(records);
+            checkSame(text, "records");
+            checkSame(JSON.stringify(records, null, "\t"), "indented records");
+
+            var parsed = JSON.parse(text);
+            assert.areEqual(300, parsed.length);
+            assert.areEqual("item \"7\"\t\u6771\u4eac", parsed[7].name);
+            assert.areEqual("numeric key", parsed[7].nested["0"]);
+            assert.areEqual(Object.prototype, Object.getPrototypeOf(parsed[7].nested), "__proto__ is an own data property");
+            assert.areEqual("data", Object.getOwnPropertyDescriptor(parsed[7].nested, "__proto__").value);
+        }
+    },
+    {
+        name: "Strings crossing block boundaries",
+        body: function () {
+            for (var length = 55; length < 140; length++) {
+                var plain = "x".repeat(length);
+                checkSame('["' + plain + '", "' + plain + '"]', "plain " + length);
+                // A backslash run ending at each position, followed by an escaped or a closing quote
+                var escaped = "y".repeat(length) + "\\\\\\\\\\\"z";
+                checkSame('{"k":"' + escaped + '","k2":"' + escaped + '"}', "escaped " + length);
+                assert.areEqual("y".repeat(length) + "\\\\\"z", JSON.parse('{"k":"' + escaped + '","pad":"' + plain + '"}').k);
+            }
+        }
+    },
+    {
+        name: "Duplicate keys and type cache reuse",
+        body: function () {
+            var text = "[" + new Array(50).join('{"a":1,"b":2,"a":3},{"b":1,"a":2},') + '{"a":{"a":{"a":1}}}]';
+            var parsed = JSON.parse(text);
+            checkSame(text, "duplicates");
+            assert.areEqual(3, parsed[0].a);
+            assert.areEqual("a,b", Object.keys(parsed[0]).join(","));
+            assert.areEqual(1, parsed[parsed.length - 1].a.a.a);
+        }
+    },
+    {
+        name: "Syntax errors match the token parser",
+        body: function () {
+            var prefix = '{"padding":"' + "p".repeat(60) + '","value":';
+            [
+                "1x}", "- 1}", "-}", "1 2}", "tru}", "truex}", "nul}", "[1,]}", "[,1]}", "{,}}", "{\"a\" 1}}",
+                "\"a\"\"b\"}", "\"a\"1}", "01}", "1.}", "\"\\x\"}", "\"\\u12g4\"}", "\"abc", "\"a\u0001b\"}", "\"a\tb\"}",
+                "\u00e9}", "\\\"a\"}", "[1 2]}", "1}}", "1} x", "1}\u0000 junk", "[]\u0000", "1}\u000b", "\"\\", "{\"a\":1,}}"
+            ].forEach(function (tail) {
+                checkSame(prefix + tail, JSON.stringify(tail));
+            });
+        }
+    },
+    {
+        name: "Top level values and whitespace",
+        body: function () {
+            checkSame(pad(60), "only whitespace");
+            checkSame(pad(60) + "12345" + pad(60), "number");
+            checkSame(pad(60) + "\"str\"" + "\r\n\t".repeat(20), "string");
+            checkSame(pad(60) + "null", "null");
+            checkSame(pad(60) + "[]" + pad(60), "empty array");
+            checkSame("\n".repeat(100) + "{}", "empty object");
+        }
+    },
+    {
+        name: "Deep nesting",
+        body: function () {
+            var depth = 500;
+            var text = new Array(depth + 1).join('{"a":[') + "1" + new Array(depth + 1).join("]}");
+            checkSame(text, "nested");
+            var value = JSON.parse(text);
+            for (var i = 0; i < depth; i++) {
+                value = value.a[0];
+            }
+            assert.areEqual(1, value);
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,69 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Conditional throws in jitted functions. Each function throws on its first, interpreted call, so that the
+// throwing block is profiled, and is jitted on its second call. A throwing block of plain instructions is
+// moved to the helper blocks; one with an inlined callee or an instruction that can bail out stays in place.
+// The functions must return and throw the same with -off:ColdPathLayout. The calls are made from global code,
+// which is not jitted, so that the functions are not inlined into their caller.
+
+function checkPlain(x, error) {
+    if (x < 0) {
+        throw error;
+    }
+    return x * 2;
+}
+
+function describe(x) {
+    return "negative " + x;
+}
+
+function checkInlinedCallee(x) {
+    if (x < 0) {
+        throw describe(x);
+    }
+    return x * 2;
+}
+
+function checkField(x, info) {
+    if (x < 0) {
+        throw info.message;
+    }
+    return x * 2;
+}
+
+var inputs = [-1, 0, 1, 2, -5];
+var plainError = "plain error";
+var info = { message: "field error" };
+
+var results = [];
+for (var i = 0; i < inputs.length; i++) {
+    try {
+        results.push(checkPlain(inputs[i], plainError));
+    } catch (e) {
+        results.push("threw " + e);
+    }
+}
+print("checkPlain: " + results.join(", "));
+
+results = [];
+for (var i = 0; i < inputs.length; i++) {
+    try {
+        results.push(checkInlinedCallee(inputs[i]));
+    } catch (e) {
+        results.push("threw " + e);
+    }
+}
+print("checkInlinedCallee: " + results.join(", "));
+
+results = [];
+for (var i = 0; i < inputs.length; i++) {
+    try {
+        results.push(checkField(inputs[i], info));
+    } catch (e) {
+        results.push("threw " + e);
+    }
+}
+print("checkField: " + results.join(", "));
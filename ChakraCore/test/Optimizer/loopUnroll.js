@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loops that ran at least 64 iterations in the interpreter have their body repeated before the back edge by the
+// full JIT, with each copy keeping the exit test. The first call of each function runs its loop long enough in
+// the interpreter, and the second call jits it, which prints the LoopUnroll trace. The later calls use trip counts
+// that are not a multiple of the unroll factor, leave early, and bail out of every copy of the body. The output
+// must not change with another unroll factor.
+
+function sumArray(a, n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += a[i];
+    }
+    return sum;
+}
+
+function dot(x, y) {
+    var sum = 0;
+    for (var i = 0; i < x.length; i++) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+
+function indexOf(a, value) {
+    var found = -1;
+    for (var i = 0; i < a.length; i++) {
+        if (a[i] === value) {
+            found = i;
+            break;
+        }
+    }
+    return found;
+}
+
+function countEven(a, n) {
+    var even = 0, odd = 0;
+    for (var i = 0; i < n; i++) {
+        if (a[i] & 1) {
+            odd++;
+        } else {
+            even++;
+        }
+    }
+    return even + " " + odd;
+}
+
+function countDown(n) {
+    var sum = 0;
+    while (n > 0) {
+        sum += n;
+        n -= 3;
+    }
+    return sum;
+}
+
+function skipMultiples(n, k) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        if (i % k === 0) {
+            continue;
+        }
+        sum += i;
+    }
+    return sum;
+}
+
+// Stores to an array are left to MemOp
+function prefixSums(a, n) {
+    var out = new Array(n);
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += a[i];
+        out[i] = sum;
+    }
+    return out[n - 1];
+}
+
+var ints = [];
+var x = [];
+var y = [];
+for (var i = 0; i < 200; i++) {
+    ints.push((i * 7919) % 1000);
+    x.push(i / 4);
+    y.push(100 - i);
+}
+x.length = y.length = 101;
+
+var tripCounts = [199, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 63, 64, 65, 100, 101, 102, 103];
+for (var t = 0; t < tripCounts.length; t++) {
+    var n = tripCounts[t];
+    print(n + ": " + sumArray(ints, n) + ", " + indexOf(ints, ints[n]) + ", " + countEven(ints, n) + ", " +
+        countDown(n) + ", " + skipMultiples(n, 3) + ", " + prefixSums(ints, n) + ", " + dot(x, y));
+}
+print("not found: " + indexOf(ints, -1));
+
+// Bail out of the jitted loop at each position of the unrolled body
+for (var k = 0; k < 8; k++) {
+    var mixed = ints.slice(0, 100);
+    mixed[40 + k] = "s";
+    var withString = sumArray(mixed, 100);
+    mixed[40 + k] = 0.5;
+    var withDouble = sumArray(mixed, 100);
+    var holes = ints.slice(0, 100);
+    delete holes[50 + k];
+    print("bailout at " + k + ": " + withString.slice(0, 10) + "... " + withDouble + " " + sumArray(holes, 100));
+}
+print("after bailouts: " + sumArray(ints, 150));
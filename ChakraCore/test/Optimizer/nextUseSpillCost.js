@@ -0,0 +1,136 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loops with more live values than there are registers, so that the register allocator has to spill some of
+// them and reload them at their next use. The first call of each function runs in the interpreter and the
+// second one jits it, which prints the NextUseSpillCost trace for the functions that spend most of their byte
+// code in loops. The values are used at the top of the loop, at the bottom, only after the loop, across calls
+// and across bailouts, and must not change with -off:NextUseSpillCost.
+
+function manyInts(n) {
+    var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8;
+    var j = 9, k = 10, l = 11, m = 12, o = 13, p = 14, q = 15, r = 16, s = 17;
+    for (var i = 0; i < n; i++) {
+        a = (a + b) | 0;
+        b = (b ^ c) + i | 0;
+        c = (c + d * 3) | 0;
+        d = (d - e) | 0;
+        e = (e + f) & 0xffff;
+        f = (f + g + i) | 0;
+        g = (g * 5 + h) | 0;
+        h = (h + j) | 0;
+        j = (j + k) ^ i;
+        k = (k + l) | 0;
+        l = (l - m) | 0;
+        m = (m + o) & 0xfffff;
+        o = (o + p) | 0;
+        p = (p + q + a) | 0;
+    }
+    // q, r and s are only used after the loop
+    return [a, b, c, d, e, f, g, h, j, k, l, m, o, p, q + r + s].join();
+}
+
+function manyDoubles(x, n) {
+    var a = x, b = x * 2, c = x * 3, d = x * 4, e = x * 5, f = x * 6, g = x * 7, h = x * 8;
+    var j = x * 9, k = x * 10, l = x * 11, m = x * 12, o = x * 13, p = x * 14, q = x * 15, r = x * 16, s = x * 17;
+    for (var i = 0; i < n; i++) {
+        a += b * 0.5;
+        b += c * 0.25;
+        c += d * 0.125;
+        d += e * 0.5;
+        e += f * 0.25;
+        f += g * 0.125;
+        g += h * 0.5;
+        h += j * 0.25;
+        j += k * 0.125;
+        k += l * 0.5;
+        l += m * 0.25;
+        m += o * 0.125;
+        o += p * 0.5;
+        p += q * 0.25;
+        q += r * 0.125;
+        r += s * 0.5;
+        s += a * 0.25;
+    }
+    return a + b + c + d + e + f + g + h + j + k + l + m + o + p + q + r + s;
+}
+
+function id(v) {
+    return v;
+}
+
+function acrossCalls(n) {
+    var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8, j = 9, k = 10;
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        sum = (sum + id(a) + b) | 0;
+        a = (a + c) | 0;
+        c = (c + id(d) + e) | 0;
+        e = (e ^ f) + g | 0;
+        g = (g + h + id(j)) | 0;
+        j = (j + k + i) | 0;
+    }
+    return [sum, a, b, c, d, e, f, g, h, j, k].join();
+}
+
+function withBailout(arr, n) {
+    var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8, j = 9, k = 10, l = 11;
+    for (var i = 0; i < n; i++) {
+        var v = arr[i];
+        a = a + v;
+        b = b + a;
+        c = c + b;
+        d = d + c;
+        e = e + d;
+        f = f + e;
+        g = g + f;
+        h = h + g;
+        j = j + h;
+        k = k + j;
+        l = l + k;
+    }
+    return [a, b, c, d, e, f, g, h, j, k, l].join();
+}
+
+function nested(n) {
+    var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8, j = 9, k = 10, l = 11, m = 12;
+    for (var i = 0; i < n; i++) {
+        a = (a + m) | 0;
+        for (var x = 0; x < 4; x++) {
+            b = (b + c + x) | 0;
+            c = (c ^ d) | 0;
+            d = (d + e) | 0;
+            e = (e + f) | 0;
+            f = (f + g) & 0xffff;
+            g = (g + h) | 0;
+            h = (h + j) | 0;
+            j = (j + k) | 0;
+        }
+        k = (k + l + a) | 0;
+        l = (l + i) | 0;
+    }
+    return [a, b, c, d, e, f, g, h, j, k, l, m].join();
+}
+
+var ints = [];
+for (var i = 0; i < 100; i++) {
+    ints.push((i * 7919) % 1000);
+}
+
+for (var round = 0; round < 2; round++) {
+    print("manyInts: " + manyInts(100) + " / " + manyInts(0) + " / " + manyInts(7));
+    print("manyDoubles: " + manyDoubles(0.5, 100) + " / " + manyDoubles(-3, 13));
+    print("acrossCalls: " + acrossCalls(100) + " / " + acrossCalls(3));
+    print("withBailout: " + withBailout(ints, 100));
+    print("nested: " + nested(50) + " / " + nested(1));
+}
+
+// Bail out of the jitted loop with a double and a string in the array
+var mixed = ints.slice();
+mixed[60] = 0.5;
+print("withBailout with a double: " + withBailout(mixed, 100));
+mixed[99] = "s";
+print("withBailout with a string: " + withBailout(mixed, 100));
+print("withBailout after bailouts: " + withBailout(ints, 100));
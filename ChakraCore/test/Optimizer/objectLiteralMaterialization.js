@@ -0,0 +1,29 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Bailouts that need an object literal removed by scalar replacement allocate it again. Each function is jitted
+// on its second call, which prints the ScalarReplacement trace: the bailouts that materialize the literal, and
+// the InitFlds and the allocation that are removed. The last calls bail out with a string.
+
+// The int conversion and the multiply bail out before the interpreter reads o.b
+function scaled(a, b) {
+    var o = { a: a, b: b };
+    var s = o.a * 3;
+    return s + " " + o.b;
+}
+
+// The int conversion and the add bail out after the first InitFld, before the second
+function bailOutInInitializer(a, b) {
+    var o = { a: a, b: b + 1 };
+    return o.a + o.b;
+}
+
+for (var i = 0; i < 2; i++) {
+    print("scaled: " + scaled(i + 4, 5));
+    print("bailOutInInitializer: " + bailOutInInitializer(i, 1));
+}
+
+print("scaled: " + scaled("4", 5));
+print("bailOutInInitializer: " + bailOutInInitializer(1, "x"));
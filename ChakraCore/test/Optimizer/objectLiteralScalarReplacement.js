@@ -0,0 +1,93 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Object literals that are only read through their fields are removed by the dead store pass along with their
+// InitFlds. Each function is called once in the interpreter and then jitted; the last calls pass values of other
+// types, which bail out of the jitted code. A bailout that needs a removed object allocates it again, so the
+// interpreter must see the same fields, and the same object in every register that held it. The output must not
+// change with -off:ScalarReplacement.
+
+function makePoint(x, y) {
+    return { x: x, y: y };
+}
+
+function lengthSquared(x, y) {
+    var p = makePoint(x, y);
+    return p.x * p.x + p.y * p.y;
+}
+
+function sumPairs(n) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) {
+        var pair = { first: i, second: i * 2 };
+        sum += pair.first + pair.second;
+    }
+    return sum;
+}
+
+// The bailout at the multiply needs the object, since the interpreter reads o.b after it
+function scaled(a, b) {
+    var o = { a: a, b: b };
+    var s = o.a * 3;
+    return s + " " + o.b;
+}
+
+// Both registers must get the same object back
+function aliased(a, b) {
+    var o = { a: a, b: b };
+    var p = o;
+    var s = o.a * 2;
+    return s + " " + (p === o) + " " + p.b;
+}
+
+// A bailout between the InitFlds sees the fields stored so far
+function bailOutInInitializer(a, b) {
+    var o = { a: a, b: b + 1 };
+    return o.a + o.b;
+}
+
+// The object escapes after its fields are read
+var escaped;
+function escapeLater(a, b) {
+    var o = { a: a, b: b };
+    var s = o.a + o.b;
+    escaped = o;
+    return s;
+}
+
+// A getter in the literal sees the object
+function withGetter(a) {
+    var o = { a: a, get twice() { return this.a * 2; } };
+    return o.twice;
+}
+
+// The literal's field is overwritten before it is read
+function overwritten(a, b) {
+    var o = { a: a };
+    o.a = b;
+    return o.a;
+}
+
+for (var i = 0; i < 2; i++) {
+    print("lengthSquared: " + lengthSquared(i + 2, 3));
+    print("sumPairs: " + sumPairs(10));
+    print("scaled: " + scaled(i + 4, 5));
+    print("aliased: " + aliased(i + 4, 5));
+    print("bailOutInInitializer: " + bailOutInInitializer(i, 1));
+    print("escapeLater: " + escapeLater(i, 1) + " " + escaped.a + " " + escaped.b);
+    print("withGetter: " + withGetter(i + 1));
+    print("overwritten: " + overwritten(i, 7));
+}
+
+// Values of other types and overflows bail out of the jitted code
+print("lengthSquared: " + lengthSquared(0.5, 0.5));
+print("sumPairs: " + sumPairs(10.5));
+print("scaled: " + scaled("4", 5));
+print("scaled: " + scaled(0x40000000, 5));
+print("aliased: " + aliased("4", 5));
+print("aliased: " + aliased(0x40000000, 5));
+print("bailOutInInitializer: " + bailOutInInitializer(1, "x"));
+print("bailOutInInitializer: " + bailOutInInitializer(1, 0x7fffffff));
+print("escapeLater: " + escapeLater("a", "b") + " " + escaped.a + " " + escaped.b);
@@ -0,0 +1,16 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Run with tier-up cache files that can't be used: one cut off in its header, and one from another build.
+// Neither is read, and the script runs as it would without them. With -nonative nothing gets fully jitted,
+// so the files are not written over when the script context closes.
+
+WScript.LoadScriptFile("tierUpCacheScript.js");
+
+var total = 0;
+for (var i = 0; i < 20; i++) {
+    total += sumTo(i) + scale({ x: i, y: 1 }, 2).x;
+}
+print(total);
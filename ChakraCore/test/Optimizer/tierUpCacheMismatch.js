@@ -0,0 +1,28 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs after tierUpCacheRestore.js with a changed copy of tierUpCacheScript.js, loaded under the same url.
+// The functions have the same ids as the ones whose profiles were saved, but not the same source, so the
+// cached profiles are rejected. sumTo keeps its length and byte code count, and differs only in its source.
+
+WScript.LoadScript(
+    "function sumTo(n) {\n" +
+    "    var sum = 0;\n" +
+    "    for (var i = 1; i <= n; i++) {\n" +
+    "        sum -= i;\n" +
+    "    }\n" +
+    "    return sum;\n" +
+    "}\n" +
+    "\n" +
+    "function scale(point, factor) {\n" +
+    "    return { x: point.x / factor, y: point.y / factor, factor: factor };\n" +
+    "}\n",
+    "self", "tierUpCacheScript.js");
+
+var total = 0;
+for (var i = 0; i < 20; i++) {
+    total += sumTo(i) + scale({ x: i, y: 1 }, 2).x;
+}
+print(total);
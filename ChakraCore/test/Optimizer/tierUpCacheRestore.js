@@ -0,0 +1,15 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Runs after tierUpCacheSave.js. The functions of tierUpCacheScript.js get the profiles that run saved,
+// and their profiles are saved again when the script context closes.
+
+WScript.LoadScriptFile("tierUpCacheScript.js");
+
+var total = 0;
+for (var i = 0; i < 20; i++) {
+    total += sumTo(i) + scale({ x: i, y: 1 }, 2).x;
+}
+print(total);
@@ -0,0 +1,15 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Fully jits the functions of tierUpCacheScript.js, so that their profiles are saved to the tier-up cache file
+// when the script context closes. tierUpCacheRestore.js and tierUpCacheMismatch.js run next and read that file.
+
+WScript.LoadScriptFile("tierUpCacheScript.js");
+
+var total = 0;
+for (var i = 0; i < 20; i++) {
+    total += sumTo(i) + scale({ x: i, y: 1 }, 2).x;
+}
+print(total);
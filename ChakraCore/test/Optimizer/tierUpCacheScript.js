@@ -0,0 +1,18 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loaded by the tierUpCache tests. Its functions get fully jitted, so their profiles are kept in the tier-up cache.
+
+function sumTo(n) {
+    var sum = 0;
+    for (var i = 1; i <= n; i++) {
+        sum += i;
+    }
+    return sum;
+}
+
+function scale(point, factor) {
+    return { x: point.x * factor, y: point.y * factor };
+}
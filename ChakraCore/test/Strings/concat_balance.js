@@ -0,0 +1,129 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Deep binary concat trees are rebalanced into flat nodes as they grow, and substrings of an unflattened
+// tree only flatten the part of the tree they fall in. Check the contents survive both.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function piece(i) {
+    return "<li id=\"" + i + "\">item " + i + "</li>";
+}
+
+function prependAll(count) {
+    var s = "</ul>";
+    for (var i = count - 1; i >= 0; i--) {
+        s = piece(i) + s;
+    }
+    return "<ul>" + s;
+}
+
+function expected(count) {
+    var parts = ["<ul>"];
+    for (var i = 0; i < count; i++) {
+        parts.push(piece(i));
+    }
+    parts.push("</ul>");
+    return parts.join("");
+}
+
+function render(depth) {
+    // Nested template results, as produced by recursive server-side rendering
+    if (depth === 0) {
+        return `<span>${"leaf"}</span>`;
+    }
+    var inner = render(depth - 1);
+    return `<div class="d${depth}">${inner}${inner}</div>`;
+}
+
+var tests = [
+    {
+        name: "Prepending in a loop past the depth limit keeps the content",
+        body: function () {
+            [1, 2, 127, 128, 129, 130, 255, 256, 257, 1000, 5000].forEach(function (count) {
+                var s = prependAll(count);
+                var e = expected(count);
+                assert.areEqual(e.length, s.length, "length for " + count);
+                assert.areEqual(e, s, "content for " + count);
+            });
+        }
+    },
+    {
+        name: "Substrings of an unflattened tree",
+        body: function () {
+            var count = 700;
+            var e = expected(count);
+            for (var start = 0; start < e.length; start += 97) {
+                for (var length = 0; length < 80; length += 13) {
+                    // Fresh tree each time so the root is still unflattened when the substring is taken
+                    var s = prependAll(count);
+                    assert.areEqual(e.substring(start, start + length), s.substring(start, start + length), "substring(" + start + ", " + length + ")");
+                    assert.areEqual(e.slice(start, start + length), s.slice(start, start + length), "slice(" + start + ", " + length + ")");
+                    assert.areEqual(e.substr(start, length), s.substr(start, length), "substr(" + start + ", " + length + ")");
+                }
+            }
+        }
+    },
+    {
+        name: "Several substrings from one tree, then the whole string",
+        body: function () {
+            var s = prependAll(300);
+            var e = expected(300);
+            var parts = [];
+            for (var i = 0; i < e.length; i += 50) {
+                parts.push(s.substring(i, i + 50));
+            }
+            assert.areEqual(e, parts.join(""), "joined substrings");
+            assert.areEqual(e, s, "whole string after substrings");
+            assert.areEqual(e.charAt(1234), s.charAt(1234), "charAt after substrings");
+        }
+    },
+    {
+        name: "Substrings of nested template results",
+        body: function () {
+            var s = render(8);
+            var flat = (" " + s).substring(1);
+            assert.areEqual(flat.length, s.length);
+            for (var start = 0; start < flat.length; start += 331) {
+                var t = render(8);
+                assert.areEqual(flat.substring(start, start + 17), t.substring(start, start + 17), "template substring at " + start);
+                assert.areEqual(flat.substring(start, start + 1), t.substring(start, start + 1), "one character at " + start);
+            }
+            assert.areEqual("<div class=\"d8\"><div class=\"d7\">", s.substring(0, 32));
+        }
+    },
+    {
+        name: "Reaching the depth limit after a node in the middle of the chain was flattened",
+        body: function () {
+            var s = "</ul>";
+            var o = {};
+            for (var i = 199; i >= 0; i--) {
+                s = piece(i) + s;
+                if (i === 150) {
+                    // Using the string as a property name flattens the tree built so far
+                    o[s] = i;
+                }
+            }
+            var e = expected(200);
+            assert.areEqual(e, "<ul>" + s);
+            var suffix = e.substring(e.indexOf(piece(150)));
+            assert.areEqual(suffix, Object.keys(o)[0], "flattened part of the chain");
+            assert.areEqual(150, o[suffix]);
+        }
+    },
+    {
+        name: "Appending and prepending around a rebalanced tree",
+        body: function () {
+            var s = prependAll(400);
+            var t = "[" + s + "]";
+            var u = t + t;
+            var e = "[" + expected(400) + "]";
+            assert.areEqual(e + e, u);
+            assert.areEqual(e.substring(10, 500), t.substring(10, 500));
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,114 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// indexOf/includes/lastIndexOf/split compare several candidate positions per step. Check matches
+// at every offset around the step boundaries, for needles on both sides of the Boyer-Moore cutoff.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function filler(length, ch) {
+    var s = "";
+    for (var i = 0; i < length; i++) {
+        s += ch;
+    }
+    return s;
+}
+
+function naiveIndexOf(hay, needle, from) {
+    for (var i = from; i + needle.length <= hay.length; i++) {
+        if (hay.substr(i, needle.length) === needle) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+function naiveLastIndexOf(hay, needle, from) {
+    for (var i = Math.min(from, hay.length - needle.length); i >= 0; i--) {
+        if (hay.substr(i, needle.length) === needle) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+var needles = [
+    "x", "xy", "x_y", "abcdefgh", "aéb", "東京",
+    "0123456789abcdefghijklmnopqrstu",      // 31, anchored search
+    "0123456789abcdefghijklmnopqrstuv",     // 32, jump table
+    "0123456789abcdefghijklmnopqrstuvwxyz!" // 37, jump table
+];
+
+var tests = [
+    {
+        name: "indexOf and includes find the needle at every position",
+        body: function () {
+            needles.forEach(function (needle) {
+                for (var position = 0; position < 40; position++) {
+                    var hay = filler(position, "-") + needle + filler(40 - position, "-");
+                    assert.areEqual(position, hay.indexOf(needle), "indexOf '" + needle + "' at " + position);
+                    assert.isTrue(hay.includes(needle), "includes '" + needle + "' at " + position);
+                    assert.areEqual(-1, hay.indexOf(needle, position + 1), "indexOf '" + needle + "' after " + position);
+                    assert.isFalse(hay.includes(needle, position + 1), "includes '" + needle + "' after " + position);
+                }
+            });
+        }
+    },
+    {
+        name: "lastIndexOf finds the needle at every position",
+        body: function () {
+            needles.forEach(function (needle) {
+                for (var position = 0; position < 40; position++) {
+                    var hay = filler(position, "-") + needle + filler(40 - position, "-");
+                    assert.areEqual(position, hay.lastIndexOf(needle), "lastIndexOf '" + needle + "' at " + position);
+                    assert.areEqual(position, hay.lastIndexOf(needle, position), "lastIndexOf '" + needle + "' from " + position);
+                    if (position > 0) {
+                        assert.areEqual(-1, hay.lastIndexOf(needle, position - 1), "lastIndexOf '" + needle + "' before " + position);
+                    }
+                }
+            });
+        }
+    },
+    {
+        name: "Partial matches of the anchors don't produce false positives",
+        body: function () {
+            // First and last units match but the middle doesn't, at every alignment
+            var hay = filler(3, "ab") + "axxb" + filler(20, "a_b") + "axyb" + filler(10, "b");
+            for (var from = 0; from < hay.length; from++) {
+                assert.areEqual(naiveIndexOf(hay, "axyb", from), hay.indexOf("axyb", from), "indexOf from " + from);
+                assert.areEqual(naiveLastIndexOf(hay, "axyb", from), hay.lastIndexOf("axyb", from), "lastIndexOf from " + from);
+                assert.areEqual(naiveIndexOf(hay, "ab", from), hay.indexOf("ab", from), "indexOf 'ab' from " + from);
+                assert.areEqual(naiveLastIndexOf(hay, "ab", from), hay.lastIndexOf("ab", from), "lastIndexOf 'ab' from " + from);
+            }
+        }
+    },
+    {
+        name: "Repeated needles report the first and last occurrence",
+        body: function () {
+            var hay = filler(50, "ab");
+            assert.areEqual(0, hay.indexOf("abab"));
+            assert.areEqual(96, hay.lastIndexOf("abab"));
+            assert.areEqual(1, hay.indexOf("baba"));
+            assert.areEqual(95, hay.lastIndexOf("baba"));
+            assert.areEqual(-1, hay.indexOf("abba"));
+            assert.areEqual(-1, hay.lastIndexOf("abba"));
+        }
+    },
+    {
+        name: "split by a string separator",
+        body: function () {
+            for (var length = 0; length < 30; length++) {
+                var parts = [];
+                for (var i = 0; i < 5; i++) {
+                    parts.push(filler(length + i, String.fromCharCode(0x61 + i)));
+                }
+                assert.areEqual(parts, parts.join("::").split("::"), "split '::' with parts of " + length);
+                assert.areEqual(parts, parts.join("\u2028").split("\u2028"), "split '\\u2028' with parts of " + length);
+            }
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -841,6 +841,46 @@ var tests = [
             assert.areEqual("test", map.get(key), "1.0 should be equal to the key 1 and map to 'test'");
         }
     },
+
+    {
+        name: "Iteration order and live iterators survive the map growing, compacting and shrinking",
+        body: function() {
+            var map = new Map();
+            for (var i = 0; i < 100; i++) {
+                map.set(i, "v" + i);
+            }
+
+            var iter = map.keys();
+            for (var i = 0; i < 10; i++) {
+                assert.areEqual(i, iter.next().value, "iterator visits keys in insertion order");
+            }
+
+            // Deleting most keys shrinks the table underneath the live iterator
+            for (var i = 0; i < 95; i++) {
+                map.delete(i);
+            }
+            assert.areEqual(5, map.size, "five keys are left");
+            assert.areEqual(95, iter.next().value, "iterator resumes at the first remaining key");
+
+            // Adding keys grows the table again
+            for (var i = 0; i < 50; i++) {
+                map.set("k" + i, i);
+            }
+            var keys = [];
+            for (var r = iter.next(); !r.done; r = iter.next()) {
+                keys.push(r.value);
+            }
+            assert.areEqual(54, keys.length, "iterator visits the remaining and newly added keys exactly once");
+            assert.areEqual(96, keys[0], "remaining keys come first");
+            assert.areEqual("k0", keys[4], "added keys follow in insertion order");
+            assert.areEqual("k49", keys[53], "last added key comes last");
+
+            for (var i = 0; i < 50; i++) {
+                assert.areEqual(i, map.get("k" + i), "string keys are found after rebuilds");
+            }
+            assert.areEqual("v99", map.get(99.0 + 0.5 - 0.5), "double keys equal to ints are found after rebuilds");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
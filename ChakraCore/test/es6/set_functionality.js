@@ -773,6 +773,28 @@ var tests = [
             assert.isTrue(set.has("asdf"));
         }
     },
+    {
+        name: "Repeatedly adding and deleting values keeps iteration order and sizes consistent",
+        body: function() {
+            var set = new Set();
+            var seen = [];
+            set.add(0);
+            // Use the set as a queue while iterating it: every visited value is deleted and
+            // a new one appended, so the table keeps compacting under the live iterator.
+            for (var value of set) {
+                seen.push(value);
+                set.delete(value);
+                if (value < 1000) {
+                    set.add(value + 1);
+                    set.add("s" + value);
+                    set.delete("s" + value);
+                }
+            }
+            assert.areEqual(1001, seen.length, "each added value is visited exactly once");
+            assert.areEqual(1000, seen[1000], "values are visited in insertion order");
+            assert.areEqual(0, set.size, "set is empty after every value is deleted");
+        }
+    },
 ];
 
 testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,157 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// WeakMap GC semantics -- values must stay alive exactly as long as their keys are reachable,
+// including when the only path to a key runs through the values of other WeakMaps.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+// Builds a chain of maps where maps[i] maps keys[i] to an object holding keys[i + 1].
+// Only the first key is returned; every later key is reachable only through a WeakMap value.
+function makeChain(maps, depth) {
+    var first = {};
+    var key = first;
+    for (var i = 0; i < depth; i++) {
+        var next = { index: i + 1 };
+        maps[i].set(key, { next: next, payload: [i, "value " + i] });
+        key = next;
+    }
+    return first;
+}
+
+function walkChain(maps, first, depth) {
+    var key = first;
+    for (var i = 0; i < depth; i++) {
+        var value = maps[i].get(key);
+        if (value === undefined || value.payload[0] !== i || value.payload[1] !== "value " + i) {
+            return i;
+        }
+        key = value.next;
+    }
+    return depth;
+}
+
+var tests = [
+    {
+        name: "Values reachable only through a chain of WeakMaps survive collection",
+        body: function () {
+            var depth = 200;
+
+            // Create the maps both in chain order and in reverse, so the chain runs both with and
+            // against the order in which the recycler visits the maps
+            [false, true].forEach(function (reverse) {
+                var maps = [];
+                for (var i = 0; i < depth; i++) {
+                    if (reverse) {
+                        maps.unshift(new WeakMap());
+                    } else {
+                        maps.push(new WeakMap());
+                    }
+                }
+
+                var first = makeChain(maps, depth);
+                CollectGarbage();
+                CollectGarbage();
+
+                assert.areEqual(depth, walkChain(maps, first, depth), "every link of the chain is still present");
+            });
+        }
+    },
+    {
+        name: "A chain within a single WeakMap survives collection",
+        body: function () {
+            var depth = 500;
+            var map = new WeakMap();
+            var first = {};
+            var key = first;
+            for (var i = 0; i < depth; i++) {
+                var next = {};
+                map.set(key, { next: next, index: i });
+                key = next;
+            }
+
+            CollectGarbage();
+
+            key = first;
+            for (var i = 0; i < depth; i++) {
+                var value = map.get(key);
+                assert.isTrue(value !== undefined && value.index === i, "link " + i + " is present");
+                key = value.next;
+            }
+        }
+    },
+    {
+        name: "A value that refers to its own key does not keep the entry alive",
+        body: function () {
+            var map = new WeakMap();
+            var live = {};
+            map.set(live, "live");
+
+            // Entries whose keys are only reachable from their own values are garbage
+            for (var i = 0; i < 1000; i++) {
+                var key = {};
+                map.set(key, { self: key, data: new Array(16) });
+            }
+
+            CollectGarbage();
+            CollectGarbage();
+
+            assert.areEqual("live", map.get(live), "entry with a reachable key is kept");
+            map.set({}, 1);
+            assert.isTrue(map.has(live));
+        }
+    },
+    {
+        name: "Entries survive collections interleaved with set, delete and growth",
+        body: function () {
+            var map = new WeakMap();
+            var keys = [];
+            for (var i = 0; i < 2000; i++) {
+                var key = { id: i };
+                keys.push(key);
+                map.set(key, { id: i });
+                if (i % 3 === 0) {
+                    map.delete(keys[i >> 1]);
+                }
+                if (i % 500 === 0) {
+                    CollectGarbage();
+                }
+            }
+
+            CollectGarbage();
+
+            var deleted = {};
+            for (var i = 0; i < 2000; i += 3) {
+                deleted[i >> 1] = true;
+            }
+
+            for (var i = 0; i < keys.length; i++) {
+                if (deleted[i]) {
+                    assert.isFalse(map.has(keys[i]), "entry " + i + " was deleted");
+                } else {
+                    assert.areEqual(i, map.get(keys[i]).id, "entry " + i);
+                }
+            }
+        }
+    },
+    {
+        name: "Using an object as a WeakMap key does not change its properties",
+        body: function () {
+            var map = new WeakMap();
+            var key = { a: 1 };
+            map.set(key, 2);
+            assert.areEqual(["a"], Object.getOwnPropertyNames(key));
+            assert.areEqual(0, Object.getOwnPropertySymbols(key).length);
+
+            var proxyKey = new Proxy({}, {});
+            map.set(proxyKey, 3);
+            assert.areEqual(3, map.get(proxyKey));
+            assert.isTrue(map.delete(proxyKey));
+            assert.isFalse(map.has(proxyKey));
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,126 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Map.prototype.get/has and Set.prototype.has probe the table from jitted code when the key is likely a
+// tagged int or a string. Each lookup function is called once in the interpreter and then jitted, which
+// prints the MapSetFastPath trace. Small tables (8 entries or fewer) are scanned, larger ones are probed
+// through their index, and a string key that isn't the stored string object falls back to the runtime.
+
+function makeInts(count) {
+    const ints = [];
+    for (let i = 0; i < count; i++) {
+        ints.push(i);
+    }
+    return ints;
+}
+
+function makeStrings(count) {
+    const strings = [];
+    for (let i = 0; i < count; i++) {
+        strings.push("key" + i);
+    }
+    return strings;
+}
+
+function toEntries(keys) {
+    return keys.map((key, i) => [key, i * 10]);
+}
+
+function sumIntKeys(map, keys) {
+    let sum = 0;
+    for (let i = 0; i < keys.length; i++) {
+        if (map.has(keys[i])) {
+            sum += map.get(keys[i]);
+        }
+    }
+    return sum;
+}
+
+function sumStringKeys(map, keys) {
+    let sum = 0;
+    for (let i = 0; i < keys.length; i++) {
+        if (map.has(keys[i])) {
+            sum += map.get(keys[i]);
+        }
+    }
+    return sum;
+}
+
+function countIntValues(set, values) {
+    let count = 0;
+    for (let i = 0; i < values.length; i++) {
+        if (set.has(values[i])) {
+            count++;
+        }
+    }
+    return count;
+}
+
+function countStringValues(set, values) {
+    let count = 0;
+    for (let i = 0; i < values.length; i++) {
+        if (set.has(values[i])) {
+            count++;
+        }
+    }
+    return count;
+}
+
+function setInts(map, keys) {
+    for (let i = 0; i < keys.length; i++) {
+        map.set(keys[i], keys[i]);
+    }
+    return map.size;
+}
+
+function addInts(set, values) {
+    for (let i = 0; i < values.length; i++) {
+        set.add(values[i]);
+    }
+    return set.size;
+}
+
+const smallInts = makeInts(6);
+const ints = makeInts(40);
+const queryInts = makeInts(50);
+
+const smallIntMap = new Map(toEntries(smallInts));
+const intMap = new Map(toEntries(ints));
+print("int keys, small map: " + sumIntKeys(smallIntMap, queryInts));
+print("int keys, large map: " + sumIntKeys(intMap, queryInts));
+print("int keys, small map: " + sumIntKeys(smallIntMap, queryInts));
+
+// Leaves removed buckets behind for the probe to skip
+for (let i = 0; i < 20; i += 2) {
+    intMap.delete(i);
+}
+print("int keys, after deletes: " + sumIntKeys(intMap, queryInts));
+intMap.clear();
+print("int keys, after clear: " + sumIntKeys(intMap, queryInts));
+
+const smallStrings = makeStrings(6);
+const strings = makeStrings(40);
+const stringCopies = makeStrings(40);
+
+const smallStringMap = new Map(toEntries(smallStrings));
+const stringMap = new Map(toEntries(strings));
+print("string keys, small map: " + sumStringKeys(smallStringMap, strings));
+print("string keys, large map: " + sumStringKeys(stringMap, strings));
+print("string keys, large map, copied keys: " + sumStringKeys(stringMap, stringCopies));
+print("string keys, small map, copied keys: " + sumStringKeys(smallStringMap, stringCopies));
+print("string keys, int map: " + sumStringKeys(intMap, strings));
+
+print("int values, small set: " + countIntValues(new Set(smallInts), queryInts));
+print("int values, large set: " + countIntValues(new Set(ints), queryInts));
+print("int values, string set: " + countIntValues(new Set(strings), queryInts));
+
+print("string values, large set: " + countStringValues(new Set(strings), strings));
+print("string values, large set, copied values: " + countStringValues(new Set(strings), stringCopies));
+print("string values, small set: " + countStringValues(new Set(smallStrings), strings));
+
+print("Map.prototype.set: " + setInts(new Map(), smallInts));
+print("Map.prototype.set: " + setInts(new Map(), ints));
+print("Set.prototype.add: " + addInts(new Set(), smallInts));
+print("Set.prototype.add: " + addInts(new Set(), ints));
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Inlined Map and Set built-ins with keys the table probe doesn't handle, subclass receivers, and
+// receivers that are not Maps or Sets at all.
+
+function fillMap(map, keys) {
+    for (let i = 0; i < keys.length; i++) {
+        map.set(keys[i], i);
+    }
+    return map;
+}
+
+function fillSet(set, values) {
+    for (let i = 0; i < values.length; i++) {
+        set.add(values[i]);
+    }
+    return set;
+}
+
+function lookUp(map, set, key) {
+    return map.has(key) + " " + map.get(key) + " " + set.has(key);
+}
+
+function sumMap(map, keys) {
+    let sum = 0;
+    for (let i = 0; i < keys.length; i++) {
+        sum += map.get(keys[i]);
+    }
+    return sum;
+}
+
+const mixedKeys = [-0, 0.5, "0", null, undefined, NaN, Math, true];
+const mixedMap = fillMap(new Map(), mixedKeys);
+const mixedSet = fillSet(new Set(), mixedKeys);
+for (let iter = 0; iter < 3; iter++) {
+    print("0: " + lookUp(mixedMap, mixedSet, 0));
+    print("0.5: " + lookUp(mixedMap, mixedSet, 0.5));
+    print("NaN: " + lookUp(mixedMap, mixedSet, NaN));
+    print("'0': " + lookUp(mixedMap, mixedSet, "0"));
+    print("1: " + lookUp(mixedMap, mixedSet, 1));
+}
+print("-0 is stored as +0: " + Object.is(mixedMap.keys().next().value, 0) + " " + Object.is(mixedSet.values().next().value, 0));
+
+// Subclass instances are still Maps and Sets
+class MyMap extends Map { }
+const keys = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+for (let iter = 0; iter < 3; iter++) {
+    print("Map subclass: " + sumMap(fillMap(new MyMap(), keys), keys));
+}
+
+// Receivers that are not Maps or Sets still throw
+const getFn = Map.prototype.get;
+const addFn = Set.prototype.add;
+function callGet(receiver, key) {
+    return getFn.call(receiver, key);
+}
+function callAdd(receiver, value) {
+    return addFn.call(receiver, value);
+}
+for (let iter = 0; iter < 3; iter++) {
+    print("get through call: " + callGet(new Map([[1, "one"]]), 1));
+    print("add through call: " + callAdd(new Set(), 1).size);
+
+    try {
+        callGet(new Set([1]), 1);
+    } catch (e) {
+        print("Map.prototype.get on a Set: " + (e instanceof TypeError));
+    }
+
+    try {
+        callAdd(new Map(), 1);
+    } catch (e) {
+        print("Set.prototype.add on a Map: " + (e instanceof TypeError));
+    }
+}
@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Compares the elementwise kernels computed by the interpreter with the jitted code
+// need to run with -mic:1 -off:simplejit -off:JITLoopBody
+// Run locally with -trace:memarith -trace:bailout to help find bugs
+
+function fill(a, seed) {
+  for (let i = 0; i < a.length; i++) {
+    a[i] = ((i * 7919 + seed) % 1000) / 8 - 60;
+  }
+  return a;
+}
+
+function fillInt(a, seed) {
+  for (let i = 0; i < a.length; i++) {
+    a[i] = (i * 40503 + seed) * 65599;
+  }
+  return a;
+}
+
+function test() {
+  let n = 203, k = 3.25, m = 0.1, q = 1 << 30;
+  let i;
+  let results = [];
+
+  let x = fill(new Float64Array(n), 1), y = fill(new Float64Array(n), 2);
+  y[5] = 0;
+  y[6] = 0; x[6] = 0;
+  let r1 = new Float64Array(n), r2 = new Float64Array(n), r3 = new Float64Array(n), r4 = new Float64Array(n);
+  for (i = 0; i < n; i++) { r1[i] = x[i] + y[i]; }
+  for (i = 0; i < n; i++) { r2[i] = x[i] - y[i]; }
+  for (i = 0; i < n; i++) { r3[i] = x[i] * y[i]; }
+  for (i = 0; i < n; i++) { r4[i] = x[i] / y[i]; }
+  results.push(r1, r2, r3, r4);
+
+  let r5 = new Float64Array(n), r6 = new Float64Array(n), r7 = new Float64Array(n);
+  for (i = 0; i < n; i++) { r5[i] = x[i] * k; }
+  for (i = 0; i < n; i++) { r6[i] = k + x[i]; }
+  for (i = 0; i < n; i++) { r7[i] = k - x[i]; }
+  results.push(r5, r6, r7);
+
+  let fx = fill(new Float32Array(n), 3), fy = fill(new Float32Array(n), 4);
+  let r8 = new Float32Array(n), r9 = new Float32Array(n), r10 = new Float32Array(n), r11 = new Float32Array(n);
+  for (i = 0; i < n; i++) { r8[i] = fx[i] + fy[i]; }
+  for (i = 0; i < n; i++) { r9[i] = fx[i] / fy[i]; }
+  for (i = 0; i < n; i++) { r10[i] = fx[i] * 0.5; }
+  for (i = 0; i < n; i++) { r11[i] = fx[i] * m; }
+  results.push(r8, r9, r10, r11);
+
+  let ix = fillInt(new Int32Array(n), 5), iy = fillInt(new Int32Array(n), 6);
+  let r12 = new Int32Array(n), r13 = new Int32Array(n), r14 = new Int32Array(n);
+  for (i = 0; i < n; i++) { r12[i] = ix[i] + iy[i]; }
+  for (i = 0; i < n; i++) { r13[i] = ix[i] - iy[i]; }
+  for (i = 0; i < n; i++) { r14[i] = ix[i] + q; }
+  results.push(r12, r13, r14);
+
+  // In place and backward
+  let r15 = fill(new Float64Array(n), 7);
+  for (i = 0; i < n; i++) { r15[i] = r15[i] * k; }
+  let r16 = fillInt(new Int32Array(n), 8);
+  for (i = n - 1; i >= 0; i--) { r16[i] = r16[i] - 12345; }
+  results.push(r15, r16);
+
+  // Views of the same buffer at different offsets, and ranges past the end of the arrays
+  let buffer = fill(new Float64Array(n + 2), 9);
+  let r17 = buffer.subarray(1, n + 1), src = buffer.subarray(0, n);
+  for (i = 0; i < n; i++) { r17[i] = src[i] + 1; }
+  let r18 = new Float64Array(n);
+  for (i = 0; i < n + 4; i++) { r18[i] = x[i] + y[i]; }
+  results.push(buffer, r18);
+
+  return results;
+}
+
+// Run first time in interpreter
+let a = test();
+// Run second time with memop
+let b = test();
+
+let passed = true;
+for (let i = 0; i < a.length; i++) {
+  let aa = a[i], bb = b[i];
+  for (let j = 0; j < aa.length; j++) {
+    if (!Object.is(aa[j], bb[j])) {
+      WScript.Echo(i + " " + j + " " + aa[j] + " " + bb[j]);
+      passed = false;
+    }
+  }
+}
+
+if (passed) {
+  WScript.Echo("PASSED");
+} else {
+  WScript.Echo("FAILED");
+}
@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (c) ChakraCore Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Loads and stores of every width at addresses past the end of memory, near 4GB, and past 4GB through their offset
+// immediate. They must trap whether jitted code checks the bounds or relies on the guard pages of the memory's
+// virtual reservation (ENABLE_FAST_ARRAYBUFFER), and stores that trap must not change memory.
+
+const PAGE_SIZE = 0x10000;
+
+const moduleTxt = `
+(module
+  (memory (export "mem") 1 2)
+  (func (export "grow") (param i32) (result i32) (memory.grow (get_local 0)))
+  (func (export "loadI32") (param i32) (result i32) (i32.load (get_local 0)))
+  (func (export "loadI32U8") (param i32) (result i32) (i32.load8_u (get_local 0)))
+  (func (export "loadI32U16") (param i32) (result i32) (i32.load16_u (get_local 0)))
+  (func (export "loadI64") (param i32) (result i32) (i32.wrap/i64 (i64.load (get_local 0))))
+  (func (export "loadF32") (param i32) (result f32) (f32.load (get_local 0)))
+  (func (export "loadF64") (param i32) (result f64) (f64.load (get_local 0)))
+  (func (export "loadI32Offset") (param i32) (result i32) (i32.load offset=4294967295 (get_local 0)))
+  (func (export "loadF64Offset") (param i32) (result f64) (f64.load offset=65536 (get_local 0)))
+  (func (export "storeI32") (param i32) (i32.store (get_local 0) (i32.const -1)))
+  (func (export "storeI32U8") (param i32) (i32.store8 (get_local 0) (i32.const -1)))
+  (func (export "storeI32U16") (param i32) (i32.store16 (get_local 0) (i32.const -1)))
+  (func (export "storeI64") (param i32) (i64.store (get_local 0) (i64.const -1)))
+  (func (export "storeF32") (param i32) (f32.store (get_local 0) (f32.const -1)))
+  (func (export "storeF64") (param i32) (f64.store (get_local 0) (f64.const -1)))
+  (func (export "storeI32Offset") (param i32) (i32.store offset=4294967295 (get_local 0) (i32.const -1)))
+  (func (export "storeF64Offset") (param i32) (f64.store offset=65536 (get_local 0) (f64.const -1)))
+)`;
+const {exports} = new WebAssembly.Instance(new WebAssembly.Module(WebAssembly.wabt.convertWast2Wasm(moduleTxt)));
+
+// Each access with its size in bytes and the offset immediate it adds to the address
+const accesses = [
+    {name: "I32", size: 4, offset: 0},
+    {name: "I32U8", size: 1, offset: 0},
+    {name: "I32U16", size: 2, offset: 0},
+    {name: "I64", size: 8, offset: 0},
+    {name: "F32", size: 4, offset: 0},
+    {name: "F64", size: 8, offset: 0},
+    {name: "I32Offset", size: 4, offset: 4294967295},
+    {name: "F64Offset", size: 8, offset: 65536}
+];
+
+// Addresses as unsigned 32-bit values; the exports take them as i32
+function addresses(memorySize) {
+    return [0, 1, memorySize - 8, memorySize - 4, memorySize - 2, memorySize - 1, memorySize, memorySize + 8,
+        2 * PAGE_SIZE, 0x7FFFFFFF, 0x80000000, 0xFFFFFFF8, 0xFFFFFFFC, 0xFFFFFFFF];
+}
+
+function traps(fn, address) {
+    try {
+        fn(address | 0);
+        return false;
+    } catch (e) {
+        if (!(e instanceof WebAssembly.RuntimeError)) {
+            throw e;
+        }
+        return true;
+    }
+}
+
+function isZero(bytes) {
+    for (let i = 0; i < bytes.length; i++) {
+        if (bytes[i] !== 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// One line per access: the addresses at which its load and store trap, and any at which a store that trapped
+// changed memory anyway
+function runAccesses() {
+    const memorySize = exports.mem.buffer.byteLength;
+    const bytes = new Uint8Array(exports.mem.buffer);
+    const lines = [];
+    for (const access of accesses) {
+        const loadTraps = [];
+        const storeTraps = [];
+        const storeChanged = [];
+        for (const address of addresses(memorySize)) {
+            bytes.fill(0);
+            if (traps(exports["store" + access.name], address)) {
+                storeTraps.push(address);
+                if (!isZero(bytes)) {
+                    storeChanged.push(address);
+                }
+            }
+            if (traps(exports["load" + access.name], address)) {
+                loadTraps.push(address);
+            }
+        }
+        lines.push(`${access.name}: load traps at ${loadTraps.join(" ")}; store traps at ${storeTraps.join(" ")}; ` +
+            `trapping store changed memory at ${storeChanged.join(" ") || "none"}`);
+    }
+    return lines.join("\n");
+}
+
+// Run enough rounds for the functions to be jitted, then grow the memory so that some of the accesses that trapped
+// are in bounds
+function runRounds() {
+    const memorySize = exports.mem.buffer.byteLength;
+    print(`memory size ${memorySize}, addresses ${addresses(memorySize).join(" ")}`);
+    print("first round:");
+    print(runAccesses());
+    let result;
+    for (let round = 1; round < 50; round++) {
+        result = runAccesses();
+    }
+    print("last round:");
+    print(result);
+}
+
+runRounds();
+print(`grow: ${exports.grow(1)}`);
+runRounds();
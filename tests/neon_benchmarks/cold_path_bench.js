@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// cold_path_bench.js — hot functions whose argument checks end in throws
+//
+// Blocks that end in a throw are lowered as helper blocks, so the register allocator keeps their spills
+// and reloads off the fast path and the layout moves them after the function's exit. This times request
+// handlers that validate their input before doing the work, and checks that the throws still happen
+// with the right errors once the handlers are jitted. To compare with the old layout:
+//   ch cold_path_bench.js
+//   ch -off:ColdPathLayout cold_path_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var ITERATIONS = 2000000;
+
+function checkRange(value, low, high) {
+  if (typeof value !== "number") {
+    throw new TypeError("expected a number, got " + typeof value);
+  }
+  if (value < low || value > high) {
+    throw new RangeError("value " + value + " is outside [" + low + ", " + high + "]");
+  }
+  return value;
+}
+
+function handle(request) {
+  if (request === null || typeof request !== "object") {
+    throw new TypeError("request must be an object");
+  }
+  var x = checkRange(request.x, 0, 4096);
+  var y = checkRange(request.y, 0, 4096);
+  if (request.op === 1) {
+    return (x * 31 + y) | 0;
+  }
+  if (request.op === 2) {
+    return (x ^ (y << 3)) | 0;
+  }
+  throw new Error("unknown op " + request.op);
+}
+
+function parseDigits(s) {
+  var n = 0;
+  for (var i = 0; i < s.length; i++) {
+    var c = s.charCodeAt(i) - 48;
+    if (c < 0 || c > 9) {
+      throw new SyntaxError("bad digit at " + i + " in " + s);
+    }
+    n = n * 10 + c;
+  }
+  return n;
+}
+
+function bench(label, fn) {
+  fn();
+  var start = Date.now();
+  var result = fn();
+  print(label + ": " + (Date.now() - start) + "ms");
+  return result;
+}
+
+var requests = [];
+for (var i = 0; i < 256; i++) {
+  requests.push({ x: (i * 17) & 4095, y: (i * 101) & 4095, op: 1 + (i & 1) });
+}
+var strings = [];
+for (var j = 0; j < 256; j++) {
+  strings.push(String(j * 7919));
+}
+
+print("=== Hot paths ===");
+var handled = bench("Validated handlers          ", function () {
+  var sum = 0;
+  for (var k = 0; k < ITERATIONS; k++) {
+    sum = (sum + handle(requests[k & 255])) | 0;
+  }
+  return sum;
+});
+var expectedHandled = 0;
+for (var k = 0; k < ITERATIONS; k++) {
+  var r = requests[k & 255];
+  expectedHandled = (expectedHandled + (r.op === 1 ? (r.x * 31 + r.y) | 0 : (r.x ^ (r.y << 3)) | 0)) | 0;
+}
+print("Handler results               [" + (handled === expectedHandled ? "OK" : "FAIL") + "]");
+var parsed = bench("Digit parsing               ", function () {
+  var sum = 0;
+  for (var k = 0; k < ITERATIONS / 4; k++) {
+    sum = (sum + parseDigits(strings[k & 255])) | 0;
+  }
+  return sum;
+});
+var expectedParsed = 0;
+for (var k = 0; k < ITERATIONS / 4; k++) {
+  expectedParsed = (expectedParsed + ((k & 255) * 7919)) | 0;
+}
+print("Parse results                 [" + (parsed === expectedParsed ? "OK" : "FAIL") + "]");
+print("");
+
+print("=== Cold paths ===");
+function throwsWith(type, fn) {
+  try {
+    fn();
+  } catch (e) {
+    return e instanceof type;
+  }
+  return false;
+}
+var coldOk = throwsWith(TypeError, function () { handle(null); });
+coldOk = coldOk && throwsWith(TypeError, function () { handle({ x: "1", y: 0, op: 1 }); });
+coldOk = coldOk && throwsWith(RangeError, function () { handle({ x: 1, y: 5000, op: 1 }); });
+coldOk = coldOk && throwsWith(Error, function () { handle({ x: 1, y: 1, op: 3 }); });
+coldOk = coldOk && throwsWith(SyntaxError, function () { parseDigits("12a4"); });
+coldOk = coldOk && handle(requests[3]) === ((requests[3].x ^ (requests[3].y << 3)) | 0);
+print("Throws after jitting          [" + (coldOk ? "OK" : "FAIL") + "]");
+print("");
+
+print("=== Benchmark Complete ===");
@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// jit_queue_bench.js — hot functions queued behind a startup burst of cold ones
+//
+// Full JIT work items are ordered by how often their functions and loops run while they wait in the jit queue,
+// with a bonus for the time they have waited. Work items that are still interpreted but stopped running are
+// removed from the queue. This queues a burst of cold functions, then times how quickly a few hot ones reach
+// their jitted speed, and checks their results. Compare with a second run with -off:JitQueuePriority.
+// Run with: ch jit_queue_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var COLD = 400;
+var HOT = 4;
+var SLICES = 10;
+var CALLS_PER_SLICE = 20000;
+
+function makeFunction(i) {
+  return new Function("a", "n",
+    "var s = " + i + ";" +
+    "for (var j = 0; j < n; j++) { s = (s + a[j & 63] * " + (i % 7 + 1) + ") | 0; }" +
+    "return s;");
+}
+
+function expected(i, a, n) {
+  var s = i;
+  for (var j = 0; j < n; j++) {
+    s = (s + a[j & 63] * (i % 7 + 1)) | 0;
+  }
+  return s;
+}
+
+var data = [];
+for (var i = 0; i < 64; i++) {
+  data.push((i * 7919) % 1000);
+}
+
+// Startup burst: every cold function runs just enough to be queued
+var cold = [];
+for (var i = 0; i < COLD; i++) {
+  cold.push(makeFunction(HOT + i));
+}
+var start = Date.now();
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < COLD; i++) {
+    cold[i](data, 4);
+  }
+}
+print("=== Startup burst (" + COLD + " functions) ===");
+print("queue cold functions        : " + (Date.now() - start) + "ms");
+print("");
+
+// The hot functions start after the burst. The time per slice drops as they get jitted.
+var hot = [];
+for (var i = 0; i < HOT; i++) {
+  hot.push(makeFunction(i));
+}
+print("=== Hot functions (" + HOT + " functions, " + CALLS_PER_SLICE + " calls per slice) ===");
+var ok = true, total = 0;
+for (var slice = 0; slice < SLICES; slice++) {
+  start = Date.now();
+  for (var c = 0; c < CALLS_PER_SLICE; c++) {
+    var i = c % HOT;
+    var result = hot[i](data, 16);
+    if (c < HOT && result !== expected(i, data, 16)) {
+      ok = false;
+    }
+  }
+  var elapsed = Date.now() - start;
+  total += elapsed;
+  print("slice " + slice + "                     : " + elapsed + "ms");
+}
+print("total                       : " + total + "ms");
+print("hot results                 [" + (ok ? "OK" : "FAIL") + "]");
+print("");
+
+print("=== Cold functions again ===");
+ok = true;
+for (var i = 0; i < COLD; i++) {
+  ok = ok && cold[i](data, 8) === expected(HOT + i, data, 8);
+}
+print("cold results                [" + (ok ? "OK" : "FAIL") + "]");
+print("");
+
+print("=== Benchmark Complete ===");
@@ -0,0 +1,117 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// json_parse_bench.js — JSON.parse throughput benchmark (SIMD structural index)
+//
+// Measures JSON.parse over API-response shaped payloads: records with short keys, string-heavy
+// records with long values and escapes, numeric arrays, and pretty-printed input. Each payload is
+// parsed without a reviver (structural index path) and with an identity reviver (token parser path,
+// which also pays for the reviver walk).
+// Run with: ch json_parse_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var ITERS = 10;
+
+function makeRecords(count) {
+  var records = [];
+  for (var i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      active: i % 3 !== 0,
+      score: (i * 37) % 1000 / 10,
+      name: "user-" + i,
+      email: "user" + i + "@example.com",
+      tags: ["alpha", "beta", i % 2 ? "gamma" : "delta"],
+      address: { city: "City " + (i % 50), zip: "" + (10000 + i), geo: [i / 7, -i / 11] },
+    });
+  }
+  return records;
+}
+
+function makeText(count) {
+  var records = [];
+  for (var i = 0; i < count; i++) {
+    records.push({
+      id: i,
+      title: "Entry " + i + ": the quick brown fox jumps over the lazy dog",
+      body:
+        "Lorem ipsum dolor sit amet, consectetur adipiscing elit. \"Quoted\" text, a\\backslash and\nnew lines, " +
+        "sed do eiusmod tempor incididunt ut labore et dolore magna aliqua. ".repeat(4),
+    });
+  }
+  return records;
+}
+
+function makeNumbers(count) {
+  var values = [];
+  for (var i = 0; i < count; i++) {
+    values.push(i % 5 === 0 ? i * 1.25 : i);
+  }
+  return values;
+}
+
+function identity(key, value) {
+  return value;
+}
+
+function report(label, elapsed, chars, status) {
+  var mbPerSec = (chars * 2) / (elapsed / 1000) / 1e6;
+  print(
+    label +
+      ": " +
+      elapsed +
+      "ms (" +
+      (elapsed > 0 ? mbPerSec.toFixed(1) : "inf") +
+      " MB/s) [" +
+      status +
+      "]",
+  );
+}
+
+function bench(label, text, reviver, check) {
+  var start = Date.now();
+  var result = null;
+  for (var iter = 0; iter < ITERS; iter++) {
+    result = reviver ? JSON.parse(text, reviver) : JSON.parse(text);
+  }
+  var elapsed = Date.now() - start;
+  report(label, elapsed, text.length * ITERS, check(result) ? "OK" : "FAIL");
+}
+
+var records = JSON.stringify(makeRecords(20000));
+var pretty = JSON.stringify(makeRecords(20000), null, 2);
+var text = JSON.stringify(makeText(5000));
+var numbers = JSON.stringify(makeNumbers(200000));
+
+function checkRecords(r) {
+  return r.length === 20000 && r[19999].address.zip === "29999" && r[3].active === false;
+}
+
+function checkText(r) {
+  return r.length === 5000 && r[42].body.indexOf('"Quoted"') > 0 && r[42].title.length === 53;
+}
+
+function checkNumbers(r) {
+  return r.length === 200000 && r[199995] === 249993.75;
+}
+
+print("=== JSON.parse, payload sizes in chars ===");
+print("records " + records.length + ", pretty " + pretty.length + ", text " + text.length + ", numbers " + numbers.length);
+print("");
+
+print("=== No reviver (structural index) ===");
+bench("records          ", records, null, checkRecords);
+bench("records, pretty  ", pretty, null, checkRecords);
+bench("long strings     ", text, null, checkText);
+bench("numeric array    ", numbers, null, checkNumbers);
+print("");
+
+print("=== Identity reviver (token parser + walk) ===");
+bench("records          ", records, identity, checkRecords);
+bench("long strings     ", text, identity, checkText);
+print("");
+
+print("=== Benchmark Complete ===");
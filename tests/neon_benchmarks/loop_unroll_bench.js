@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// loop_unroll_bench.js — profile-guided unrolling of hot counted loops
+//
+// Loops that ran at least -MinLoopUnrollCount iterations in the interpreter have their body repeated
+// -LoopUnrollFactor times before the back edge by the full JIT. This times reductions and searches over
+// 1M elements and checks their results. Compare with a second run with -off:LoopUnroll, or try other
+// factors with -LoopUnrollFactor:<n>.
+// Run with: ch loop_unroll_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var N = 1024 * 1024;
+var ITERATIONS = 20;
+
+function sum(a) { var s = 0; for (var i = 0; i < a.length; i++) { s += a[i]; } return s; }
+function dot(a, b) { var s = 0; for (var i = 0; i < a.length; i++) { s += a[i] * b[i]; } return s; }
+function max(a) { var m = a[0]; for (var i = 1; i < a.length; i++) { var v = a[i]; if (v > m) { m = v; } } return m; }
+function countBelow(a, k) { var c = 0; for (var i = 0; i < a.length; i++) { if (a[i] < k) { c++; } } return c; }
+function find(a, v) { for (var i = 0; i < a.length; i++) { if (a[i] === v) { break; } } return i; }
+function sumInt(a) { var s = 0; for (var i = 0; i < a.length; i++) { s = (s + a[i]) | 0; } return s; }
+
+function bench(label, fn) {
+  var result = fn();
+  var start = Date.now();
+  for (var i = 0; i < ITERATIONS; i++) {
+    fn();
+  }
+  print(label + ": " + ((Date.now() - start) / ITERATIONS).toFixed(2) + "ms");
+  return result;
+}
+
+function check(label, actual, expected) {
+  print(label + " [" + (actual === expected ? "OK" : "FAIL") + "]");
+}
+
+var f64a = new Float64Array(N), f64b = new Float64Array(N), i32 = new Int32Array(N), arr = new Array(N);
+for (var i = 0; i < N; i++) {
+  f64a[i] = (i % 1000) / 8;
+  f64b[i] = ((i * 7) % 1000) / 16;
+  i32[i] = (i * 7919) % 100000;
+  arr[i] = i % 4093;
+}
+i32[N - 3] = 1000000;
+
+var expectedSum = 0, expectedDot = 0, expectedBelow = 0, expectedSumInt = 0, expectedArraySum = 0;
+for (var i = 0; i < N; i++) {
+  expectedSum += f64a[i];
+  expectedDot += f64a[i] * f64b[i];
+  expectedBelow += i32[i] < 50000 ? 1 : 0;
+  expectedSumInt = (expectedSumInt + i32[i]) | 0;
+  expectedArraySum += arr[i];
+}
+
+print("=== Float64Array (" + N + " elements) ===");
+check("sum                         ", bench("s += a[i]                   ", function () { return sum(f64a); }), expectedSum);
+check("dot                         ", bench("s += a[i] * b[i]            ", function () { return dot(f64a, f64b); }), expectedDot);
+print("");
+
+print("=== Int32Array ===");
+check("max                         ", bench("if (a[i] > m) m = a[i]      ", function () { return max(i32); }), 1000000);
+check("count                       ", bench("if (a[i] < k) c++           ", function () { return countBelow(i32, 50000); }), expectedBelow);
+check("int sum                     ", bench("s = (s + a[i]) | 0          ", function () { return sumInt(i32); }), expectedSumInt);
+print("");
+
+print("=== Array ===");
+check("find                        ", bench("if (a[i] === v) break       ", function () { return find(arr, 4092); }), 4092);
+check("sum                         ", bench("s += a[i]                   ", function () { return sum(arr); }), expectedArraySum);
+print("");
+
+print("=== Benchmark Complete ===");
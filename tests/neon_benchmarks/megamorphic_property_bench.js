@@ -0,0 +1,105 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// megamorphic_property_bench.js — property sites that see more shapes than their inline caches hold
+//
+// Sites that see many types look properties up in the type property cache of each type, which has a single entry per
+// property ID modulo 16. Its entries are also kept in a thread-wide cache keyed by (type, property ID), which is looked
+// up before the slow path. This times reads and writes of many properties through sites that see 64 shapes, and
+// checks their results. Compare with a second run with -off:MegamorphicPropertyCache.
+// Run with: ch megamorphic_property_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var SHAPES = 64;
+var PROPERTIES = 48;
+var ITERATIONS = 20;
+var ROUNDS = 2000;
+
+function makeObject(shape, proto) {
+  var o = Object.create(proto);
+  o["s" + shape] = shape;
+  for (var i = 0; i < PROPERTIES; i++) {
+    var p = (i * 5 + shape) % PROPERTIES;
+    o["p" + p] = p;
+  }
+  return o;
+}
+
+// Create the property names in order, so that p0, p16 and p32 get property IDs that are equal modulo 16
+var names = {};
+for (var i = 0; i < PROPERTIES; i++) {
+  names["p" + i] = i;
+}
+
+var proto = { scale: 2 };
+var objects = [];
+for (var shape = 0; shape < SHAPES; shape++) {
+  objects.push(makeObject(shape, proto));
+}
+
+// p0, p16 and p32 (and p1, p17 and p33) evict each other from the type property caches
+function readLocal(objects) {
+  var s = 0;
+  for (var r = 0; r < ROUNDS; r++) {
+    for (var i = 0; i < objects.length; i++) {
+      var o = objects[i];
+      s = (s + o.p0 + o.p16 + o.p32 + o.p1 + o.p17 + o.p33) | 0;
+    }
+  }
+  return s;
+}
+
+function readProto(objects) {
+  var s = 0;
+  for (var r = 0; r < ROUNDS; r++) {
+    for (var i = 0; i < objects.length; i++) {
+      var o = objects[i];
+      s = (s + o.p0 * o.scale + o.p16 * o.scale + o.p32) | 0;
+    }
+  }
+  return s;
+}
+
+function write(objects) {
+  for (var r = 0; r < ROUNDS; r++) {
+    for (var i = 0; i < objects.length; i++) {
+      var o = objects[i];
+      o.p0 = r;
+      o.p16 = r + 1;
+      o.p32 = r + 2;
+    }
+  }
+  var s = 0;
+  for (var i = 0; i < objects.length; i++) {
+    s += objects[i].p0 + objects[i].p16 + objects[i].p32;
+  }
+  return s;
+}
+
+function bench(label, fn) {
+  var result = fn();
+  var start = Date.now();
+  for (var i = 0; i < ITERATIONS; i++) {
+    fn();
+  }
+  print(label + ": " + ((Date.now() - start) / ITERATIONS).toFixed(2) + "ms");
+  return result;
+}
+
+function check(label, actual, expected) {
+  print(label + " [" + (actual === expected ? "OK" : "FAIL") + "]");
+}
+
+print("=== Reads (" + SHAPES + " shapes, " + PROPERTIES + " properties) ===");
+check("own properties              ", bench("o.p0 + o.p16 + o.p32 + ...  ", function () { return readLocal(objects); }), (ROUNDS * SHAPES * (0 + 16 + 32 + 1 + 17 + 33)) | 0);
+check("prototype property          ", bench("o.p0 * o.scale + ...        ", function () { return readProto(objects); }), (ROUNDS * SHAPES * (0 * 2 + 16 * 2 + 32)) | 0);
+print("");
+
+print("=== Writes ===");
+check("own properties              ", bench("o.p0 = r; o.p16 = r + 1 ... ", function () { return write(objects); }), SHAPES * ((ROUNDS - 1) * 3 + 3));
+print("");
+
+print("=== Benchmark Complete ===");
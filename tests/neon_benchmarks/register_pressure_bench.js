@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// register_pressure_bench.js — loops with more live values than registers
+//
+// In the full JIT of loop bodies and of functions that spend most of their byte code in loops, the register
+// allocator prefers to spill the values whose next use is furthest away, and reloads them only there. This
+// times loops that keep 12 to 20 values live and checks their results. Compare with a second run with
+// -off:NextUseSpillCost; -trace:NextUseSpillCost lists the functions that use it.
+// Run with: ch register_pressure_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var N = 1000000;
+var ITERATIONS = 20;
+
+function mixInts(n) {
+  var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8, j = 9, k = 10, l = 11, m = 12, o = 13, p = 14;
+  for (var i = 0; i < n; i++) {
+    a = (a + b) | 0; b = (b ^ c) + i | 0; c = (c + d * 3) | 0; d = (d - e) | 0;
+    e = (e + f) & 0xffff; f = (f + g + i) | 0; g = (g * 5 + h) | 0; h = (h + j) | 0;
+    j = (j + k) ^ i; k = (k + l) | 0; l = (l - m) | 0; m = (m + o) & 0xfffff; o = (o + p) | 0; p = (p + a) | 0;
+  }
+  return (a ^ b ^ c ^ d ^ e ^ f ^ g ^ h ^ j ^ k ^ l ^ m ^ o ^ p) | 0;
+}
+
+function filter(x, n) {
+  var a = 0.5, b = 0.25, c = 0.125, d = 0.0625, e = 0.03125, f = 0.015625, g = 0.0078125, h = 0.00390625;
+  var z1 = 0, z2 = 0, z3 = 0, z4 = 0, z5 = 0, z6 = 0, z7 = 0, z8 = 0, out = 0;
+  for (var i = 0; i < n; i++) {
+    var v = x[i & 1023];
+    z8 = z7; z7 = z6; z6 = z5; z5 = z4; z4 = z3; z3 = z2; z2 = z1; z1 = v;
+    out += a * z1 + b * z2 + c * z3 + d * z4 + e * z5 + f * z6 + g * z7 + h * z8;
+  }
+  return out;
+}
+
+function coldValues(n, p, q, r, s) {
+  var a = 1, b = 2, c = 3, d = 4, e = 5, f = 6, g = 7, h = 8, j = 9, k = 10;
+  for (var i = 0; i < n; i++) {
+    a = (a + b) | 0; b = (b + c) | 0; c = (c ^ d) | 0; d = (d + e) | 0; e = (e + f) | 0;
+    f = (f + g) | 0; g = (g + h) | 0; h = (h + j) | 0; j = (j + k + i) | 0; k = (k + a) | 0;
+  }
+  // p, q, r and s stay live across the loop without being used in it
+  return (a + b + c + d + e + f + g + h + j + k + p + q + r + s) | 0;
+}
+
+function bench(label, fn) {
+  var result = fn();
+  var start = Date.now();
+  for (var i = 0; i < ITERATIONS; i++) {
+    fn();
+  }
+  print(label + ": " + ((Date.now() - start) / ITERATIONS).toFixed(2) + "ms");
+  return result;
+}
+
+function check(label, actual, expected) {
+  print(label + " [" + (actual === expected ? "OK" : "FAIL") + "]");
+}
+
+var samples = new Float64Array(1024);
+for (var i = 0; i < samples.length; i++) {
+  samples[i] = ((i * 7919) % 1000) / 1000;
+}
+
+// The first calls run in the interpreter
+var expectedMix = mixInts(N), expectedFilter = filter(samples, N), expectedCold = coldValues(N, 100, 200, 300, 400);
+
+print("=== Int (" + N + " iterations) ===");
+check("14 live ints                ", bench("a = (a + b) | 0 ...         ", function () { return mixInts(N); }), expectedMix);
+check("cold values                 ", bench("p..s live across the loop   ", function () { return coldValues(N, 100, 200, 300, 400); }), expectedCold);
+print("");
+
+print("=== Float ===");
+check("8-tap filter                ", bench("out += a * z1 + ...         ", function () { return filter(samples, N); }), expectedFilter);
+print("");
+
+print("=== Benchmark Complete ===");
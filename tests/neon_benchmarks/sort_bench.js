@@ -0,0 +1,119 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// sort_bench.js — Array.prototype.sort and TypedArray.prototype.sort throughput
+//
+// Sorts 1M-element arrays of records by key with a comparison function, for random input and for
+// input that is already mostly in order (where the run merging gallops), then sorts native int,
+// native float and string arrays with the default ordering, and typed arrays.
+// Run with: ch sort_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var SIZE = 1000000;
+var ITERATIONS = 3;
+
+var seed = 12345;
+function random(limit) {
+  seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+  return seed % limit;
+}
+
+function makeRecords(keyOf) {
+  var records = new Array(SIZE);
+  for (var i = 0; i < SIZE; i++) {
+    records[i] = { key: keyOf(i), id: i, name: "record" + (i & 1023) };
+  }
+  return records;
+}
+
+function isSortedBy(arr, less) {
+  for (var i = 1; i < arr.length; i++) {
+    if (less(arr[i], arr[i - 1])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+function byKey(a, b) {
+  return a.key - b.key;
+}
+
+function keyLess(a, b) {
+  return a.key < b.key || (a.key === b.key && a.id < b.id);
+}
+
+function bench(label, make, sort, check) {
+  var total = 0;
+  var ok = true;
+  for (var i = 0; i < ITERATIONS; i++) {
+    var data = make();
+    var start = Date.now();
+    sort(data);
+    total += Date.now() - start;
+    ok = ok && check(data);
+  }
+  print(label + ": " + (total / ITERATIONS).toFixed(1) + "ms [" + (ok ? "OK" : "FAIL") + "]");
+}
+
+print("=== Records sorted by key (" + SIZE + " elements) ===");
+bench("random keys                 ", function () { return makeRecords(function () { return random(SIZE); }); },
+  function (a) { a.sort(byKey); }, function (a) { return isSortedBy(a, keyLess); });
+bench("sorted keys                 ", function () { return makeRecords(function (i) { return i; }); },
+  function (a) { a.sort(byKey); }, function (a) { return isSortedBy(a, keyLess); });
+bench("reversed keys               ", function () { return makeRecords(function (i) { return SIZE - i; }); },
+  function (a) { a.sort(byKey); }, function (a) { return isSortedBy(a, keyLess); });
+bench("sorted with 1% appended     ", function () { return makeRecords(function (i) { return i < SIZE * 0.99 ? i : random(SIZE); }); },
+  function (a) { a.sort(byKey); }, function (a) { return isSortedBy(a, keyLess); });
+bench("100 sorted batches          ", function () { return makeRecords(function (i) { return i % (SIZE / 100); }); },
+  function (a) { a.sort(byKey); }, function (a) { return isSortedBy(a, keyLess); });
+print("");
+
+function stringLess(a, b) {
+  return String(a) < String(b);
+}
+
+function numberLess(a, b) {
+  return a < b;
+}
+
+print("=== Default ordering ===");
+bench("native int array            ", function () {
+    var a = new Array(SIZE);
+    for (var i = 0; i < SIZE; i++) { a[i] = random(SIZE) - SIZE / 2; }
+    return a;
+  }, function (a) { a.sort(); }, function (a) { return isSortedBy(a, stringLess); });
+bench("native float array          ", function () {
+    var a = new Array(SIZE / 4);
+    for (var i = 0; i < a.length; i++) { a[i] = random(SIZE) / 8; }
+    return a;
+  }, function (a) { a.sort(); }, function (a) { return isSortedBy(a, stringLess); });
+bench("strings                     ", function () {
+    var a = new Array(SIZE / 4);
+    for (var i = 0; i < a.length; i++) { a[i] = "item" + random(SIZE); }
+    return a;
+  }, function (a) { a.sort(); }, function (a) { return isSortedBy(a, stringLess); });
+print("");
+
+print("=== Typed arrays ===");
+bench("Int32Array                  ", function () {
+    var a = new Int32Array(SIZE);
+    for (var i = 0; i < SIZE; i++) { a[i] = random(SIZE) - SIZE / 2; }
+    return a;
+  }, function (a) { a.sort(); }, function (a) { return isSortedBy(a, numberLess); });
+bench("Float64Array                ", function () {
+    var a = new Float64Array(SIZE);
+    for (var i = 0; i < SIZE; i++) { a[i] = random(SIZE) / 3; }
+    return a;
+  }, function (a) { a.sort(); }, function (a) { return isSortedBy(a, numberLess); });
+bench("Float64Array, comparator    ", function () {
+    var a = new Float64Array(SIZE / 4);
+    for (var i = 0; i < a.length; i++) { a[i] = random(SIZE) / 3; }
+    return a;
+  }, function (a) { a.sort(function (x, y) { return y - x; }); }, function (a) { return isSortedBy(a, function (x, y) { return x > y; }); });
+print("");
+
+print("=== Benchmark Complete ===");
@@ -0,0 +1,159 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// string_search_bench.js — String.prototype search family benchmark (SIMD anchored search)
+//
+// Measures includes / indexOf / lastIndexOf / split(string) over log-line shaped input, across
+// needle lengths on both sides of the anchored-search / Boyer-Moore cutoff (32 code units),
+// for found-late and not-found needles, and for non-ASCII needles that Boyer-Moore can't handle.
+// Run with: ch string_search_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var LINES = 2000;
+var ITERS = 50;
+
+function makeLine(i) {
+  return (
+    "2024-03-" +
+    (10 + (i % 20)) +
+    "T12:" +
+    (10 + (i % 50)) +
+    ":07.123Z host-" +
+    (i % 97) +
+    " svc=api-gateway level=info req=" +
+    (i * 7919) +
+    " path=/v1/orders/" +
+    (i % 1000) +
+    " status=200 latency_ms=" +
+    (i % 300) +
+    " ua=Mozilla/5.0 (Macintosh; Intel Mac OS X 10_15_7) AppleWebKit/605.1.15"
+  );
+}
+
+var lines = [];
+for (var i = 0; i < LINES; i++) {
+  lines.push(makeLine(i));
+}
+var bigText = lines.join("\n");
+
+var nonAsciiLines = [];
+for (var i = 0; i < LINES; i++) {
+  nonAsciiLines.push(makeLine(i) + " user=Jos\u00e9 M\u00fcller \u6771\u4eac");
+}
+
+function report(label, elapsed, units, status) {
+  var mPerSec = units / (elapsed / 1000) / 1e6;
+  print(
+    label +
+      ": " +
+      elapsed +
+      "ms (" +
+      (elapsed > 0 ? mPerSec.toFixed(1) : "inf") +
+      " M chars/s) [" +
+      status +
+      "]",
+  );
+}
+
+function totalLength(arr) {
+  var n = 0;
+  for (var i = 0; i < arr.length; i++) {
+    n += arr[i].length;
+  }
+  return n;
+}
+
+// =====================================================================================
+// Section 1: includes() over many log lines (the log-filtering pattern)
+// =====================================================================================
+
+function benchIncludes(label, input, needle, expectedHits) {
+  var start = Date.now();
+  var hits = 0;
+  for (var iter = 0; iter < ITERS; iter++) {
+    hits = 0;
+    for (var i = 0; i < input.length; i++) {
+      if (input[i].includes(needle)) {
+        hits++;
+      }
+    }
+  }
+  var elapsed = Date.now() - start;
+  report(
+    label,
+    elapsed,
+    totalLength(input) * ITERS,
+    hits === expectedHits ? "OK" : "FAIL(got " + hits + ")",
+  );
+}
+
+print("=== includes() over log lines ===");
+benchIncludes("len 1  not found  ", lines, "#", 0);
+benchIncludes("len 2  found late ", lines, "7)", LINES);
+benchIncludes("len 4  not found  ", lines, "WARN", 0);
+benchIncludes("len 8  found late ", lines, "605.1.15", LINES);
+benchIncludes("len 16 not found  ", lines, "level=error req=", 0);
+benchIncludes("len 40 not found  ", lines, "svc=api-gateway level=error status=500 x", 0);
+benchIncludes("non-ASCII len 2   ", nonAsciiLines, "\u6771\u4eac", LINES);
+benchIncludes("non-ASCII missing ", nonAsciiLines, "\u00fcber", 0);
+print("");
+
+// =====================================================================================
+// Section 2: indexOf / lastIndexOf over one long string
+// =====================================================================================
+
+function benchIndexOf(label, method, needle, expected) {
+  var start = Date.now();
+  var result = -2;
+  for (var iter = 0; iter < ITERS; iter++) {
+    result = bigText[method](needle);
+  }
+  var elapsed = Date.now() - start;
+  report(
+    label,
+    elapsed,
+    bigText.length * ITERS,
+    result === expected ? "OK" : "FAIL(got " + result + ")",
+  );
+}
+
+var lastReq = "req=" + (LINES - 1) * 7919;
+var firstReq = "req=0 ";
+
+print("=== indexOf / lastIndexOf over " + bigText.length + " chars ===");
+benchIndexOf("indexOf      len 1  missing", "indexOf", "#", -1);
+benchIndexOf("indexOf      len 9  last   ", "indexOf", lastReq, bigText.lastIndexOf(lastReq));
+benchIndexOf("indexOf      len 40 missing", "indexOf", "svc=api-gateway level=error status=500 x", -1);
+benchIndexOf("lastIndexOf  len 1  missing", "lastIndexOf", "#", -1);
+benchIndexOf("lastIndexOf  len 6  first  ", "lastIndexOf", firstReq, bigText.indexOf(firstReq));
+benchIndexOf("lastIndexOf  len 40 missing", "lastIndexOf", "svc=api-gateway level=error status=500 x", -1);
+print("");
+
+// =====================================================================================
+// Section 3: split() by string separator
+// =====================================================================================
+
+function benchSplit(label, separator, expectedParts) {
+  var start = Date.now();
+  var parts = null;
+  for (var iter = 0; iter < ITERS; iter++) {
+    parts = bigText.split(separator);
+  }
+  var elapsed = Date.now() - start;
+  report(
+    label,
+    elapsed,
+    bigText.length * ITERS,
+    parts.length === expectedParts ? "OK" : "FAIL(got " + parts.length + ")",
+  );
+}
+
+print("=== split(string) ===");
+benchSplit("split \"\\n\"         ", "\n", LINES);
+benchSplit("split \" status=\"   ", " status=", LINES + 1);
+print("");
+
+print("=== Benchmark Complete ===");
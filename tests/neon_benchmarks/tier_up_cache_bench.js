@@ -0,0 +1,85 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// tier_up_cache_bench.js — time to peak performance with and without the tier-up cache
+//
+// With -TierUpCache:<file>, the profiles of functions that reached the full JIT are saved when the
+// script context closes, and on the next run those functions are jitted as soon as the script is
+// loaded instead of being interpreted and simple jitted first. Run this twice with the same file and
+// compare the warm-up timings of the second run with the first:
+//   ch -TierUpCache:tier_up.cache tier_up_cache_bench.js
+//   ch -TierUpCache:tier_up.cache tier_up_cache_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var ROUNDS = 10;
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+function distanceSum(points) {
+  var sum = 0;
+  for (var i = 1; i < points.length; i++) {
+    var dx = points[i].x - points[i - 1].x;
+    var dy = points[i].y - points[i - 1].y;
+    sum += Math.sqrt(dx * dx + dy * dy);
+  }
+  return sum;
+}
+
+function histogram(values, buckets) {
+  var counts = new Array(buckets);
+  for (var i = 0; i < buckets; i++) {
+    counts[i] = 0;
+  }
+  for (var j = 0; j < values.length; j++) {
+    counts[values[j] % buckets]++;
+  }
+  return counts;
+}
+
+function wordCount(text) {
+  var counts = {};
+  var words = text.split(" ");
+  for (var i = 0; i < words.length; i++) {
+    var word = words[i];
+    counts[word] = (counts[word] || 0) + 1;
+  }
+  return counts;
+}
+
+var points = [];
+var values = [];
+for (var i = 0; i < 2000; i++) {
+  points.push(new Point(i % 37, i % 91));
+  values.push((i * 7919) & 0xffff);
+}
+var text = "the quick brown fox jumps over the lazy dog and the dog sleeps ".repeat(50);
+
+function round() {
+  var d = distanceSum(points);
+  var h = histogram(values, 64);
+  var w = wordCount(text);
+  return d + h[0] + w.the;
+}
+
+print("=== Warm-up (per round) ===");
+var first = round();
+var ok = true;
+for (var r = 0; r < ROUNDS; r++) {
+  var start = Date.now();
+  var result;
+  for (var k = 0; k < 20; k++) {
+    result = round();
+  }
+  ok = ok && result === first;
+  print("Round " + (r < 9 ? " " : "") + (r + 1) + "                     : " + (Date.now() - start) + "ms");
+}
+print("Results stable                [" + (ok ? "OK" : "FAIL") + "]");
+print("");
+
+print("=== Benchmark Complete ===");
@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// typed_array_kernel_bench.js — elementwise typed array loops
+//
+// The full JIT replaces counted loops of the form a[i] = b[i] op c[i] and a[i] = b[i] op invariant over
+// Int32Array (+, -), Float32Array and Float64Array (+, -, *, /) with a single vectorized kernel call.
+// This times such loops over 1M elements and checks their results against plain per-element math.
+// Compare with the scalar loops by running a second time with -off:MemArith.
+// Run with: ch typed_array_kernel_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var N = 1024 * 1024;
+var ITERATIONS = 20;
+
+function add64(a, b, c) { for (var i = 0; i < a.length; i++) { a[i] = b[i] + c[i]; } }
+function mul64(a, b, c) { for (var i = 0; i < a.length; i++) { a[i] = b[i] * c[i]; } }
+function scale64(a, b, k) { for (var i = 0; i < a.length; i++) { a[i] = b[i] * k; } }
+function div32(a, b, c) { for (var i = 0; i < a.length; i++) { a[i] = b[i] / c[i]; } }
+function scale32(a, b, k) { for (var i = 0; i < a.length; i++) { a[i] = b[i] * k; } }
+function addInt(a, b, c) { for (var i = 0; i < a.length; i++) { a[i] = b[i] + c[i]; } }
+function subInt(a, b, k) { for (var i = 0; i < a.length; i++) { a[i] = b[i] - k; } }
+
+function fill(a, seed) {
+  for (var i = 0; i < a.length; i++) {
+    a[i] = ((i * 7919 + seed) % 1000) / 4 + 1;
+  }
+  return a;
+}
+
+function bench(label, fn) {
+  fn();
+  var start = Date.now();
+  for (var i = 0; i < ITERATIONS; i++) {
+    fn();
+  }
+  print(label + ": " + ((Date.now() - start) / ITERATIONS).toFixed(2) + "ms");
+}
+
+function check(label, a, expected) {
+  var ok = true;
+  for (var i = 0; i < a.length && ok; i++) {
+    ok = a[i] === expected(i);
+  }
+  print(label + " [" + (ok ? "OK" : "FAIL") + "]");
+}
+
+var f64a = new Float64Array(N), f64b = fill(new Float64Array(N), 1), f64c = fill(new Float64Array(N), 2);
+var f32a = new Float32Array(N), f32b = fill(new Float32Array(N), 3), f32c = fill(new Float32Array(N), 4);
+var i32a = new Int32Array(N), i32b = fill(new Int32Array(N), 5), i32c = fill(new Int32Array(N), 6);
+
+print("=== Float64Array (" + N + " elements) ===");
+bench("a[i] = b[i] + c[i]          ", function () { add64(f64a, f64b, f64c); });
+check("Float64 add                 ", f64a, function (i) { return f64b[i] + f64c[i]; });
+bench("a[i] = b[i] * c[i]          ", function () { mul64(f64a, f64b, f64c); });
+check("Float64 mul                 ", f64a, function (i) { return f64b[i] * f64c[i]; });
+bench("a[i] = b[i] * 1.5           ", function () { scale64(f64a, f64b, 1.5); });
+check("Float64 scale               ", f64a, function (i) { return f64b[i] * 1.5; });
+print("");
+
+print("=== Float32Array ===");
+bench("a[i] = b[i] / c[i]          ", function () { div32(f32a, f32b, f32c); });
+check("Float32 div                 ", f32a, function (i) { return Math.fround(f32b[i] / f32c[i]); });
+bench("a[i] = b[i] * 0.1           ", function () { scale32(f32a, f32b, 0.1); });
+check("Float32 scale               ", f32a, function (i) { return Math.fround(f32b[i] * 0.1); });
+print("");
+
+print("=== Int32Array ===");
+bench("a[i] = b[i] + c[i]          ", function () { addInt(i32a, i32b, i32c); });
+check("Int32 add                   ", i32a, function (i) { return (i32b[i] + i32c[i]) | 0; });
+bench("a[i] = b[i] - 7             ", function () { subInt(i32a, i32b, 7); });
+check("Int32 sub                   ", i32a, function (i) { return (i32b[i] - 7) | 0; });
+print("");
+
+print("=== Benchmark Complete ===");
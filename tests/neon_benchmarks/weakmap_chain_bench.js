@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) ChakraSilicon Project Contributors. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+//
+// weakmap_chain_bench.js — GC pause time with deep WeakMap chains (ephemeron marking)
+//
+// Measures full collections over heaps where most objects are only reachable through WeakMap values:
+// chains of WeakMaps where each value holds the key of the next map (built both with and against the
+// order the maps were created in), one long chain inside a single WeakMap, and the "private state"
+// pattern frameworks use, where every instance keeps its fields in a set of WeakMaps.
+// Run with: ch weakmap_chain_bench.js
+//
+//-------------------------------------------------------------------------------------------------------
+
+var GCS = 10;
+
+// maps[i] maps keys[i] to an object holding keys[i + 1]; only the first key is rooted.
+function makeMapChain(depth, width, reverse) {
+  var maps = [];
+  for (var i = 0; i < depth; i++) {
+    if (reverse) {
+      maps.unshift(new WeakMap());
+    } else {
+      maps.push(new WeakMap());
+    }
+  }
+
+  var roots = [];
+  for (var w = 0; w < width; w++) {
+    var key = {};
+    roots.push(key);
+    for (var i = 0; i < depth; i++) {
+      var next = { depth: i + 1 };
+      maps[i].set(key, { next: next, payload: [w, i] });
+      key = next;
+    }
+  }
+  return { maps: maps, roots: roots, depth: depth };
+}
+
+function checkMapChain(chain) {
+  for (var w = 0; w < chain.roots.length; w++) {
+    var key = chain.roots[w];
+    for (var i = 0; i < chain.depth; i++) {
+      var value = chain.maps[i].get(key);
+      if (value === undefined || value.payload[0] !== w || value.payload[1] !== i) {
+        return false;
+      }
+      key = value.next;
+    }
+  }
+  return true;
+}
+
+// One WeakMap where the value for each key holds the next key.
+function makeSelfChain(length) {
+  var map = new WeakMap();
+  var first = {};
+  var key = first;
+  for (var i = 0; i < length; i++) {
+    var next = {};
+    map.set(key, { next: next, index: i });
+    key = next;
+  }
+  return { map: map, first: first, length: length };
+}
+
+function checkSelfChain(chain) {
+  var key = chain.first;
+  for (var i = 0; i < chain.length; i++) {
+    var value = chain.map.get(key);
+    if (value === undefined || value.index !== i) {
+      return false;
+    }
+    key = value.next;
+  }
+  return true;
+}
+
+// Instances keep their fields in WeakMaps, and each instance's state refers to a child instance.
+var fieldMaps = [new WeakMap(), new WeakMap(), new WeakMap(), new WeakMap()];
+
+function Component(depth) {
+  fieldMaps[0].set(this, { depth: depth });
+  fieldMaps[1].set(this, depth > 0 ? new Component(depth - 1) : null);
+  fieldMaps[2].set(this, ["listener", depth]);
+  fieldMaps[3].set(this, { cache: new Array(4) });
+}
+
+function makeComponents(count, depth) {
+  var roots = [];
+  for (var i = 0; i < count; i++) {
+    roots.push(new Component(depth));
+  }
+  return { roots: roots, depth: depth };
+}
+
+function checkComponents(tree) {
+  for (var i = 0; i < tree.roots.length; i++) {
+    var component = tree.roots[i];
+    for (var d = tree.depth; d >= 0; d--) {
+      var state = fieldMaps[0].get(component);
+      if (state === undefined || state.depth !== d || fieldMaps[2].get(component)[1] !== d) {
+        return false;
+      }
+      component = fieldMaps[1].get(component);
+    }
+  }
+  return true;
+}
+
+function bench(label, make, check) {
+  var data = make();
+  CollectGarbage();
+
+  var start = Date.now();
+  for (var i = 0; i < GCS; i++) {
+    CollectGarbage();
+  }
+  var elapsed = Date.now() - start;
+
+  print(label + ": " + (elapsed / GCS).toFixed(1) + "ms per GC [" + (check(data) ? "OK" : "FAIL") + "]");
+}
+
+print("=== WeakMap chains across maps ===");
+bench("depth 1000 x 1 chain, creation order", function () { return makeMapChain(1000, 1, false); }, checkMapChain);
+bench("depth 1000 x 1 chain, reverse order ", function () { return makeMapChain(1000, 1, true); }, checkMapChain);
+bench("depth 200 x 100 chains              ", function () { return makeMapChain(200, 100, false); }, checkMapChain);
+print("");
+
+print("=== Chain within one WeakMap ===");
+bench("length 100000                       ", function () { return makeSelfChain(100000); }, checkSelfChain);
+print("");
+
+print("=== Private state in WeakMaps ===");
+bench("2000 components, depth 20           ", function () { return makeComponents(2000, 20); }, checkComponents);
+print("");
+
+print("=== Benchmark Complete ===");